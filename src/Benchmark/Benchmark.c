@@ -0,0 +1,483 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file Benchmark.c
+/// \brief On-target microbenchmark suite measuring BSP primitives in core clock cycles.
+/// \details Results are written through Stubs, one line per measured operation:
+///          "@bench name=<operation> count=<n> min=<cycles> max=<cycles> mean=<cycles>",
+///          enclosed by "@bench-begin core_hz=<hz> profile=<default|performance>" and
+///          "@bench-end" lines. Operations which could not be measured are reported as
+///          "@bench-error name=<operation>".
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <Mcan/Mcan.h>
+#include <Pio/Pio.h>
+#include <Pmc/Pmc.h>
+#include <Pmc/PmcClockManager.h>
+#include <Profile/Profile.h>
+#include <Scb/Scb.h>
+#include <Stubs/Stubs.h>
+#include <Uart/Uart.h>
+#include <Utils/ByteFifo.h>
+#include <Utils/StructFifo.h>
+
+#if !defined(N7S_TARGET_SAMV71Q21)
+#error "The benchmark executable supports only the SAMV71Q21 target"
+#endif
+
+#ifndef BENCHMARK_ITERATION_COUNT
+/// \brief Number of iterations of fast operations.
+#define BENCHMARK_ITERATION_COUNT 1000u
+#endif
+
+#ifndef BENCHMARK_SLOW_ITERATION_COUNT
+/// \brief Number of iterations of operations waiting for the hardware.
+#define BENCHMARK_SLOW_ITERATION_COUNT 16u
+#endif
+
+#ifndef BENCHMARK_MAINCK_FREQUENCY
+/// \brief Main clock frequency in [Hz], of the crystal in use.
+#define BENCHMARK_MAINCK_FREQUENCY 12000000u
+#endif
+
+#ifndef BENCHMARK_UART_ID
+/// \brief Uart used in local loopback mode, shall differ from the Stubs console Uart.
+#define BENCHMARK_UART_ID Uart_Id_2
+#endif
+
+#define BENCHMARK_UART_BAUDRATE 115200u
+#define BENCHMARK_TIMEOUT 1000000u
+#define BENCHMARK_FIFO_CAPACITY 64u
+#define BENCHMARK_CACHE_BLOCK_SIZE 1024u
+#define BENCHMARK_MCAN_FIFO_SIZE 8u
+#define BENCHMARK_MCAN_ELEMENT_WORD_COUNT 4u
+#define BENCHMARK_MCAN_RAM_WORD_COUNT \
+	(2u * BENCHMARK_MCAN_FIFO_SIZE * BENCHMARK_MCAN_ELEMENT_WORD_COUNT)
+
+typedef struct {
+	uint32_t words[4];
+} BenchmarkElement;
+
+static uint8_t byteFifoMemory[BENCHMARK_FIFO_CAPACITY];
+static BenchmarkElement structFifoMemory[BENCHMARK_FIFO_CAPACITY];
+static uint8_t uartFifoMemory[BENCHMARK_FIFO_CAPACITY];
+static uint8_t cacheBlock[BENCHMARK_CACHE_BLOCK_SIZE] SCB_CACHE_ALIGNED;
+// Message RAM must not cross a 64 KB boundary, as only the lower address half is configurable.
+static uint32_t mcanMessageRam[BENCHMARK_MCAN_RAM_WORD_COUNT]
+		__attribute__((aligned(BENCHMARK_MCAN_RAM_WORD_COUNT * 4u)));
+
+static Pmc pmc;
+
+static Profile_Probe byteFifoPushProbe;
+static Profile_Probe byteFifoPullProbe;
+static Profile_Probe structFifoPushProbe;
+static Profile_Probe structFifoPullProbe;
+static Profile_Probe cacheCleanProbe;
+static Profile_Probe cacheInvalidateProbe;
+static Profile_Probe cacheCleanInvalidateProbe;
+static Profile_Probe pioProbe;
+static Profile_Probe pmcProbe;
+static Profile_Probe mcanPushProbe;
+static Profile_Probe mcanPullProbe;
+static Profile_Probe uartProbe;
+
+static Profile_Probe *const results[] = {
+	&byteFifoPushProbe,
+	&byteFifoPullProbe,
+	&structFifoPushProbe,
+	&structFifoPullProbe,
+	&cacheCleanProbe,
+	&cacheInvalidateProbe,
+	&cacheCleanInvalidateProbe,
+	&pioProbe,
+	&pmcProbe,
+	&mcanPushProbe,
+	&mcanPullProbe,
+	&uartProbe,
+};
+
+static void
+benchmarkByteFifo(void)
+{
+	Profile_initProbe(&byteFifoPushProbe, "ByteFifo_push");
+	Profile_initProbe(&byteFifoPullProbe, "ByteFifo_pull");
+
+	ByteFifo fifo;
+	ByteFifo_init(&fifo, byteFifoMemory, sizeof(byteFifoMemory));
+
+	uint8_t data = 0u;
+	for (uint32_t i = 0u; i < BENCHMARK_ITERATION_COUNT; i++) {
+		Profile_begin(&byteFifoPushProbe);
+		(void)ByteFifo_push(&fifo, (uint8_t)i);
+		Profile_end(&byteFifoPushProbe);
+
+		Profile_begin(&byteFifoPullProbe);
+		(void)ByteFifo_pull(&fifo, &data);
+		Profile_end(&byteFifoPullProbe);
+	}
+}
+
+static void
+benchmarkStructFifo(void)
+{
+	Profile_initProbe(&structFifoPushProbe, "StructFifo_push");
+	Profile_initProbe(&structFifoPullProbe, "StructFifo_pull");
+
+	StructFifo fifo;
+	StructFifo_init(&fifo, structFifoMemory, sizeof(BenchmarkElement),
+			BENCHMARK_FIFO_CAPACITY);
+
+	BenchmarkElement element = { { 0u } };
+	for (uint32_t i = 0u; i < BENCHMARK_ITERATION_COUNT; i++) {
+		element.words[0] = i;
+
+		Profile_begin(&structFifoPushProbe);
+		(void)StructFifo_push(&fifo, &element);
+		Profile_end(&structFifoPushProbe);
+
+		Profile_begin(&structFifoPullProbe);
+		(void)StructFifo_pull(&fifo, &element);
+		Profile_end(&structFifoPullProbe);
+	}
+}
+
+static void
+benchmarkCache(void)
+{
+	Profile_initProbe(&cacheCleanProbe, "Scb_cleanDCacheByAddr_1KB");
+	Profile_initProbe(&cacheInvalidateProbe, "Scb_invalidateDCacheByAddr_1KB");
+	Profile_initProbe(&cacheCleanInvalidateProbe,
+			"Scb_cleanInvalidateDCacheByAddr_1KB");
+
+	const bool wasDCacheEnabled = Scb_isDCacheEnabled();
+	(void)Scb_enableDCache();
+
+	for (uint32_t i = 0u; i < BENCHMARK_SLOW_ITERATION_COUNT; i++) {
+		// Each operation works on dirty lines, as after the CPU filled a DMA buffer.
+		(void)memset(cacheBlock, (int)i, sizeof(cacheBlock));
+		Profile_begin(&cacheCleanProbe);
+		(void)Scb_cleanDCacheByAddr(cacheBlock, sizeof(cacheBlock));
+		Profile_end(&cacheCleanProbe);
+
+		(void)memset(cacheBlock, (int)i, sizeof(cacheBlock));
+		Profile_begin(&cacheCleanInvalidateProbe);
+		(void)Scb_cleanInvalidateDCacheByAddr(
+				cacheBlock, sizeof(cacheBlock));
+		Profile_end(&cacheCleanInvalidateProbe);
+
+		(void)memset(cacheBlock, (int)i, sizeof(cacheBlock));
+		(void)Scb_cleanDCacheByAddr(cacheBlock, sizeof(cacheBlock));
+		Profile_begin(&cacheInvalidateProbe);
+		(void)Scb_invalidateDCacheByAddr(cacheBlock, sizeof(cacheBlock));
+		Profile_end(&cacheInvalidateProbe);
+	}
+
+	if (!wasDCacheEnabled)
+		(void)Scb_disableDCache();
+}
+
+static bool
+benchmarkPio(void)
+{
+	Profile_initProbe(&pioProbe, "Pio_setPinsConfig");
+
+	Pio pio;
+	Pio_Pin_Config config;
+	ErrorCode errCode = ErrorCode_NoError;
+	if (!Pio_init(Pio_Port_A, &pio, &errCode))
+		return false;
+	if (!Pio_getPinsConfig(&pio, PIO_PIN_0, &config, &errCode))
+		return false;
+
+	// The current configuration is applied again, so the pin state does not change.
+	for (uint32_t i = 0u; i < BENCHMARK_ITERATION_COUNT; i++) {
+		Profile_begin(&pioProbe);
+		const bool isSet = Pio_setPinsConfig(
+				&pio, PIO_PIN_0, &config, &errCode);
+		Profile_end(&pioProbe);
+		if (!isSet)
+			return false;
+	}
+
+	return true;
+}
+
+static bool
+benchmarkPmc(void)
+{
+	Profile_initProbe(&pmcProbe, "Pmc_setConfig");
+
+	Pmc_Config config;
+	Pmc_getConfig(&pmc, &config);
+	// PCK5 clocks the Mcan core used by the following benchmark.
+	config.pck[Pmc_PckId_5].isEnabled = true;
+	config.pck[Pmc_PckId_5].src = Pmc_PckSrc_Mainck;
+	config.pck[Pmc_PckId_5].presc = 0u;
+
+	ErrorCode errCode = ErrorCode_NoError;
+	for (uint32_t i = 0u; i < BENCHMARK_SLOW_ITERATION_COUNT; i++) {
+		Profile_begin(&pmcProbe);
+		const bool isSet = Pmc_setConfig(
+				&pmc, &config, BENCHMARK_TIMEOUT, &errCode);
+		Profile_end(&pmcProbe);
+		if (!isSet)
+			return false;
+	}
+
+	return true;
+}
+
+static bool
+configureMcan(Mcan *const mcan)
+{
+	Mcan_Config config;
+	(void)memset(&config, 0, sizeof(config));
+	(void)memset(mcanMessageRam, 0, sizeof(mcanMessageRam));
+
+	uint32_t *const rxFifoAddress = &mcanMessageRam[0];
+	uint32_t *const txQueueAddress = &mcanMessageRam[BENCHMARK_MCAN_FIFO_SIZE
+			* BENCHMARK_MCAN_ELEMENT_WORD_COUNT];
+
+	config.msgRamBaseAddress = mcanMessageRam;
+	config.mode = Mcan_Mode_InternalLoopBackTest;
+	config.isFdEnabled = false;
+	config.nominalBitTiming.bitRatePrescaler = 2u;
+	config.nominalBitTiming.synchronizationJump = 1u;
+	config.nominalBitTiming.timeSegmentAfterSamplePoint = 2u;
+	config.nominalBitTiming.timeSegmentBeforeSamplePoint = 5u;
+	config.dataBitTiming = config.nominalBitTiming;
+	config.timestampClk = Mcan_TimestampClk_None;
+	config.standardIdFilter.isIdRejected = false;
+	config.standardIdFilter.nonMatchingPolicy =
+			Mcan_NonMatchingPolicy_RxFifo0;
+	config.standardIdFilter.filterListAddress = rxFifoAddress;
+	config.extendedIdFilter = config.standardIdFilter;
+	config.rxFifo0.isEnabled = true;
+	config.rxFifo0.startAddress = rxFifoAddress;
+	config.rxFifo0.size = BENCHMARK_MCAN_FIFO_SIZE;
+	config.rxFifo0.mode = Mcan_RxFifoOperationMode_Overwrite;
+	config.rxFifo0.elementSize = Mcan_ElementSize_8;
+	config.rxFifo1.startAddress = rxFifoAddress;
+	config.rxBuffer.startAddress = rxFifoAddress;
+	config.rxBuffer.elementSize = Mcan_ElementSize_8;
+	config.txBuffer.isEnabled = true;
+	config.txBuffer.startAddress = txQueueAddress;
+	config.txBuffer.queueSize = BENCHMARK_MCAN_FIFO_SIZE;
+	config.txBuffer.queueType = Mcan_TxQueueType_Fifo;
+	config.txBuffer.elementSize = Mcan_ElementSize_8;
+	config.txEventFifo.startAddress = txQueueAddress;
+
+	ErrorCode errCode = ErrorCode_NoError;
+	Mcan_init(mcan, Mcan_getDeviceRegisters(Mcan_Id_0));
+	return Mcan_setConfig(mcan, &config, BENCHMARK_TIMEOUT, &errCode);
+}
+
+static bool
+waitForRxFifoElement(const Mcan *const mcan)
+{
+	Mcan_RxFifoStatus status = { 0u, false, false };
+	ErrorCode errCode = ErrorCode_NoError;
+
+	for (uint32_t i = 0u; i < BENCHMARK_TIMEOUT; i++) {
+		if (!Mcan_getRxFifoStatus(mcan, Mcan_RxFifoId_0, &status, &errCode))
+			return false;
+		if (status.count != 0u)
+			return true;
+	}
+
+	return false;
+}
+
+static bool
+benchmarkMcan(void)
+{
+	Profile_initProbe(&mcanPushProbe, "Mcan_txQueuePush");
+	Profile_initProbe(&mcanPullProbe, "Mcan_rxFifoPull");
+
+	Pmc_enablePeripheralClk(&pmc, Pmc_PeripheralId_Mcan0);
+
+	Mcan mcan;
+	if (!configureMcan(&mcan))
+		return false;
+
+	uint8_t txData[8] = { 0u };
+	uint8_t rxData[8] = { 0u };
+	Mcan_TxElement txElement;
+	(void)memset(&txElement, 0, sizeof(txElement));
+	txElement.esiFlag = Mcan_ElementEsi_Dominant;
+	txElement.idType = Mcan_IdType_Standard;
+	txElement.frameType = Mcan_FrameType_Data;
+	txElement.id = 0x123u;
+	txElement.dataSize = (uint8_t)sizeof(txData);
+	txElement.data = txData;
+	Mcan_RxElement rxElement;
+	(void)memset(&rxElement, 0, sizeof(rxElement));
+	rxElement.data = rxData;
+
+	ErrorCode errCode = ErrorCode_NoError;
+	uint8_t index = 0u;
+	for (uint32_t i = 0u; i < BENCHMARK_SLOW_ITERATION_COUNT; i++) {
+		txData[0] = (uint8_t)i;
+
+		Profile_begin(&mcanPushProbe);
+		const bool isPushed = Mcan_txQueuePush(
+				&mcan, txElement, &index, &errCode);
+		Profile_end(&mcanPushProbe);
+		if (!isPushed || !waitForRxFifoElement(&mcan))
+			return false;
+
+		Profile_begin(&mcanPullProbe);
+		const bool isPulled = Mcan_rxFifoPull(
+				&mcan, Mcan_RxFifoId_0, &rxElement, &errCode);
+		Profile_end(&mcanPullProbe);
+		if (!isPulled)
+			return false;
+	}
+
+	return true;
+}
+
+static bool
+waitForUartRx(const Uart *const uart)
+{
+	for (uint32_t i = 0u; i < BENCHMARK_TIMEOUT; i++)
+		if ((Uart_getStatusRegister(uart) & UART_SR_RXRDY_MASK) != 0u)
+			return true;
+
+	return false;
+}
+
+static bool
+benchmarkUart(void)
+{
+	Profile_initProbe(&uartProbe, "Uart_handleInterrupt_byte");
+
+	Uart uart;
+	Uart_init(BENCHMARK_UART_ID, &uart);
+	Uart_startup(&uart);
+
+	Uart_Config config;
+	(void)memset(&config, 0, sizeof(config));
+	config.isTxEnabled = true;
+	config.isRxEnabled = true;
+	config.isTestModeEnabled = true;
+	config.parity = Uart_Parity_None;
+	config.baudRate = BENCHMARK_UART_BAUDRATE;
+	config.baudRateClkSrc = Uart_BaudRateClk_PeripheralCk;
+	config.baudRateClkFreq =
+			Pmc_getMasterckFrequency(&pmc, BENCHMARK_MAINCK_FREQUENCY);
+	Uart_setConfig(&uart, &config);
+
+	// The reception interrupt is only unmasked in the Uart, the handler is called here.
+	ByteFifo fifo;
+	ByteFifo_init(&fifo, uartFifoMemory, sizeof(uartFifoMemory));
+	Uart_RxHandler handler;
+	(void)memset(&handler, 0, sizeof(handler));
+	Uart_readAsync(&uart, &fifo, handler);
+
+	bool isSuccessful = true;
+	uint8_t data = 0u;
+	for (uint32_t i = 0u; i < BENCHMARK_SLOW_ITERATION_COUNT; i++) {
+		if (!Uart_write(&uart, (uint8_t)i, BENCHMARK_TIMEOUT, NULL)
+				|| !waitForUartRx(&uart)) {
+			isSuccessful = false;
+			break;
+		}
+
+		Profile_begin(&uartProbe);
+		Uart_handleInterrupt(&uart);
+		Profile_end(&uartProbe);
+
+		(void)ByteFifo_pull(&fifo, &data);
+	}
+
+	Uart_readAsync(&uart, NULL, handler);
+	Uart_shutdown(&uart);
+	return isSuccessful;
+}
+
+static void
+writeResult(const Profile_Probe *const probe)
+{
+	Profile_writeString("@bench name=");
+	Profile_writeString(probe->name);
+	Profile_writeString(" count=");
+	Profile_writeDecimal(probe->count);
+	Profile_writeString(" min=");
+	Profile_writeDecimal((probe->count != 0u) ? probe->minCycles : 0u);
+	Profile_writeString(" max=");
+	Profile_writeDecimal(probe->maxCycles);
+	Profile_writeString(" mean=");
+	Profile_writeDecimal(Profile_getMeanCycles(probe));
+	Profile_writeString("\r\n");
+}
+
+static void
+writeError(const char *const name)
+{
+	Profile_writeString("@bench-error name=");
+	Profile_writeString(name);
+	Profile_writeString("\r\n");
+}
+
+int
+main(void)
+{
+	Stubs_startup();
+	Pmc_init(&pmc, Pmc_getDeviceRegisterStartAddress());
+	PmcClockManager_init(Pmc_getDeviceRegisterStartAddress());
+	Profile_init();
+
+	Profile_writeString("@bench-begin core_hz=");
+	Profile_writeDecimal(Pmc_getProcessorClockFrequency(
+			&pmc, BENCHMARK_MAINCK_FREQUENCY));
+#if defined(BSP_PERFORMANCE_PROFILE)
+	Profile_writeString(" profile=performance");
+#else
+	Profile_writeString(" profile=default");
+#endif
+	Profile_writeString("\r\n");
+
+	benchmarkByteFifo();
+	benchmarkStructFifo();
+	benchmarkCache();
+	if (!benchmarkPio())
+		writeError("Pio_setPinsConfig");
+	if (!benchmarkPmc())
+		writeError("Pmc_setConfig");
+	if (!benchmarkMcan())
+		writeError("Mcan");
+	if (!benchmarkUart())
+		writeError("Uart_handleInterrupt_byte");
+
+	for (uint32_t i = 0u; i < (uint32_t)(sizeof(results) / sizeof(results[0]));
+			i++)
+		writeResult(results[i]);
+	Profile_writeString("@bench-end\r\n");
+
+	exit(EXIT_SUCCESS);
+}
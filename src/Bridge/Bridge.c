@@ -0,0 +1,296 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Bridge.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include <Nvic/Nvic.h>
+#include <Utils/Crc.h>
+#include <Utils/Memory.h>
+
+static void
+writeU16(uint8_t *const bytes, const uint16_t value)
+{
+	bytes[0] = (uint8_t)(value >> 8u);
+	bytes[1] = (uint8_t)value;
+}
+
+static void
+writeU32(uint8_t *const bytes, const uint32_t value)
+{
+	bytes[0] = (uint8_t)(value >> 24u);
+	bytes[1] = (uint8_t)(value >> 16u);
+	bytes[2] = (uint8_t)(value >> 8u);
+	bytes[3] = (uint8_t)value;
+}
+
+static uint8_t
+encodeFlags(const Mcan_RxElement *const element)
+{
+	uint8_t flags = 0u;
+	if (element->frameType == Mcan_FrameType_Remote)
+		flags |= BRIDGE_FRAME_FLAG_REMOTE_MASK;
+	if (element->isCanFdFormatEnabled)
+		flags |= BRIDGE_FRAME_FLAG_CAN_FD_MASK;
+	if (element->isBitRateSwitchingEnabled)
+		flags |= BRIDGE_FRAME_FLAG_BIT_RATE_SWITCH_MASK;
+	if (element->esiFlag == Mcan_ElementEsi_Recessive)
+		flags |= BRIDGE_FRAME_FLAG_ESI_MASK;
+	return flags;
+}
+
+bool
+Bridge_encodeFrame(const Mcan_RxElement *const element,
+		ByteBuffer *const buffer)
+{
+	assert(element != NULL);
+	assert(buffer != NULL);
+	assert(element->dataSize <= MCAN_FRAME_DATA_SIZE_MAX);
+
+	const size_t size = BRIDGE_FRAME_HEADER_SIZE + element->dataSize
+			+ BRIDGE_FRAME_CRC_SIZE;
+	uint8_t *const bytes = ByteBuffer_reserve(buffer, size);
+	if (bytes == NULL)
+		return false;
+
+	uint32_t id = element->id;
+	if (element->idType == Mcan_IdType_Extended)
+		id |= BRIDGE_FRAME_ID_EXTENDED_MASK;
+
+	bytes[0] = BRIDGE_FRAME_SYNC;
+	writeU32(&bytes[1], id);
+	bytes[5] = encodeFlags(element);
+	bytes[6] = element->dataSize;
+	writeU16(&bytes[7], element->timestamp);
+	Memory_copy(&bytes[BRIDGE_FRAME_HEADER_SIZE], element->data,
+			element->dataSize);
+
+	const uint16_t crc = Crc_crc16(CRC_16_INITIAL_VALUE, &bytes[1],
+			(BRIDGE_FRAME_HEADER_SIZE - 1u) + element->dataSize);
+	writeU16(&bytes[BRIDGE_FRAME_HEADER_SIZE + element->dataSize], crc);
+
+	return true;
+}
+
+static void
+swapFillBlock(Bridge *const bridge)
+{
+	bridge->fillIndex ^= 1u;
+	ByteBuffer_init(&bridge->encoder,
+			bridge->config.txBlocks[bridge->fillIndex],
+			bridge->config.txBlockSize);
+}
+
+static ByteFifo *
+handleTxEnd(void *arg)
+{
+	Bridge *const bridge = (Bridge *)arg;
+
+	bridge->statistics.txBytes += (uint32_t)bridge->txLength;
+	bridge->txLength = 0u;
+
+	if (!__atomic_load_n(&bridge->isFillPublished, __ATOMIC_ACQUIRE)) {
+		bridge->isTxActive = false;
+		return NULL;
+	}
+
+	// The filled block is complete and no longer accessed by Bridge_process.
+	const uint8_t index = bridge->fillIndex;
+	bridge->txLength = ByteBuffer_getCount(&bridge->encoder);
+	swapFillBlock(bridge);
+	bridge->statistics.txSwaps++;
+	__atomic_store_n(&bridge->isFillPublished, false, __ATOMIC_RELEASE);
+
+	return &bridge->txFifos[index];
+}
+
+void
+Bridge_init(Bridge *const bridge, const Bridge_Config *const config)
+{
+	assert(bridge != NULL);
+	assert(config != NULL);
+	assert(config->mcan != NULL);
+	assert(config->uart != NULL);
+	assert(config->stage != NULL);
+	assert(config->stage->elementSize == sizeof(Bridge_Frame));
+	assert(config->txBlocks[0] != NULL);
+	assert(config->txBlocks[1] != NULL);
+	assert(config->txBlockSize >= BRIDGE_FRAME_ENCODED_SIZE_MAX);
+
+	(void)memset(bridge, 0, sizeof(Bridge));
+	bridge->config = *config;
+	StructFifo_clear(bridge->config.stage);
+	ByteBuffer_init(&bridge->encoder, bridge->config.txBlocks[0],
+			bridge->config.txBlockSize);
+}
+
+static void
+pullFrames(Bridge *const bridge)
+{
+	const Bridge_Config *const config = &bridge->config;
+
+	for (;;) {
+		Bridge_Frame *const frame = StructFifo_reserve(config->stage);
+		if (frame == NULL) {
+			Mcan_RxElementView view;
+			if (Mcan_rxFifoPeekView(config->mcan, config->rxFifoId,
+					    &view, NULL))
+				bridge->statistics.stageFullCount++;
+			return;
+		}
+
+		// Payload is decoded straight into the stage slot.
+		frame->element.data = frame->data;
+		if (!Mcan_rxFifoPull(config->mcan, config->rxFifoId,
+				    &frame->element, NULL))
+			return;
+
+		StructFifo_commit(config->stage);
+		bridge->stageCount++;
+		bridge->statistics.rxFrames++;
+		if (bridge->stageCount > bridge->statistics.stageHighWatermark)
+			bridge->statistics.stageHighWatermark =
+					bridge->stageCount;
+	}
+}
+
+static void
+encodeFrames(Bridge *const bridge)
+{
+	StructFifo *const stage = bridge->config.stage;
+	const size_t initialCount = ByteBuffer_getCount(&bridge->encoder);
+
+	for (;;) {
+		const Bridge_Frame *const frame = StructFifo_front(stage);
+		if ((frame == NULL)
+				|| !Bridge_encodeFrame(
+						&frame->element, &bridge->encoder))
+			break;
+
+		StructFifo_release(stage);
+		bridge->stageCount--;
+		bridge->statistics.encodedFrames++;
+	}
+
+	bridge->statistics.encodedBytes += (uint32_t)(
+			ByteBuffer_getCount(&bridge->encoder) - initialCount);
+}
+
+static void
+startTransmission(Bridge *const bridge, ByteFifo *const fifo)
+{
+	const Uart_TxHandler handler = {
+		.callback = handleTxEnd,
+		.arg = bridge,
+	};
+
+	if (bridge->config.isDmaEnabled)
+		Uart_writeAsyncDma(bridge->config.uart, fifo, handler);
+	else
+		Uart_writeAsync(bridge->config.uart, fifo, handler);
+}
+
+static void
+handOverFillBlock(Bridge *const bridge)
+{
+	const uint8_t index = bridge->fillIndex;
+	const size_t count = ByteBuffer_getCount(&bridge->encoder);
+	ByteFifo_initFromBytes(&bridge->txFifos[index],
+			bridge->config.txBlocks[index], count);
+
+	const uint32_t primask = Nvic_saveAndDisableIrq();
+	const bool isTxActive = bridge->isTxActive;
+	if (isTxActive)
+		__atomic_store_n(&bridge->isFillPublished, true,
+				__ATOMIC_RELEASE);
+	else
+		bridge->isTxActive = true;
+	Nvic_restoreIrq(primask);
+
+	// Otherwise the block is handed to the Uart by handleTxEnd.
+	if (isTxActive)
+		return;
+
+	bridge->txLength = count;
+	swapFillBlock(bridge);
+	bridge->statistics.txStarts++;
+	startTransmission(bridge, &bridge->txFifos[index]);
+}
+
+void
+Bridge_process(Bridge *const bridge)
+{
+	assert(bridge != NULL);
+
+	pullFrames(bridge);
+
+	// Both blocks are in use, frames wait in the stage.
+	if (__atomic_load_n(&bridge->isFillPublished, __ATOMIC_ACQUIRE))
+		return;
+
+	encodeFrames(bridge);
+	if (ByteBuffer_getCount(&bridge->encoder) != 0u)
+		handOverFillBlock(bridge);
+
+	// Refill the stage slots released by encoding.
+	pullFrames(bridge);
+}
+
+bool
+Bridge_isIdle(const Bridge *const bridge)
+{
+	assert(bridge != NULL);
+
+	const uint32_t primask = Nvic_saveAndDisableIrq();
+	const bool isIdle = StructFifo_isEmpty(bridge->config.stage)
+			&& !bridge->isTxActive && !bridge->isFillPublished
+			&& (ByteBuffer_getCount(&bridge->encoder) == 0u);
+	Nvic_restoreIrq(primask);
+
+	return isIdle;
+}
+
+void
+Bridge_getStatistics(
+		const Bridge *const bridge, Bridge_Statistics *const statistics)
+{
+	assert(bridge != NULL);
+	assert(statistics != NULL);
+
+	const uint32_t primask = Nvic_saveAndDisableIrq();
+	*statistics = bridge->statistics;
+	Nvic_restoreIrq(primask);
+}
+
+void
+Bridge_resetStatistics(Bridge *const bridge)
+{
+	assert(bridge != NULL);
+
+	const uint32_t primask = Nvic_saveAndDisableIrq();
+	(void)memset(&bridge->statistics, 0, sizeof(Bridge_Statistics));
+	bridge->statistics.stageHighWatermark = bridge->stageCount;
+	Nvic_restoreIrq(primask);
+}
@@ -0,0 +1,187 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file Bridge.h
+/// \addtogroup Bsp
+/// \brief Header containing interface for the Mcan-to-Uart frame bridge.
+/// \details Frames pulled from an Mcan Rx FIFO are decoded in place into a StructFifo stage,
+///          which absorbs bursts, then framed into one of two transmission blocks and sent with
+///          ::Uart_writeAsync (or ::Uart_writeAsyncDma). While one block is transmitted, the
+///          other one is filled; a filled block is handed to the Uart from
+///          ::UartTxEndCallback, so the transmission continues without waiting for
+///          ::Bridge_process. Each frame is encoded as (multi-byte fields big-endian):
+///          - sync byte ::BRIDGE_FRAME_SYNC,
+///          - 32-bit CAN Id, with ::BRIDGE_FRAME_ID_EXTENDED_MASK set for Extended Ids,
+///          - flags byte (BRIDGE_FRAME_FLAG_* masks),
+///          - payload size byte,
+///          - 16-bit Mcan timestamp,
+///          - payload,
+///          - CRC-16/CCITT-FALSE of all the preceding bytes except the sync byte.
+
+#ifndef BSP_BRIDGE_H
+#define BSP_BRIDGE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Mcan/Mcan.h>
+#include <Uart/Uart.h>
+#include <Utils/ByteBuffer.h>
+#include <Utils/ByteFifo.h>
+#include <Utils/StructFifo.h>
+
+/// @addtogroup Bridge
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Byte starting each encoded frame.
+#define BRIDGE_FRAME_SYNC 0xA5u
+
+/// \brief Encoded CAN Id bit marking an Extended Id.
+#define BRIDGE_FRAME_ID_EXTENDED_MASK 0x80000000u
+
+/// \brief Flags byte bit set for remote frames.
+#define BRIDGE_FRAME_FLAG_REMOTE_MASK 0x01u
+/// \brief Flags byte bit set for frames in CAN FD format.
+#define BRIDGE_FRAME_FLAG_CAN_FD_MASK 0x02u
+/// \brief Flags byte bit set for frames sent with bit rate switching.
+#define BRIDGE_FRAME_FLAG_BIT_RATE_SWITCH_MASK 0x04u
+/// \brief Flags byte bit set for frames with recessive ESI flag.
+#define BRIDGE_FRAME_FLAG_ESI_MASK 0x08u
+
+/// \brief Number of bytes of an encoded frame preceding the payload.
+#define BRIDGE_FRAME_HEADER_SIZE 9u
+
+/// \brief Number of bytes of the encoded frame checksum.
+#define BRIDGE_FRAME_CRC_SIZE 2u
+
+/// \brief Maximum size of an encoded frame, the minimum transmission block size.
+#define BRIDGE_FRAME_ENCODED_SIZE_MAX                                          \
+	(BRIDGE_FRAME_HEADER_SIZE + MCAN_FRAME_DATA_SIZE_MAX                   \
+			+ BRIDGE_FRAME_CRC_SIZE)
+
+/// \brief Number of transmission blocks.
+#define BRIDGE_TX_BLOCK_COUNT 2u
+
+/// \brief Frame held in the bridge stage.
+/// \details The element data pointer refers to the payload of the same stage slot, so frames
+///          are accessed in place and never copied between stage slots.
+typedef struct {
+	Mcan_RxElement element; ///< Decoded Rx element.
+	uint8_t data[MCAN_FRAME_DATA_SIZE_MAX]; ///< Frame payload.
+} Bridge_Frame;
+
+/// \brief Bridge configuration descriptor.
+typedef struct {
+	Mcan *mcan; ///< Source Mcan device, with the Rx FIFO configured.
+	Mcan_RxFifoId rxFifoId; ///< Source Rx FIFO.
+	Uart *uart; ///< Destination Uart device.
+	/// \brief Stage queue, holding ::Bridge_Frame elements.
+	StructFifo *stage;
+	/// \brief Transmission blocks, of txBlockSize bytes each. With isDmaEnabled set, they
+	///        shall be declared with ::MPU_DMA_NOCACHE.
+	uint8_t *txBlocks[BRIDGE_TX_BLOCK_COUNT];
+	/// \brief Size of a transmission block, at least ::BRIDGE_FRAME_ENCODED_SIZE_MAX.
+	size_t txBlockSize;
+	/// \brief Transmission uses ::Uart_writeAsyncDma, requires prior ::Uart_setDmaConfig.
+	bool isDmaEnabled;
+} Bridge_Config;
+
+/// \brief Bridge throughput counters.
+typedef struct {
+	uint32_t rxFrames; ///< Frames pulled from the Mcan Rx FIFO.
+	uint32_t stageFullCount; ///< Pulls postponed, because the stage was full.
+	uint32_t encodedFrames; ///< Frames encoded into transmission blocks.
+	uint32_t encodedBytes; ///< Bytes encoded into transmission blocks.
+	uint32_t txBytes; ///< Bytes of finished transmission blocks.
+	uint32_t txSwaps; ///< Blocks handed to the Uart from the end-of-transmission callback.
+	uint32_t txStarts; ///< Blocks handed to the Uart by ::Bridge_process, while it was idle.
+	uint16_t stageHighWatermark; ///< Maximum observed number of frames in the stage.
+} Bridge_Statistics;
+
+/// \brief Bridge descriptor.
+typedef struct {
+	Bridge_Config config; ///< Bridge configuration.
+	ByteBuffer encoder; ///< Buffer encoding frames into the filled block.
+	ByteFifo txFifos[BRIDGE_TX_BLOCK_COUNT]; ///< Queues attached to the filled blocks.
+	uint16_t stageCount; ///< Number of frames in the stage.
+	uint8_t fillIndex; ///< Index of the block being filled.
+	size_t txLength; ///< Number of bytes of the transmitted block.
+	/// \brief The filled block waits for the end of the current transmission.
+	volatile bool isFillPublished;
+	volatile bool isTxActive; ///< The Uart transmits one of the blocks.
+	Bridge_Statistics statistics; ///< Throughput counters.
+} Bridge;
+
+/// \brief Initializes the bridge.
+/// \details The stage is cleared. The Mcan and Uart devices shall be configured by the caller.
+/// \param [out] bridge Bridge descriptor.
+/// \param [in] config Bridge configuration descriptor.
+void Bridge_init(Bridge *const bridge, const Bridge_Config *const config);
+
+/// \brief Moves the frames through the pipeline.
+/// \details Pulls frames from the Mcan Rx FIFO into the stage while it has room, encodes the
+///          staged frames into the filled block while it has room, then hands the block to the
+///          Uart: directly when it is idle, otherwise through the end-of-transmission callback.
+///          Frames stay in the stage while both blocks are in use. Shall be called periodically
+///          or on frame reception (e.g. from a ::Scheduler task), from a single context with a
+///          priority lower than the Uart interrupt.
+/// \param [in,out] bridge Bridge descriptor.
+void Bridge_process(Bridge *const bridge);
+
+/// \brief Checks whether all frames pulled so far were transmitted.
+/// \param [in] bridge Bridge descriptor.
+/// \retval true The stage and both blocks are empty and the Uart is idle.
+/// \retval false Otherwise.
+bool Bridge_isIdle(const Bridge *const bridge);
+
+/// \brief Encodes a frame in the bridge format.
+/// \param [in] element Rx element to be encoded.
+/// \param [out] buffer Buffer to append the encoded frame to.
+/// \retval true The frame was appended.
+/// \retval false There is not enough free space, buffer is left unchanged.
+bool Bridge_encodeFrame(const Mcan_RxElement *const element,
+		ByteBuffer *const buffer);
+
+/// \brief Retrieves bridge throughput counters.
+/// \param [in] bridge Bridge descriptor.
+/// \param [out] statistics Bridge throughput counters.
+void Bridge_getStatistics(
+		const Bridge *const bridge, Bridge_Statistics *const statistics);
+
+/// \brief Resets bridge throughput counters.
+/// \param [in,out] bridge Bridge descriptor.
+void Bridge_resetStatistics(Bridge *const bridge);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_BRIDGE_H
@@ -0,0 +1,109 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Delay.h"
+
+#include <stddef.h>
+
+#include <Dwt/Dwt.h>
+
+#define DELAY_MICROSECONDS_PER_SECOND 1000000u
+#define DELAY_NANOSECONDS_PER_SECOND 1000000000u
+
+static uint32_t coreClockFrequency = DELAY_DEFAULT_CORE_CLOCK_FREQUENCY;
+static const Pmc *trackedPmc;
+static uint32_t trackedMainckFrequency;
+
+void
+Delay_setCoreClockFrequency(const uint32_t frequency)
+{
+	trackedPmc = NULL;
+	coreClockFrequency = frequency;
+}
+
+void
+Delay_trackPmc(const Pmc *const pmc, const uint32_t mainckFrequency)
+{
+	trackedMainckFrequency = mainckFrequency;
+	trackedPmc = pmc;
+}
+
+uint32_t
+Delay_getCoreClockFrequency(void)
+{
+	if (trackedPmc != NULL) {
+		const uint32_t frequency = Pmc_getProcessorClockFrequency(
+				trackedPmc, trackedMainckFrequency);
+		if (frequency != 0u)
+			coreClockFrequency = frequency;
+	}
+
+	return coreClockFrequency;
+}
+
+static inline void
+waitUntil(const uint32_t start, const uint32_t cycles)
+{
+	while ((Dwt_getCycleCount() - start) < cycles)
+		asm volatile("" ::: "memory");
+}
+
+static inline uint32_t
+startDelay(void)
+{
+	if (!Dwt_isCycleCounterEnabled())
+		Dwt_enableCycleCounter();
+
+	return Dwt_getCycleCount();
+}
+
+static inline uint32_t
+toCycles(const uint32_t value, const uint32_t unitsPerSecond)
+{
+	const uint64_t cycles = (((uint64_t)value * Delay_getCoreClockFrequency())
+						+ (unitsPerSecond - 1u))
+			/ unitsPerSecond;
+
+	return (cycles > UINT32_MAX) ? UINT32_MAX : (uint32_t)cycles;
+}
+
+void
+Delay_cycles(const uint32_t cycles)
+{
+	const uint32_t start = startDelay();
+	waitUntil(start, cycles);
+}
+
+void
+Delay_us(const uint32_t us)
+{
+	const uint32_t start = startDelay();
+	waitUntil(start, toCycles(us, DELAY_MICROSECONDS_PER_SECOND));
+}
+
+void
+Delay_ns(const uint32_t ns)
+{
+	const uint32_t start = startDelay();
+	waitUntil(start, toCycles(ns, DELAY_NANOSECONDS_PER_SECOND));
+}
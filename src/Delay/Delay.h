@@ -0,0 +1,87 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file Delay.h
+/// \addtogroup Bsp
+/// \brief Header containing interface for calibrated busy-wait delays, measured with the DWT
+///        cycle counter.
+
+#ifndef BSP_DELAY_H
+#define BSP_DELAY_H
+
+#include <stdint.h>
+
+#include <Pmc/Pmc.h>
+
+/// @addtogroup Delay
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef DELAY_DEFAULT_CORE_CLOCK_FREQUENCY
+/// \brief Core clock frequency in [Hz] assumed until ::Delay_setCoreClockFrequency or
+///        ::Delay_trackPmc is called, matching SystemConfig_DefaultCoreClock.
+#define DELAY_DEFAULT_CORE_CLOCK_FREQUENCY 150000000u
+#endif
+
+/// \brief Sets a fixed core clock frequency used to convert delays to cycles.
+/// \param [in] frequency Core clock frequency in [Hz].
+void Delay_setCoreClockFrequency(const uint32_t frequency);
+
+/// \brief Makes delays follow the live PMC configuration, so that they remain correct across
+///        runtime clock changes, e.g. with ::Pmc_setConfig.
+/// \details The processor clock frequency is computed from the PMC registers at the start of
+///          each delay; the computation time is included in the delay.
+/// \param [in] pmc PMC instance pointer, must stay valid as long as delays are used.
+/// \param [in] mainckFrequency Main clock frequency in [Hz], e.g. of the crystal in use.
+void Delay_trackPmc(const Pmc *const pmc, const uint32_t mainckFrequency);
+
+/// \brief Returns the core clock frequency delays are currently converted with.
+/// \returns Core clock frequency in [Hz].
+uint32_t Delay_getCoreClockFrequency(void);
+
+/// \brief Busy-waits for at least the given number of core clock cycles.
+/// \details Enables the cycle counter if needed. Interrupts taken during the delay are
+///          included in it.
+/// \param [in] cycles Number of cycles.
+void Delay_cycles(const uint32_t cycles);
+
+/// \brief Busy-waits for at least the given time.
+/// \param [in] us Delay in [us].
+void Delay_us(const uint32_t us);
+
+/// \brief Busy-waits for at least the given time, rounded up to whole core clock cycles.
+/// \details Call overhead of a few tens of cycles bounds the shortest achievable delay.
+/// \param [in] ns Delay in [ns].
+void Delay_ns(const uint32_t ns);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_DELAY_H
@@ -0,0 +1,212 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file Dwt.h
+/// \addtogroup Bsp
+/// \brief Header containing interface for the DWT (Data Watchpoint and Trace) cycle counter.
+
+#ifndef BSP_DWT_H
+#define BSP_DWT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <Utils/Utils.h>
+
+#include "DwtRegisters.h"
+
+/// @addtogroup Dwt
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Checks whether the cycle counter is implemented.
+/// \details Trace has to be enabled for the DWT registers to be readable.
+/// \retval true Cycle counter is implemented.
+/// \retval false Cycle counter is not implemented.
+static inline bool
+Dwt_isCycleCounterPresent(void)
+{
+	// cppcheck-suppress misra-c2012-11.4
+	volatile Dwt_Registers *const dwt =
+			(volatile Dwt_Registers *)DWT_REGISTERS_ADDRESS_BASE;
+	return (dwt->ctrl & DWT_CTRL_NOCYCCNT_MASK) == 0u;
+}
+
+/// \brief Enables trace and starts the cycle counter, counting core clock cycles.
+/// \details The counter keeps its value, it wraps around every 2^32 cycles.
+static inline void
+Dwt_enableCycleCounter(void)
+{
+	// cppcheck-suppress misra-c2012-11.4
+	volatile uint32_t *const demcr =
+			(volatile uint32_t *)DWT_DEMCR_REGISTER_ADDRESS;
+	// cppcheck-suppress misra-c2012-11.4
+	volatile Dwt_Registers *const dwt =
+			(volatile Dwt_Registers *)DWT_REGISTERS_ADDRESS_BASE;
+
+	*demcr = *demcr | DWT_DEMCR_TRCENA_MASK;
+	dwt->lar = DWT_LAR_KEY;
+	dwt->ctrl = dwt->ctrl | DWT_CTRL_CYCCNTENA_MASK;
+}
+
+/// \brief Stops the cycle counter.
+static inline void
+Dwt_disableCycleCounter(void)
+{
+	// cppcheck-suppress misra-c2012-11.4
+	volatile Dwt_Registers *const dwt =
+			(volatile Dwt_Registers *)DWT_REGISTERS_ADDRESS_BASE;
+	dwt->ctrl = dwt->ctrl & ~DWT_CTRL_CYCCNTENA_MASK;
+}
+
+/// \brief Checks whether the cycle counter is running.
+/// \retval true Cycle counter is enabled.
+/// \retval false Cycle counter is disabled.
+static inline bool
+Dwt_isCycleCounterEnabled(void)
+{
+	// cppcheck-suppress misra-c2012-11.4
+	volatile Dwt_Registers *const dwt =
+			(volatile Dwt_Registers *)DWT_REGISTERS_ADDRESS_BASE;
+	return (dwt->ctrl & DWT_CTRL_CYCCNTENA_MASK) != 0u;
+}
+
+/// \brief Returns the current cycle counter value. Differences of two values are valid across
+///        a single wrap around.
+/// \returns Cycle counter value.
+static inline uint32_t
+Dwt_getCycleCount(void)
+{
+	// cppcheck-suppress misra-c2012-11.4
+	return ((volatile Dwt_Registers *)DWT_REGISTERS_ADDRESS_BASE)->cyccnt;
+}
+
+/// \brief Sets the cycle counter value.
+/// \param [in] value New cycle counter value.
+static inline void
+Dwt_setCycleCount(const uint32_t value)
+{
+	// cppcheck-suppress misra-c2012-11.4
+	((volatile Dwt_Registers *)DWT_REGISTERS_ADDRESS_BASE)->cyccnt = value;
+}
+
+/// \brief Number of microseconds in a second.
+#define DWT_MICROSECONDS_PER_SECOND 1000000u
+
+/// \brief Structure representing a deadline measured with the cycle counter.
+typedef struct {
+	uint32_t start; ///< Cycle counter value when the deadline was started.
+	uint32_t cycles; ///< Number of cycles after which the deadline expires.
+} Dwt_Deadline;
+
+/// \brief Starts a deadline expiring after the given time. The cycle counter shall be enabled.
+/// \details The duration is rounded up to whole cycles and saturated at 2^32 - 1 cycles, e.g.
+///          about 14 s at 300 MHz. The deadline is valid only as long as the core clock is not
+///          changed.
+/// \param [out] deadline Deadline.
+/// \param [in] timeoutUs Time to the deadline in [us].
+/// \param [in] coreClockFrequency Core clock frequency in [Hz].
+static inline void
+Dwt_startDeadline(Dwt_Deadline *const deadline, const uint32_t timeoutUs,
+		const uint32_t coreClockFrequency)
+{
+	const uint64_t cycles = (((uint64_t)timeoutUs * coreClockFrequency)
+						+ (DWT_MICROSECONDS_PER_SECOND - 1u))
+			/ DWT_MICROSECONDS_PER_SECOND;
+
+	deadline->start = Dwt_getCycleCount();
+	deadline->cycles = (cycles > UINT32_MAX) ? UINT32_MAX : (uint32_t)cycles;
+}
+
+/// \brief Checks whether a deadline has expired.
+/// \param [in] deadline Deadline.
+/// \retval true Deadline has expired.
+/// \retval false Deadline has not expired yet.
+static inline bool
+Dwt_hasDeadlineExpired(const Dwt_Deadline *const deadline)
+{
+	return (Dwt_getCycleCount() - deadline->start) >= deadline->cycles;
+}
+
+/// \brief Continuously compares a register against a mask until a match or until
+///        the deadline expires.
+/// \param [in] address Register's address.
+/// \param [in] mask Mask the the register is compared against.
+/// \param [in] deadline Deadline.
+/// \returns Whether the mask matched before the deadline expired.
+static inline bool
+Dwt_waitForRegister(const volatile uint32_t *const address, const uint32_t mask,
+		const Dwt_Deadline *const deadline)
+{
+	do {
+		if ((*address & mask) != 0u)
+			return true;
+	} while (!Dwt_hasDeadlineExpired(deadline));
+	return (*address & mask) != 0u;
+}
+
+/// \brief Continuously compares a register against a mask until it clears or until
+///        the deadline expires.
+/// \param [in] address Register's address.
+/// \param [in] mask Mask the the register is compared against.
+/// \param [in] deadline Deadline.
+/// \returns Whether the register cleared before the deadline expired.
+static inline bool
+Dwt_waitForRegisterClear(const volatile uint32_t *const address,
+		const uint32_t mask, const Dwt_Deadline *const deadline)
+{
+	do {
+		if ((*address & mask) == 0u)
+			return true;
+	} while (!Dwt_hasDeadlineExpired(deadline));
+	return (*address & mask) == 0u;
+}
+
+/// \brief Continuously evaluates a boolean lambda until either the evaluation yields true or
+///        the deadline expires.
+/// \param [in] lambda Lambda to be evaluated.
+/// \param [in] arg Argument for lambda.
+/// \param [in] deadline Deadline.
+/// \returns Whether the lambda evaluated to true before the deadline expired.
+static inline bool
+Dwt_evaluateArgLambda(const BooleanArgLambda lambda, void *const arg,
+		const Dwt_Deadline *const deadline)
+{
+	do {
+		if (lambda(arg)) // cppcheck-suppress [misra-c2012-14.4]
+			return true;
+	} while (!Dwt_hasDeadlineExpired(deadline));
+	return lambda(arg);
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_DWT_H
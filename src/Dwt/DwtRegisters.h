@@ -0,0 +1,71 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file DwtRegisters.h
+/// \addtogroup Bsp
+/// \brief Header containing Data Watchpoint and Trace unit specific register definitions.
+
+#ifndef BSP_DWT_REGISTERS_H
+#define BSP_DWT_REGISTERS_H
+
+#include <stdint.h>
+
+/// \brief Structure describing Data Watchpoint and Trace registers.
+typedef struct {
+	uint32_t ctrl; ///< 0xE0001000 Control Register
+	uint32_t cyccnt; ///< 0xE0001004 Cycle Count Register
+	uint32_t cpicnt; ///< 0xE0001008 CPI Count Register
+	uint32_t exccnt; ///< 0xE000100C Exception Overhead Count Register
+	uint32_t sleepcnt; ///< 0xE0001010 Sleep Count Register
+	uint32_t lsucnt; ///< 0xE0001014 LSU Count Register
+	uint32_t foldcnt; ///< 0xE0001018 Folded-instruction Count Register
+	uint32_t pcsr; ///< 0xE000101C Program Counter Sample Register
+	uint32_t reserved1[996]; ///< 0xE0001020 - 0xE0001FAC Comparators and Reserved
+	uint32_t lar; ///< 0xE0001FB0 Lock Access Register
+	uint32_t lsr; ///< 0xE0001FB4 Lock Status Register
+} Dwt_Registers;
+
+/// \brief DWT registers base address.
+#define DWT_REGISTERS_ADDRESS_BASE 0xE0001000u
+
+/// \brief Debug Exception and Monitor Control register address.
+#define DWT_DEMCR_REGISTER_ADDRESS 0xE000EDFCu
+
+/// \brief Debug Exception and Monitor Control register trace enable offset.
+#define DWT_DEMCR_TRCENA_OFFSET 24u
+/// \brief Debug Exception and Monitor Control register trace enable mask.
+#define DWT_DEMCR_TRCENA_MASK 0x01000000u
+
+/// \brief Control register cycle counter enable offset.
+#define DWT_CTRL_CYCCNTENA_OFFSET 0u
+/// \brief Control register cycle counter enable mask.
+#define DWT_CTRL_CYCCNTENA_MASK 0x00000001u
+/// \brief Control register no cycle counter offset.
+#define DWT_CTRL_NOCYCCNT_OFFSET 25u
+/// \brief Control register no cycle counter mask.
+#define DWT_CTRL_NOCYCCNT_MASK 0x02000000u
+
+/// \brief Lock Access register unlock key.
+#define DWT_LAR_KEY 0xC5ACCE55u
+
+#endif // BSP_DWT_REGISTERS_H
@@ -0,0 +1,70 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file ItmRegisters.h
+/// \addtogroup Bsp
+/// \brief Header containing Instrumentation Trace Macrocell specific register definitions.
+
+#ifndef BSP_ITM_REGISTERS_H
+#define BSP_ITM_REGISTERS_H
+
+#include <stdint.h>
+
+/// \brief Number of ITM stimulus ports.
+#define ITM_STIMULUS_PORT_COUNT 32u
+
+/// \brief Structure describing Instrumentation Trace Macrocell registers.
+typedef struct {
+	uint32_t stim[ITM_STIMULUS_PORT_COUNT]; ///< 0xE0000000 Stimulus Port Registers
+	uint32_t reserved1[864]; ///< 0xE0000080 - 0xE0000DFC Reserved
+	uint32_t ter; ///< 0xE0000E00 Trace Enable Register
+	uint32_t reserved2[15]; ///< 0xE0000E04 - 0xE0000E3C Reserved
+	uint32_t tpr; ///< 0xE0000E40 Trace Privilege Register
+	uint32_t reserved3[15]; ///< 0xE0000E44 - 0xE0000E7C Reserved
+	uint32_t tcr; ///< 0xE0000E80 Trace Control Register
+	uint32_t reserved4[75]; ///< 0xE0000E84 - 0xE0000FAC Reserved
+	uint32_t lar; ///< 0xE0000FB0 Lock Access Register
+	uint32_t lsr; ///< 0xE0000FB4 Lock Status Register
+} Itm_Registers;
+
+/// \brief ITM registers base address.
+#define ITM_REGISTERS_ADDRESS_BASE 0xE0000000u
+
+/// \brief Stimulus port register FIFO ready offset.
+#define ITM_STIM_FIFOREADY_OFFSET 0u
+/// \brief Stimulus port register FIFO ready mask.
+#define ITM_STIM_FIFOREADY_MASK 0x00000001u
+
+/// \brief Trace control register ITM enable offset.
+#define ITM_TCR_ITMENA_OFFSET 0u
+/// \brief Trace control register ITM enable mask.
+#define ITM_TCR_ITMENA_MASK 0x00000001u
+/// \brief Trace control register trace bus identifier offset.
+#define ITM_TCR_TRACEBUSID_OFFSET 16u
+/// \brief Trace control register trace bus identifier mask.
+#define ITM_TCR_TRACEBUSID_MASK 0x007F0000u
+
+/// \brief Lock Access register unlock key.
+#define ITM_LAR_KEY 0xC5ACCE55u
+
+#endif // BSP_ITM_REGISTERS_H
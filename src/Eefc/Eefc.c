@@ -0,0 +1,106 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Eefc.h"
+
+#include <assert.h>
+
+#include <Utils/Bits.h>
+
+#if defined(N7S_TARGET_SAMV71Q21)
+
+/// \brief Highest master clock frequency in [Hz] allowed for each number of wait states.
+static const uint32_t Eefc_maxFrequencies[EEFC_MAX_WAIT_STATES] = {
+	23000000u,
+	46000000u,
+	69000000u,
+	92000000u,
+	115000000u,
+	138000000u,
+};
+
+// cppcheck-suppress misra-c2012-11.4
+static volatile Eefc_Registers *const Eefc_registers =
+		(volatile Eefc_Registers *)EEFC_BASE_ADDRESS;
+
+uint32_t
+Eefc_getMinimumWaitStates(const uint32_t masterckFrequency)
+{
+	for (uint32_t i = 0u; i < EEFC_MAX_WAIT_STATES; i++) {
+		if (masterckFrequency <= Eefc_maxFrequencies[i])
+			return i;
+	}
+
+	return EEFC_MAX_WAIT_STATES;
+}
+
+void
+Eefc_setWaitStates(const uint32_t waitStates)
+{
+	assert(waitStates <= EEFC_MAX_WAIT_STATES);
+
+	uint32_t fmr = Eefc_registers->fmr;
+	fmr &= ~EEFC_FMR_FWS_MASK;
+	fmr |= BIT_FIELD_VALUE(EEFC_FMR_FWS, waitStates);
+	Eefc_registers->fmr = fmr;
+}
+
+uint32_t
+Eefc_getWaitStates(void)
+{
+	return (Eefc_registers->fmr & EEFC_FMR_FWS_MASK) >> EEFC_FMR_FWS_OFFSET;
+}
+
+void
+Eefc_setWaitStatesForFrequency(const uint32_t masterckFrequency)
+{
+	Eefc_setWaitStates(Eefc_getMinimumWaitStates(masterckFrequency));
+}
+
+static uint32_t
+executeCommand(const uint32_t command, const uint32_t argument)
+{
+	Eefc_registers->fcr =
+			BIT_FIELD_VALUE(EEFC_FCR_FKEY, EEFC_FCR_FKEY_PASSWD)
+			| BIT_FIELD_VALUE(EEFC_FCR_FARG, argument)
+			| BIT_FIELD_VALUE(EEFC_FCR_FCMD, command);
+	while ((Eefc_registers->fsr & EEFC_FSR_FRDY_MASK) == 0u)
+		;
+	return Eefc_registers->frr;
+}
+
+uint32_t
+Eefc_getGpnvmBits(void)
+{
+	return executeCommand(EEFC_FCMD_GGPB, 0u);
+}
+
+void
+Eefc_setGpnvmBit(const uint32_t index, const bool value)
+{
+	assert(index < EEFC_GPNVM_BIT_COUNT);
+
+	(void)executeCommand(value ? EEFC_FCMD_SGPB : EEFC_FCMD_CGPB, index);
+}
+
+#endif
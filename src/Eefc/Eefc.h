@@ -0,0 +1,100 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file Eefc.h
+/// \addtogroup Bsp
+/// \brief Header for the Enhanced Embedded Flash Controller (EEFC) driver.
+
+#ifndef BSP_EEFC_H
+#define BSP_EEFC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "EefcRegisters.h"
+
+/// @addtogroup Eefc
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(N7S_TARGET_SAMV71Q21)
+
+/// \brief Largest number of flash wait states, valid for any master clock frequency.
+#define EEFC_MAX_WAIT_STATES 6u
+
+/// \brief Returns the smallest number of flash wait states legal at the given master clock
+///        frequency, as specified for VDDIO between 3.0 V and 3.6 V.
+/// \param [in] masterckFrequency Master clock frequency in [Hz].
+/// \returns Number of flash wait states.
+uint32_t Eefc_getMinimumWaitStates(const uint32_t masterckFrequency);
+
+/// \brief Sets the number of flash wait states.
+/// \details Other flash mode settings are preserved. The number of wait states shall be
+///          raised before the master clock frequency is increased and may be lowered only
+///          after it has been decreased.
+/// \param [in] waitStates Number of flash wait states, not larger than ::EEFC_MAX_WAIT_STATES.
+void Eefc_setWaitStates(const uint32_t waitStates);
+
+/// \brief Returns the currently configured number of flash wait states.
+/// \returns Number of flash wait states.
+uint32_t Eefc_getWaitStates(void);
+
+/// \brief Sets the smallest number of flash wait states legal at the given master clock
+///        frequency.
+/// \param [in] masterckFrequency Master clock frequency in [Hz].
+void Eefc_setWaitStatesForFrequency(const uint32_t masterckFrequency);
+
+/// \brief Number of GPNVM bits.
+#define EEFC_GPNVM_BIT_COUNT 9u
+
+/// \brief Index of the first GPNVM bit selecting the TCM configuration.
+#define EEFC_GPNVM_TCM_CONFIG_OFFSET 7u
+/// \brief Mask of the GPNVM bits selecting the TCM configuration.
+#define EEFC_GPNVM_TCM_CONFIG_MASK 0x00000180u
+
+/// \brief Returns the GPNVM bits.
+/// \details Shall not be called while another flash command is in progress.
+/// \returns GPNVM bits, bit N is set when GPNVM bit N is set.
+uint32_t Eefc_getGpnvmBits(void);
+
+/// \brief Sets or clears a GPNVM bit.
+/// \details The GPNVM bits are non-volatile and their number of write cycles is limited, so
+///          they shall be changed deliberately, not on every boot. Most of them take effect
+///          after the next reset.
+/// \param [in] index Index of the GPNVM bit, lower than ::EEFC_GPNVM_BIT_COUNT.
+/// \param [in] value Requested value of the bit.
+void Eefc_setGpnvmBit(const uint32_t index, const bool value);
+
+#endif
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_EEFC_H
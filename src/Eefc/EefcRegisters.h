@@ -0,0 +1,84 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file EefcRegisters.h
+/// \addtogroup Bsp
+/// \brief Header containing definitions of registers of Enhanced Embedded Flash Controller (EEFC).
+
+#ifndef BSP_EEFC_REGISTERS_H
+#define BSP_EEFC_REGISTERS_H
+
+#include <stdint.h>
+
+typedef struct {
+	uint32_t fmr; ///< 0x00 Flash Mode Register
+	uint32_t fcr; ///< 0x04 Flash Command Register
+	uint32_t fsr; ///< 0x08 Flash Status Register
+	uint32_t frr; ///< 0x0C Flash Result Register
+} Eefc_Registers;
+
+#if defined(BSP_HOST_REGISTERS)
+/// \brief In-memory EEFC register model, see HostRegisters/HostRegisters.h.
+extern Eefc_Registers HostRegisters_eefc;
+#endif
+
+// clang-format off
+
+#if defined(N7S_TARGET_SAMV71Q21)
+
+#if defined(BSP_HOST_REGISTERS)
+#define EEFC_BASE_ADDRESS       ((uintptr_t)&HostRegisters_eefc)
+#else
+#define EEFC_BASE_ADDRESS       0x400E0C00u
+#endif
+
+#endif
+
+#define EEFC_FMR_FRDY_MASK      0x00000001u
+#define EEFC_FMR_FRDY_OFFSET    0u
+#define EEFC_FMR_FWS_MASK       0x00000F00u
+#define EEFC_FMR_FWS_OFFSET     8u
+#define EEFC_FMR_SCOD_MASK      0x00010000u
+#define EEFC_FMR_SCOD_OFFSET    16u
+#define EEFC_FMR_CLOE_MASK      0x04000000u
+#define EEFC_FMR_CLOE_OFFSET    26u
+
+#define EEFC_FCR_FCMD_MASK      0x000000FFu
+#define EEFC_FCR_FCMD_OFFSET    0u
+#define EEFC_FCR_FARG_MASK      0x00FFFF00u
+#define EEFC_FCR_FARG_OFFSET    8u
+#define EEFC_FCR_FKEY_MASK      0xFF000000u
+#define EEFC_FCR_FKEY_OFFSET    24u
+
+#define EEFC_FCR_FKEY_PASSWD    0x5Au
+
+#define EEFC_FCMD_SGPB          0x0Bu
+#define EEFC_FCMD_CGPB          0x0Cu
+#define EEFC_FCMD_GGPB          0x0Du
+
+#define EEFC_FSR_FRDY_MASK      0x00000001u
+#define EEFC_FSR_FRDY_OFFSET    0u
+
+// clang-format on
+
+#endif // BSP_EEFC_REGISTERS_H
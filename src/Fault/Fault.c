@@ -0,0 +1,192 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Fault.h"
+
+#include <stddef.h>
+
+#include <Rstc/Rstc.h>
+#include <Scb/Scb.h>
+
+#define FAULT_RECORD_MAGIC 0x464C5452u
+
+#define BASIC_FRAME_WORD_COUNT 8u
+#define EXTENDED_FRAME_WORD_COUNT 26u
+#define EXC_RETURN_SPSEL_MASK 0x00000004u
+#define EXC_RETURN_FTYPE_MASK 0x00000010u
+#define XPSR_STACK_ALIGN_MASK 0x00000200u
+
+#define CFSR_STACKING_ERROR_MASK \
+	(SCB_CFSR_MSTKERR_MASK | SCB_CFSR_STKERR_MASK)
+
+void HardFault_Handler(void) __attribute__((alias("Fault_handler")));
+void MemManage_Handler(void) __attribute__((alias("Fault_handler")));
+void BusFault_Handler(void) __attribute__((alias("Fault_handler")));
+void UsageFault_Handler(void) __attribute__((alias("Fault_handler")));
+
+// Bounds of RAM holding the main and task stacks, see the linker script.
+extern uint32_t _srelocate;
+extern uint32_t _ram_end_;
+
+// Fault record kept in RAM not cleared by the startup code.
+typedef struct {
+	uint32_t magic;
+	Fault_Record record;
+	uint32_t checksum;
+} StoredRecord;
+
+static StoredRecord storedRecord __attribute__((section(".noinit")));
+
+static uint32_t
+calculateChecksum(const Fault_Record *const record)
+{
+	const uint32_t *const words = (const uint32_t *)record;
+	uint32_t checksum = FAULT_RECORD_MAGIC;
+	for (uint32_t i = 0u; i < (sizeof(Fault_Record) / sizeof(uint32_t)); ++i)
+		checksum = ((checksum << 1u) | (checksum >> 31u)) ^ words[i];
+
+	return checksum;
+}
+
+static bool
+isInRam(const uintptr_t address, const uint32_t size)
+{
+	const uintptr_t start = (uintptr_t)&_srelocate;
+	const uintptr_t end = (uintptr_t)&_ram_end_;
+
+	return (address >= start) && (address <= end)
+			&& ((end - address) >= (size - 1u));
+}
+
+static uint32_t
+getFrameWordCount(const uint32_t excReturn)
+{
+	return ((excReturn & EXC_RETURN_FTYPE_MASK) == 0u)
+			? EXTENDED_FRAME_WORD_COUNT
+			: BASIC_FRAME_WORD_COUNT;
+}
+
+static void
+captureStack(Fault_Record *const record, const uint32_t *const frame)
+{
+	const uint32_t frameWordCount = getFrameWordCount(record->excReturn);
+
+	record->frame.r0 = frame[0];
+	record->frame.r1 = frame[1];
+	record->frame.r2 = frame[2];
+	record->frame.r3 = frame[3];
+	record->frame.r12 = frame[4];
+	record->frame.lr = frame[5];
+	record->frame.pc = frame[6];
+	record->frame.xpsr = frame[7];
+	record->isFrameValid = true;
+
+	const uint32_t *stack = &frame[frameWordCount];
+	if ((record->frame.xpsr & XPSR_STACK_ALIGN_MASK) != 0u)
+		stack++;
+	record->stackPointer = (uint32_t)(uintptr_t)stack;
+
+	for (uint32_t i = 0u; i < FAULT_STACK_SNAPSHOT_WORD_COUNT; ++i) {
+		if (!isInRam((uintptr_t)&stack[i], sizeof(uint32_t)))
+			break;
+		record->stack[i] = stack[i];
+		record->stackWordCount++;
+	}
+}
+
+static void __attribute__((used, noreturn))
+captureFault(const uint32_t *const frame, const uint32_t excReturn)
+{
+	// cppcheck-suppress misra-c2012-11.4
+	volatile const Scb_Registers *const scb =
+			(volatile const Scb_Registers *)SCB_BASE_ADDRESS;
+	Fault_Record *const record = &storedRecord.record;
+
+	uint32_t ipsr;
+	asm volatile("mrs %0, ipsr" : "=r"(ipsr));
+
+	record->exceptionNumber = ipsr;
+	record->excReturn = excReturn;
+	record->stackPointer = (uint32_t)(uintptr_t)frame;
+	record->isFrameValid = false;
+	record->cfsr = scb->cfsr;
+	record->hfsr = scb->hfsr;
+	record->mmfar = scb->mmfar;
+	record->bfar = scb->bfar;
+	record->stackWordCount = 0u;
+	for (uint32_t i = 0u; i < FAULT_STACK_SNAPSHOT_WORD_COUNT; ++i)
+		record->stack[i] = 0u;
+
+	// A fault while reading the frame would escalate into a lockup, so it is
+	// only read if stacking succeeded and the frame is in RAM.
+	if (((record->cfsr & CFSR_STACKING_ERROR_MASK) == 0u)
+			&& isInRam((uintptr_t)frame,
+					getFrameWordCount(excReturn)
+							* sizeof(uint32_t)))
+		captureStack(record, frame);
+
+	storedRecord.magic = FAULT_RECORD_MAGIC;
+	storedRecord.checksum = calculateChecksum(record);
+
+	// The record has to reach SRAM before the reset discards the DCache.
+	(void)Scb_cleanDCacheByRange(&storedRecord, sizeof(storedRecord));
+	MEMORY_SYNC_BARRIER();
+	Rstc_resetSystem();
+
+	while (true)
+		asm volatile("nop" ::: "memory");
+}
+
+__attribute__((naked)) void
+Fault_handler(void)
+{
+	asm volatile("tst lr, %0\n"
+		     "ite eq\n"
+		     "mrseq r0, msp\n"
+		     "mrsne r0, psp\n"
+		     "mov r1, lr\n"
+		     "b captureFault\n"
+			:
+			: "i"(EXC_RETURN_SPSEL_MASK));
+}
+
+bool
+Fault_getLastRecord(Fault_Record *const record)
+{
+	if (Rstc_getLastResetType() != Rstc_ResetType_Software)
+		return false;
+
+	if ((storedRecord.magic != FAULT_RECORD_MAGIC)
+			|| (storedRecord.checksum
+					!= calculateChecksum(&storedRecord.record)))
+		return false;
+
+	*record = storedRecord.record;
+	return true;
+}
+
+void
+Fault_clearLastRecord(void)
+{
+	storedRecord.magic = 0u;
+}
@@ -0,0 +1,97 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file Fault.h
+/// \addtogroup Bsp
+/// \brief Header containing interface for the post-mortem fault capture.
+/// \details Linking this module replaces the default HardFault, MemManage, BusFault and
+///          UsageFault handlers. On a fault the stacked registers, fault status registers
+///          and a snapshot of the stack are saved in RAM not cleared by the startup code,
+///          after which the system is reset with ::Rstc_resetSystem. The record can be
+///          read back after the reset with ::Fault_getLastRecord.
+
+#ifndef BSP_FAULT_H
+#define BSP_FAULT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/// @addtogroup Fault
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Number of stack words saved above the exception frame.
+#ifndef FAULT_STACK_SNAPSHOT_WORD_COUNT
+#define FAULT_STACK_SNAPSHOT_WORD_COUNT 16u
+#endif
+
+/// \brief Structure holding registers stacked on the exception entry.
+typedef struct {
+	uint32_t r0; ///< Register R0.
+	uint32_t r1; ///< Register R1.
+	uint32_t r2; ///< Register R2.
+	uint32_t r3; ///< Register R3.
+	uint32_t r12; ///< Register R12.
+	uint32_t lr; ///< Link register.
+	uint32_t pc; ///< Address of the faulting instruction.
+	uint32_t xpsr; ///< Program status register.
+} Fault_StackFrame;
+
+/// \brief Structure holding a fault record.
+typedef struct {
+	uint32_t exceptionNumber; ///< Number of the fault exception, as in IPSR.
+	uint32_t excReturn; ///< EXC_RETURN value of the fault handler.
+	uint32_t stackPointer; ///< Stack pointer value before the exception entry.
+	bool isFrameValid; ///< Was the exception frame readable.
+	Fault_StackFrame frame; ///< Stacked registers, valid if isFrameValid is set.
+	uint32_t cfsr; ///< Configurable Fault Status Register.
+	uint32_t hfsr; ///< HardFault Status Register.
+	uint32_t mmfar; ///< MemManage Fault Address Register.
+	uint32_t bfar; ///< BusFault Address Register.
+	uint32_t stackWordCount; ///< Number of valid words in the stack snapshot.
+	uint32_t stack[FAULT_STACK_SNAPSHOT_WORD_COUNT]; ///< Stack snapshot above the frame.
+} Fault_Record;
+
+/// \brief Retrieves the fault record saved before the last reset.
+/// \details The record is only accepted after a software reset, with a valid checksum.
+/// \param [out] record Fault record.
+/// \returns Whether a fault record is available.
+bool Fault_getLastRecord(Fault_Record *const record);
+
+/// \brief Invalidates the saved fault record, e.g. after it was reported.
+void Fault_clearLastRecord(void);
+
+/// \brief Common fault handler, aliased by the fault exception handlers.
+void Fault_handler(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_FAULT_H
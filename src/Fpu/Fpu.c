@@ -144,6 +144,32 @@ Fpu_setConfig(Fpu *const fpu, const Fpu_Config *const config)
 	MEMORY_SYNC_BARRIER();
 }
 
+void
+Fpu_setStackingMode(Fpu *const fpu, const Fpu_StackingMode mode)
+{
+	const uint32_t modeMask = FPU_FPCCR_ASPEN_MASK | FPU_FPCCR_LSPEN_MASK;
+	const uint32_t invertedModeMask = ~modeMask;
+	fpu->registers->fpccr = (fpu->registers->fpccr & invertedModeMask)
+			| BIT_VALUE(FPU_FPCCR_ASPEN,
+					mode != Fpu_StackingMode_Disabled)
+			| BIT_VALUE(FPU_FPCCR_LSPEN,
+					mode == Fpu_StackingMode_Lazy);
+
+	/// Reset pipeline.
+	MEMORY_SYNC_BARRIER();
+}
+
+Fpu_StackingMode
+Fpu_getStackingMode(const Fpu *const fpu)
+{
+	const uint32_t fpccr = fpu->registers->fpccr;
+	if ((fpccr & FPU_FPCCR_ASPEN_MASK) == 0u)
+		return Fpu_StackingMode_Disabled;
+	if ((fpccr & FPU_FPCCR_LSPEN_MASK) == 0u)
+		return Fpu_StackingMode_Automatic;
+	return Fpu_StackingMode_Lazy;
+}
+
 void
 Fpu_getConfig(const Fpu *const fpu, Fpu_Config *const config)
 {
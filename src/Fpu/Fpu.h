@@ -83,6 +83,27 @@ typedef enum {
 	Fpu_CoprocessorAccessMode_Full = 3, ///< Full access.
 } Fpu_CoprocessorAccessMode;
 
+/// \brief FPU context stacking mode on exception entry.
+typedef enum {
+	/// \brief FPU context is not stacked; exception handlers must not use the FPU.
+	Fpu_StackingMode_Disabled = 0,
+	/// \brief FPU context is stacked on every exception entry from a context using the FPU.
+	Fpu_StackingMode_Automatic = 1,
+	/// \brief Space for the FPU context is reserved on exception entry, registers are stored
+	///        only when the handler executes a floating point instruction.
+	Fpu_StackingMode_Lazy = 2,
+} Fpu_StackingMode;
+
+#if defined(N7S_FPU_STACKING_DISABLED)
+#define FPU_BUILD_STACKING_MODE Fpu_StackingMode_Disabled
+#elif defined(N7S_FPU_STACKING_AUTOMATIC)
+#define FPU_BUILD_STACKING_MODE Fpu_StackingMode_Automatic
+#else
+/// \brief Stacking mode selected for the build with N7S_FPU_STACKING_DISABLED or
+///        N7S_FPU_STACKING_AUTOMATIC definitions, lazy stacking by default.
+#define FPU_BUILD_STACKING_MODE Fpu_StackingMode_Lazy
+#endif
+
 /// \brief Structure holding FPU configuration.
 typedef struct {
 	/// \brief Automatically preserve FPU context on exception.
@@ -191,6 +212,16 @@ void Fpu_setConfig(Fpu *const fpu, const Fpu_Config *const config);
 /// \param [out] config FPU configuration.
 void Fpu_getConfig(const Fpu *const fpu, Fpu_Config *const config);
 
+/// \brief Sets the FPU context stacking mode on exception entry.
+/// \param [in,out] fpu Pointer to a structure representing FPU.
+/// \param [in] mode Stacking mode, e.g. ::FPU_BUILD_STACKING_MODE.
+void Fpu_setStackingMode(Fpu *const fpu, const Fpu_StackingMode mode);
+
+/// \brief Gets the FPU context stacking mode on exception entry.
+/// \param [in] fpu Pointer to a structure representing FPU.
+/// \returns Stacking mode.
+Fpu_StackingMode Fpu_getStackingMode(const Fpu *const fpu);
+
 /// \brief Sets the FPU context configuration.
 /// \param [in] config FPU context configuration.
 void Fpu_setContextConfig(const Fpu_ContextConfig *const config);
@@ -0,0 +1,456 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "HostRegisters.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <Utils/Bits.h>
+#include <Utils/ByteFifo.h>
+
+_Static_assert(sizeof(void *) == sizeof(uint32_t),
+		"Register models require a 32-bit host build (e.g. -m32)");
+
+#define UART_COUNT 5u
+#define MCAN_COUNT 2u
+
+/// \brief Mask of the element word 1 fields shared by Tx and Rx elements (DLC, BRS, FDF).
+#define MCAN_ELEMENT_T1_TO_R1_MASK 0x003F0000u
+
+#if defined(N7S_TARGET_SAMV71Q21)
+#define PMC_SR_READY_MASK \
+	(PMC_SR_MOSCXTS_MASK | PMC_SR_LOCKA_MASK | PMC_SR_MCKRDY_MASK \
+			| PMC_SR_PCKRDY0_MASK | PMC_SR_PCKRDY1_MASK \
+			| PMC_SR_PCKRDY2_MASK | PMC_SR_PCKRDY3_MASK \
+			| PMC_SR_PCKRDY4_MASK | PMC_SR_PCKRDY5_MASK \
+			| PMC_SR_PCKRDY6_MASK | PMC_SR_MOSCSELS_MASK \
+			| PMC_SR_MOSCRCS_MASK)
+#elif defined(N7S_TARGET_SAMRH71F20) || defined(N7S_TARGET_SAMRH707F18)
+#define PMC_SR_READY_MASK \
+	(PMC_SR_MOSCXTS_MASK | PMC_SR_LOCKA_MASK | PMC_SR_LOCKB_MASK \
+			| PMC_SR_MCKRDY_MASK | PMC_SR_OSCSELS_MASK \
+			| PMC_SR_PCKRDY0_MASK | PMC_SR_PCKRDY1_MASK \
+			| PMC_SR_PCKRDY2_MASK | PMC_SR_PCKRDY3_MASK \
+			| PMC_SR_MOSCSELS_MASK | PMC_SR_MOSCRCS_MASK)
+#else
+#error "No target platform specified (missing N7S_TARGET_* macro)"
+#endif
+
+typedef struct {
+	ByteFifo rx;
+	ByteFifo tx;
+	uint8_t rxMemory[HOST_REGISTERS_UART_QUEUE_SIZE];
+	uint8_t txMemory[HOST_REGISTERS_UART_QUEUE_SIZE];
+} UartModel;
+
+typedef struct {
+	uint32_t rxFifo0Size;
+	uint32_t rxFifo0GetIndex;
+	uint32_t rxFifo0Count;
+	uint32_t txQueuePutIndex;
+	uint32_t raisedIr;
+} McanModel;
+
+Uart_Registers HostRegisters_uart[UART_COUNT];
+Mcan_BaseRegisters HostRegisters_mcan[MCAN_COUNT];
+uint32_t HostRegisters_mcanCanDmaBase[MCAN_COUNT];
+Eefc_Registers HostRegisters_eefc;
+Pmc_Registers HostRegisters_pmc;
+Scb_Registers HostRegisters_scb;
+
+uint32_t HostRegisters_mcanMessageRam[HOST_REGISTERS_MCAN_MESSAGE_RAM_SIZE
+		/ sizeof(uint32_t)]
+		__attribute__((aligned(HOST_REGISTERS_MCAN_MESSAGE_RAM_SIZE)));
+
+static UartModel uartModels[UART_COUNT];
+static McanModel mcanModels[MCAN_COUNT];
+
+static void
+resetUart(const Uart_Id id)
+{
+	UartModel *const model = &uartModels[id];
+
+	HostRegisters_uart[id] = (Uart_Registers){ 0 };
+	HostRegisters_uart[id].sr = UART_SR_TXRDY_MASK | UART_SR_TXEMPTY_MASK;
+	HostRegisters_uart[id].thr = HOST_REGISTERS_EMPTY;
+
+	ByteFifo_init(&model->rx, model->rxMemory, sizeof(model->rxMemory));
+	ByteFifo_init(&model->tx, model->txMemory, sizeof(model->txMemory));
+}
+
+static void
+resetMcan(const Mcan_Id id)
+{
+	(void)memset(&HostRegisters_mcan[id], 0, sizeof(Mcan_BaseRegisters));
+	HostRegisters_mcan[id].rxf0a = HOST_REGISTERS_EMPTY;
+	HostRegisters_mcanCanDmaBase[id] = 0u;
+	(void)memset(&mcanModels[id], 0, sizeof(McanModel));
+}
+
+void
+HostRegisters_reset(void)
+{
+	for (uint32_t i = 0u; i < UART_COUNT; i++)
+		resetUart((Uart_Id)i);
+	for (uint32_t i = 0u; i < MCAN_COUNT; i++)
+		resetMcan((Mcan_Id)i);
+
+	(void)memset(&HostRegisters_eefc, 0, sizeof(Eefc_Registers));
+	HostRegisters_eefc.fsr = EEFC_FSR_FRDY_MASK;
+
+	(void)memset(&HostRegisters_pmc, 0, sizeof(Pmc_Registers));
+	HostRegisters_pmc.sr = PMC_SR_READY_MASK;
+	HostRegisters_pmc.ckgrMcfr = CKGR_MCFR_MAINFRDY_MASK;
+
+	(void)memset(&HostRegisters_scb, 0, sizeof(Scb_Registers));
+	(void)memset(HostRegisters_mcanMessageRam, 0,
+			sizeof(HostRegisters_mcanMessageRam));
+}
+
+static void
+stepUart(const Uart_Id id)
+{
+	Uart_Registers *const reg = &HostRegisters_uart[id];
+	UartModel *const model = &uartModels[id];
+
+	if ((reg->cr & UART_CR_RSTSTA_MASK) != 0u)
+		reg->sr &= ~(UART_SR_OVRE_MASK | UART_SR_FRAME_MASK
+				| UART_SR_PARE_MASK);
+	reg->cr = 0u;
+
+	// Drivers disable interrupts before re-enabling them, so IDR is applied first.
+	reg->imr = (reg->imr & ~reg->idr) | reg->ier;
+	reg->ier = 0u;
+	reg->idr = 0u;
+
+	if (reg->thr != HOST_REGISTERS_EMPTY) {
+		(void)ByteFifo_push(&model->tx, (uint8_t)reg->thr);
+		reg->thr = HOST_REGISTERS_EMPTY;
+	}
+	reg->sr |= UART_SR_TXRDY_MASK | UART_SR_TXEMPTY_MASK;
+
+	uint8_t byte = 0u;
+	if (ByteFifo_pull(&model->rx, &byte)) {
+		reg->rhr = byte;
+		reg->sr |= UART_SR_RXRDY_MASK;
+	} else {
+		reg->sr &= ~UART_SR_RXRDY_MASK;
+	}
+}
+
+static uint32_t
+getElementDataSize(const uint32_t dataFieldSize)
+{
+	static const uint32_t sizes[] = { 8u, 12u, 16u, 20u, 24u, 32u, 48u, 64u };
+	return sizes[dataFieldSize & 0x7u];
+}
+
+static uint32_t *
+getMessageRamAddress(const Mcan_Id id, const uint32_t startAddress,
+		const uint32_t elementSize, const uint32_t index)
+{
+	const uint32_t address = (HostRegisters_mcanCanDmaBase[id]
+						 & MCAN_CHIPCFG_CANXDMABA_MASK)
+			+ startAddress + (elementSize * index);
+	// cppcheck-suppress misra-c2012-11.4
+	return (uint32_t *)address;
+}
+
+static bool
+storeRxFifo0Element(const Mcan_Id id, const uint32_t *const element,
+		const uint32_t wordCount)
+{
+	const Mcan_BaseRegisters *const reg = &HostRegisters_mcan[id];
+	McanModel *const model = &mcanModels[id];
+
+	if (model->rxFifo0Size == 0u)
+		return false;
+	if (model->rxFifo0Count == model->rxFifo0Size) {
+		model->raisedIr |= MCAN_IR_RF0L_MASK;
+		return false;
+	}
+
+	const uint32_t elementSize = (2u * sizeof(uint32_t))
+			+ getElementDataSize(GET_FIELD_VALUE(
+					MCAN_RXESC_F0DS, reg->rxesc));
+	const uint32_t putIndex = (model->rxFifo0GetIndex + model->rxFifo0Count)
+			% model->rxFifo0Size;
+	uint32_t *const destination = getMessageRamAddress(id,
+			reg->rxf0c & MCAN_RXF0C_F0SA_MASK, elementSize,
+			putIndex);
+
+	const uint32_t elementWords = elementSize / sizeof(uint32_t);
+	const uint32_t copiedWords =
+			(wordCount < elementWords) ? wordCount : elementWords;
+	(void)memset(destination, 0, elementSize);
+	(void)memcpy(destination, element, copiedWords * sizeof(uint32_t));
+
+	model->rxFifo0Count++;
+	model->raisedIr |= MCAN_IR_RF0N_MASK;
+	if (model->rxFifo0Count == model->rxFifo0Size)
+		model->raisedIr |= MCAN_IR_RF0F_MASK;
+
+	return true;
+}
+
+static void
+acknowledgeRxFifo0(const Mcan_Id id)
+{
+	Mcan_BaseRegisters *const reg = &HostRegisters_mcan[id];
+	McanModel *const model = &mcanModels[id];
+
+	const uint32_t rxf0a = reg->rxf0a;
+	reg->rxf0a = HOST_REGISTERS_EMPTY;
+	if ((rxf0a == HOST_REGISTERS_EMPTY) || (model->rxFifo0Count == 0u))
+		return;
+
+	const uint32_t index = GET_FIELD_VALUE(MCAN_RXF0A_F0AI, rxf0a);
+	if (index >= model->rxFifo0Size)
+		return;
+
+	const uint32_t released = ((index + model->rxFifo0Size
+						   - model->rxFifo0GetIndex)
+						  % model->rxFifo0Size)
+			+ 1u;
+	if (released > model->rxFifo0Count)
+		return;
+
+	model->rxFifo0Count -= released;
+	model->rxFifo0GetIndex = (index + 1u) % model->rxFifo0Size;
+}
+
+static void
+transmitRequests(const Mcan_Id id)
+{
+	Mcan_BaseRegisters *const reg = &HostRegisters_mcan[id];
+	McanModel *const model = &mcanModels[id];
+
+	const uint32_t requests = reg->txbar;
+	reg->txbar = 0u;
+	if (requests == 0u)
+		return;
+
+	const uint32_t txbc = reg->txbc;
+	const uint32_t bufferCount = GET_FIELD_VALUE(MCAN_TXBC_NDTB, txbc);
+	const uint32_t elementSize = (2u * sizeof(uint32_t))
+			+ getElementDataSize(GET_FIELD_VALUE(
+					MCAN_TXESC_TBDS, reg->txesc));
+	uint32_t queuedCount = 0u;
+
+	for (uint32_t i = 0u; i < 32u; i++) {
+		const uint32_t mask = UINT32_C(1) << i;
+		if ((requests & mask) == 0u)
+			continue;
+
+		const uint32_t *const source = getMessageRamAddress(id,
+				txbc & MCAN_TXBC_TBSA_MASK, elementSize, i);
+		uint32_t element[(2u * sizeof(uint32_t) + 64u)
+				/ sizeof(uint32_t)];
+		(void)memcpy(element, source, elementSize);
+		element[1] &= MCAN_ELEMENT_T1_TO_R1_MASK;
+		(void)storeRxFifo0Element(
+				id, element, elementSize / sizeof(uint32_t));
+
+		reg->txbto |= mask;
+		if ((reg->txbtie & mask) != 0u)
+			model->raisedIr |= MCAN_IR_TC_MASK;
+		if (i >= bufferCount)
+			queuedCount++;
+	}
+
+	if (GET_FIELD_VALUE(MCAN_TXBC_TFQM, txbc)
+			== (uint32_t)Mcan_TxQueueType_Fifo)
+		model->txQueuePutIndex += queuedCount;
+}
+
+static void
+updateMcanStatus(const Mcan_Id id)
+{
+	Mcan_BaseRegisters *const reg = &HostRegisters_mcan[id];
+	McanModel *const model = &mcanModels[id];
+
+	const uint32_t txbc = reg->txbc;
+	const uint32_t bufferCount = GET_FIELD_VALUE(MCAN_TXBC_NDTB, txbc);
+	const uint32_t queueSize = GET_FIELD_VALUE(MCAN_TXBC_TFQS, txbc);
+	if (queueSize == 0u) {
+		reg->txfqs = 0u;
+	} else {
+		if ((GET_FIELD_VALUE(MCAN_TXBC_TFQM, txbc)
+				    != (uint32_t)Mcan_TxQueueType_Fifo)
+				|| (model->txQueuePutIndex < bufferCount))
+			model->txQueuePutIndex = bufferCount;
+		model->txQueuePutIndex = bufferCount
+				+ ((model->txQueuePutIndex - bufferCount)
+						% queueSize);
+
+		// Transmission is instant, so the whole queue is free after a step.
+		// TFFL is only maintained in Tx FIFO mode.
+		const uint32_t freeLevel = (GET_FIELD_VALUE(MCAN_TXBC_TFQM, txbc)
+						   == (uint32_t)Mcan_TxQueueType_Fifo)
+				? queueSize
+				: 0u;
+		reg->txfqs = BIT_FIELD_VALUE(MCAN_TXFQS_TFFL, freeLevel)
+				| BIT_FIELD_VALUE(MCAN_TXFQS_TFGI,
+						model->txQueuePutIndex)
+				| BIT_FIELD_VALUE(MCAN_TXFQS_TFQPI,
+						model->txQueuePutIndex);
+	}
+	reg->txbrp = 0u;
+
+	const uint32_t putIndex = (model->rxFifo0Size == 0u)
+			? 0u
+			: ((model->rxFifo0GetIndex + model->rxFifo0Count)
+					  % model->rxFifo0Size);
+	reg->rxf0s = BIT_FIELD_VALUE(MCAN_RXF0S_F0FL, model->rxFifo0Count)
+			| BIT_FIELD_VALUE(MCAN_RXF0S_F0GI,
+					model->rxFifo0GetIndex)
+			| BIT_FIELD_VALUE(MCAN_RXF0S_F0PI, putIndex)
+			| BIT_VALUE(MCAN_RXF0S_F0F,
+					(model->rxFifo0Size != 0u)
+							&& (model->rxFifo0Count
+									== model->rxFifo0Size));
+}
+
+static void
+stepMcan(const Mcan_Id id)
+{
+	Mcan_BaseRegisters *const reg = &HostRegisters_mcan[id];
+	McanModel *const model = &mcanModels[id];
+
+	// Reconfiguration of RX FIFO 0 flushes it.
+	const uint32_t rxFifo0Size = GET_FIELD_VALUE(MCAN_RXF0C_F0S, reg->rxf0c);
+	if (rxFifo0Size != model->rxFifo0Size) {
+		model->rxFifo0Size = rxFifo0Size;
+		model->rxFifo0GetIndex = 0u;
+		model->rxFifo0Count = 0u;
+	}
+
+	acknowledgeRxFifo0(id);
+	transmitRequests(id);
+	updateMcanStatus(id);
+
+	reg->ir = model->raisedIr;
+	model->raisedIr = 0u;
+}
+
+static void
+updatePeripheralClockStatus(const uint32_t peripheralId, const bool enabled)
+{
+#if defined(N7S_TARGET_SAMV71Q21)
+	volatile uint32_t *const status = (peripheralId < 32u)
+			? &HostRegisters_pmc.pcsr0
+			: &HostRegisters_pmc.pcsr1;
+#elif defined(N7S_TARGET_SAMRH71F20) || defined(N7S_TARGET_SAMRH707F18)
+	volatile uint32_t *const status = &HostRegisters_pmc.csr[peripheralId / 32u];
+#endif
+	const uint32_t mask = UINT32_C(1) << (peripheralId % 32u);
+
+	if (enabled)
+		*status |= mask;
+	else
+		*status &= ~mask;
+}
+
+static void
+stepPmc(void)
+{
+	Pmc_Registers *const reg = &HostRegisters_pmc;
+
+	reg->scsr = (reg->scsr | reg->scer) & ~reg->scdr;
+	reg->scer = 0u;
+	reg->scdr = 0u;
+
+#if defined(N7S_TARGET_SAMV71Q21)
+	reg->pcsr0 = (reg->pcsr0 | reg->pcer0) & ~reg->pcdr0;
+	reg->pcsr1 = (reg->pcsr1 | reg->pcer1) & ~reg->pcdr1;
+	reg->pcer0 = 0u;
+	reg->pcdr0 = 0u;
+	reg->pcer1 = 0u;
+	reg->pcdr1 = 0u;
+#endif
+
+	const uint32_t pcr = reg->pcr;
+	if ((pcr & PMC_PCR_CMD_MASK) != 0u) {
+		updatePeripheralClockStatus(GET_FIELD_VALUE(PMC_PCR_PID, pcr),
+				(pcr & PMC_PCR_EN_MASK) != 0u);
+		reg->pcr = pcr & ~PMC_PCR_CMD_MASK;
+	}
+}
+
+void
+HostRegisters_step(void)
+{
+	for (uint32_t i = 0u; i < UART_COUNT; i++)
+		stepUart((Uart_Id)i);
+	for (uint32_t i = 0u; i < MCAN_COUNT; i++)
+		stepMcan((Mcan_Id)i);
+	stepPmc();
+}
+
+uint32_t
+HostRegisters_uartReceive(
+		const Uart_Id id, const uint8_t *const data, const uint32_t size)
+{
+	assert((uint32_t)id < UART_COUNT);
+	assert((data != NULL) || (size == 0u));
+
+	return (uint32_t)ByteFifo_pushBytes(&uartModels[id].rx, data, size);
+}
+
+uint32_t
+HostRegisters_uartTakeTransmitted(
+		const Uart_Id id, uint8_t *const data, const uint32_t size)
+{
+	assert((uint32_t)id < UART_COUNT);
+	assert((data != NULL) || (size == 0u));
+
+	return (uint32_t)ByteFifo_pullBytes(&uartModels[id].tx, data, size);
+}
+
+bool
+HostRegisters_isUartInterruptPending(const Uart_Id id)
+{
+	assert((uint32_t)id < UART_COUNT);
+
+	return (HostRegisters_uart[id].sr & HostRegisters_uart[id].imr) != 0u;
+}
+
+bool
+HostRegisters_mcanReceive(const Mcan_Id id, const uint32_t *const element,
+		const uint32_t wordCount)
+{
+	assert((uint32_t)id < MCAN_COUNT);
+	assert(element != NULL);
+
+	return storeRxFifo0Element(id, element, wordCount);
+}
+
+bool
+HostRegisters_isMcanInterruptPending(const Mcan_Id id)
+{
+	assert((uint32_t)id < MCAN_COUNT);
+
+	return (HostRegisters_mcan[id].ir & HostRegisters_mcan[id].ie) != 0u;
+}
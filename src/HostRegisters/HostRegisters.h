@@ -0,0 +1,140 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file HostRegisters.h
+/// \addtogroup Bsp
+/// \brief Header for the in-memory register models used by host builds.
+
+#ifndef BSP_HOSTREGISTERS_H
+#define BSP_HOSTREGISTERS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <Eefc/EefcRegisters.h>
+#include <Mcan/Mcan.h>
+#include <Mcan/McanRegisters.h>
+#include <Pmc/PmcRegisters.h>
+#include <Scb/ScbRegisters.h>
+#include <Uart/Uart.h>
+#include <Uart/UartRegisters.h>
+
+/// @addtogroup HostRegisters
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if !defined(BSP_HOST_REGISTERS)
+#error "HostRegisters requires the BSP_HOST_REGISTERS build option"
+#endif
+
+/// \brief Number of bytes queued in each direction of a modelled UART.
+#ifndef HOST_REGISTERS_UART_QUEUE_SIZE
+#define HOST_REGISTERS_UART_QUEUE_SIZE 256u
+#endif
+
+/// \brief Size of the modelled MCAN message RAM in bytes. Must be a power of 2 not
+///        greater than 64 KiB, so that the area stays within a single message RAM window.
+#ifndef HOST_REGISTERS_MCAN_MESSAGE_RAM_SIZE
+#define HOST_REGISTERS_MCAN_MESSAGE_RAM_SIZE 16384u
+#endif
+
+/// \brief Value of the write-detection registers (UART THR, MCAN RXF0A) while they hold
+///        no value written by a driver.
+#define HOST_REGISTERS_EMPTY 0xFFFFFFFFu
+
+/// \brief Message RAM area to be used as Mcan_Config::msgRamBaseAddress in host builds.
+extern uint32_t HostRegisters_mcanMessageRam[HOST_REGISTERS_MCAN_MESSAGE_RAM_SIZE
+		/ sizeof(uint32_t)];
+
+/// \brief Resets all register models to their power-on state.
+/// \details UART transmitters are reported ready, PMC oscillators, PLLs and clocks are
+///          reported stable and the SCB reports both caches disabled. Has to be called
+///          before any driver is used.
+void HostRegisters_reset(void);
+
+/// \brief Advances all register models by one step.
+/// \details The models do not observe register accesses, they only react to values
+///          written by the drivers in between the steps:
+///          - UART: IER/IDR are applied to IMR, CR RSTSTA clears error flags, a byte
+///            written to THR is moved to the transmitted queue and the next received
+///            byte is presented in RHR. The byte presented previously is considered read.
+///          - MCAN: acknowledged RX FIFO 0 elements are released, elements requested in
+///            TXBAR are transmitted in loopback to RX FIFO 0 and TXFQS/RXF0S are updated.
+///            IR holds only the flags raised during the step.
+///          - PMC: SCER/SCDR and PCER/PCDR writes, as well as PCR write commands, are
+///            applied to the clock status registers.
+///          As only the last value written to a register is observed, the models should be
+///          stepped after each driver call, and then the drivers serviced (e.g. their
+///          interrupt handlers called).
+void HostRegisters_step(void);
+
+/// \brief Queues bytes to be received by a modelled UART, one byte per step.
+/// \param [in] id UART identifier.
+/// \param [in] data Bytes to be received.
+/// \param [in] size Number of bytes to be received.
+/// \returns Number of bytes queued, less than size if the queue is full.
+uint32_t HostRegisters_uartReceive(
+		const Uart_Id id, const uint8_t *const data, const uint32_t size);
+
+/// \brief Takes bytes transmitted by a modelled UART.
+/// \param [in] id UART identifier.
+/// \param [out] data Buffer for the transmitted bytes.
+/// \param [in] size Size of the buffer.
+/// \returns Number of bytes taken.
+uint32_t HostRegisters_uartTakeTransmitted(
+		const Uart_Id id, uint8_t *const data, const uint32_t size);
+
+/// \brief Checks whether a modelled UART requests an interrupt.
+/// \param [in] id UART identifier.
+/// \retval true An enabled interrupt flag is set in SR.
+/// \retval false No enabled interrupt flag is set in SR.
+bool HostRegisters_isUartInterruptPending(const Uart_Id id);
+
+/// \brief Stores an element received by a modelled MCAN in its RX FIFO 0.
+/// \details Raises RF0N, or RF0L if the FIFO is full.
+/// \param [in] id MCAN identifier.
+/// \param [in] element Element words, laid out as in the message RAM.
+/// \param [in] wordCount Number of element words, copied up to the RX FIFO 0
+///             element size.
+/// \retval true The element was stored.
+/// \retval false RX FIFO 0 is not configured or full.
+bool HostRegisters_mcanReceive(const Mcan_Id id, const uint32_t *const element,
+		const uint32_t wordCount);
+
+/// \brief Checks whether a modelled MCAN requests an interrupt.
+/// \param [in] id MCAN identifier.
+/// \retval true An enabled interrupt flag is set in IR.
+/// \retval false No enabled interrupt flag is set in IR.
+bool HostRegisters_isMcanInterruptPending(const Mcan_Id id);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_HOSTREGISTERS_H
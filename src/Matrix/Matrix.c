@@ -28,6 +28,44 @@
 
 #include <Utils/Bits.h>
 
+const Matrix_QosProfile Matrix_QosProfile_CpuLatencyFirst = {
+	.cpuBurstType = Matrix_BurstType_16Beat,
+	.dmaBurstType = Matrix_BurstType_4Beat,
+	.cpuPriority = {
+		.isLatencyQosEnabled = true,
+		.masterPriority = Matrix_MasterPriority_3,
+	},
+	.dmaPriority = {
+		.isLatencyQosEnabled = false,
+		.masterPriority = Matrix_MasterPriority_1,
+	},
+	.slaveDefaultMasterType = Matrix_SlaveDefaultMasterType_Last,
+	.maximumBusGrantDuration = 16u,
+};
+
+const Matrix_QosProfile Matrix_QosProfile_DmaThroughputFirst = {
+	.cpuBurstType = Matrix_BurstType_16Beat,
+	.dmaBurstType = Matrix_BurstType_64Beat,
+	.cpuPriority = {
+		.isLatencyQosEnabled = false,
+		.masterPriority = Matrix_MasterPriority_1,
+	},
+	.dmaPriority = {
+		.isLatencyQosEnabled = false,
+		.masterPriority = Matrix_MasterPriority_2,
+	},
+	.slaveDefaultMasterType = Matrix_SlaveDefaultMasterType_Last,
+	.maximumBusGrantDuration = 64u,
+};
+
+static inline bool
+isCpuMaster(const Matrix_Master master)
+{
+	return (master == Matrix_Master_CortexM7Port0)
+			|| (master == Matrix_Master_CortexM7Port1)
+			|| (master == Matrix_Master_CortexM7PeripheralPort);
+}
+
 void
 Matrix_init(Matrix *const matrix, Matrix_Registers *const matrixDeviceAddress)
 {
@@ -186,6 +224,40 @@ Matrix_getSlaveConfig(const Matrix *const matrix, const Matrix_Slave slave,
 	}
 }
 
+void
+Matrix_applyQosProfile(
+		Matrix *const matrix, const Matrix_QosProfile *const profile)
+{
+	assert(matrix != NULL);
+	assert(profile != NULL);
+
+	for (uint32_t i = 0u; i < (uint32_t)Matrix_Master_Count; i++) {
+		const Matrix_Master master = (Matrix_Master)i;
+		Matrix_MasterConfig masterConfig;
+		Matrix_getMasterConfig(matrix, master, &masterConfig);
+		masterConfig.burstType = isCpuMaster(master)
+				? profile->cpuBurstType
+				: profile->dmaBurstType;
+		Matrix_setMasterConfig(matrix, master, &masterConfig);
+	}
+
+	for (uint32_t i = 0u; i < (uint32_t)Matrix_Slave_Count; i++) {
+		const Matrix_Slave slave = (Matrix_Slave)i;
+		Matrix_SlaveConfig slaveConfig;
+		Matrix_getSlaveConfig(matrix, slave, &slaveConfig);
+		slaveConfig.slaveDefaultMasterType =
+				profile->slaveDefaultMasterType;
+		slaveConfig.maximumBusGrantDurationForMasters =
+				profile->maximumBusGrantDuration;
+		for (uint32_t j = 0u; j < (uint32_t)Matrix_Master_Count; j++)
+			slaveConfig.accessPriority[j] =
+					isCpuMaster((Matrix_Master)j)
+					? profile->cpuPriority
+					: profile->dmaPriority;
+		Matrix_setSlaveConfig(matrix, slave, &slaveConfig);
+	}
+}
+
 void
 Matrix_getMastersStatuses(const Matrix *const matrix,
 		Matrix_MastersStatuses *const statuses)
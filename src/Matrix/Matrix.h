@@ -296,6 +296,33 @@ typedef struct {
 	Matrix_AccessPriority accessPriority[Matrix_Master_Count];
 } Matrix_SlaveConfig;
 
+/// \brief Bus arbitration profile applied to all Master/Slave pairs at once.
+/// \details Masters are split into two classes: the Cortex-M7 ports, and all remaining
+///          (DMA capable) Masters. Each class gets its own undefined length burst type and
+///          access priority, applied on every Slave.
+typedef struct {
+	/// \brief Undefined length burst type of the Cortex-M7 Masters.
+	Matrix_BurstType cpuBurstType;
+	/// \brief Undefined length burst type of the DMA Masters.
+	Matrix_BurstType dmaBurstType;
+	/// \brief Access priority of the Cortex-M7 Masters on every Slave.
+	Matrix_AccessPriority cpuPriority;
+	/// \brief Access priority of the DMA Masters on every Slave.
+	Matrix_AccessPriority dmaPriority;
+	/// \brief Default Master access policy of every Slave.
+	Matrix_SlaveDefaultMasterType slaveDefaultMasterType;
+	/// \brief Slave cycles before re-arbitration, see Matrix_SlaveConfig.
+	uint16_t maximumBusGrantDuration;
+} Matrix_QosProfile;
+
+/// \brief Profile minimizing processor access latency. Cortex-M7 Masters are latency
+///        critical with latency QoS enabled, DMA Masters are re-arbitrated every 4 beats.
+extern const Matrix_QosProfile Matrix_QosProfile_CpuLatencyFirst;
+
+/// \brief Profile maximizing DMA throughput. DMA Masters take precedence and are allowed
+///        64 beat bursts, Cortex-M7 Masters are treated as bandwidth sensitive.
+extern const Matrix_QosProfile Matrix_QosProfile_DmaThroughputFirst;
+
 /// \brief Enumeration listing possible Protection Regions.
 typedef enum {
 	Matrix_ProtectedRegionId_0 = 0, ///< Protection Region ID 0.
@@ -422,6 +449,14 @@ void Matrix_getMasterConfig(const Matrix *const matrix,
 void Matrix_getSlaveConfig(const Matrix *const matrix, const Matrix_Slave slave,
 		Matrix_SlaveConfig *const config);
 
+/// \brief Applies a bus arbitration profile to all Masters and Slaves.
+/// \details Remapped address decoding and error interrupt settings of the Masters are
+///          preserved. The fixed default Master of each Slave is left unchanged.
+/// \param [in,out] matrix Pointer to a structure representing a Matrix instance.
+/// \param [in] profile Profile to apply.
+void Matrix_applyQosProfile(
+		Matrix *const matrix, const Matrix_QosProfile *const profile);
+
 /// \brief Gets Masters' statuses.
 /// \param [in] matrix Pointer to a structure representing a Matrix instance.
 /// \param [out] statuses Read statuses.
@@ -29,6 +29,7 @@
 
 #include <Utils/Bits.h>
 #include <Utils/ErrorCode.h>
+#include <Utils/Memory.h>
 #include <Utils/Utils.h>
 
 #include <bsp/arm/Scb/Scb.h>
@@ -112,14 +113,24 @@ setMsgRamBaseAddress(Mcan *const mcan, const Mcan_Config *const config)
 			addressMsb);
 }
 
+static bool
+waitForCccr(const Mcan *const mcan, const uint32_t mask,
+		const uint32_t timeoutLimit, const Dwt_Deadline *const deadline)
+{
+	if (deadline != NULL)
+		return Dwt_waitForRegister(&mcan->reg.base->cccr, mask, deadline);
+
+	return waitForRegisterWithTimeout(
+			&mcan->reg.base->cccr, mask, timeoutLimit);
+}
+
 static bool
 setPowerDownMode(Mcan *const mcan, const uint32_t timeoutLimit,
-		ErrorCode *const errCode)
+		const Dwt_Deadline *const deadline, ErrorCode *const errCode)
 {
 	mcan->reg.base->cccr |= MCAN_CCCR_CSR_MASK;
 
-	if (!waitForRegisterWithTimeout(&mcan->reg.base->cccr,
-			    MCAN_CCCR_CSA_MASK, timeoutLimit))
+	if (!waitForCccr(mcan, MCAN_CCCR_CSA_MASK, timeoutLimit, deadline))
 		return returnError(errCode,
 				Mcan_ErrorCode_ClockStopRequestTimeout);
 
@@ -128,7 +139,8 @@ setPowerDownMode(Mcan *const mcan, const uint32_t timeoutLimit,
 
 static bool
 setMode(Mcan *const mcan, const Mcan_Config *const config,
-		const uint32_t timeoutLimit, ErrorCode *const errCode)
+		const uint32_t timeoutLimit, const Dwt_Deadline *const deadline,
+		ErrorCode *const errCode)
 {
 	if (config->isFdEnabled)
 		mcan->reg.base->cccr |= MCAN_CCCR_FDOE_MASK;
@@ -145,7 +157,7 @@ setMode(Mcan *const mcan, const Mcan_Config *const config,
 		mcan->reg.base->cccr |= MCAN_CCCR_MON_MASK;
 		return true;
 	case Mcan_Mode_PowerDown:
-		if (!setPowerDownMode(mcan, timeoutLimit, errCode))
+		if (!setPowerDownMode(mcan, timeoutLimit, deadline, errCode))
 			return false;
 		return true;
 	case Mcan_Mode_InternalLoopBackTest:
@@ -448,16 +460,16 @@ setInterrupts(Mcan *const mcan, const Mcan_Config *const config)
 	mcan->reg.base->txbcie = 0u;
 }
 
-bool
-Mcan_setConfig(Mcan *const mcan, const Mcan_Config *const config,
-		const uint32_t timeoutLimit, ErrorCode *const errCode)
+static bool
+configure(Mcan *const mcan, const Mcan_Config *const config,
+		const uint32_t timeoutLimit, const Dwt_Deadline *const deadline,
+		ErrorCode *const errCode)
 {
 	setMsgRamBaseAddress(mcan, config);
 
 	mcan->reg.base->cccr = MCAN_CCCR_INIT_MASK;
 
-	if (!waitForRegisterWithTimeout(&mcan->reg.base->cccr,
-			    MCAN_CCCR_INIT_MASK, timeoutLimit))
+	if (!waitForCccr(mcan, MCAN_CCCR_INIT_MASK, timeoutLimit, deadline))
 		return returnError(errCode,
 				Mcan_ErrorCode_InitializationStartTimeout);
 
@@ -468,7 +480,7 @@ Mcan_setConfig(Mcan *const mcan, const Mcan_Config *const config,
 			(uint32_t)(MCAN_CCCR_CCE_MASK | MCAN_CCCR_INIT_MASK);
 	mcan->reg.base->gfc = 0u;
 
-	if (!setMode(mcan, config, timeoutLimit, errCode))
+	if (!setMode(mcan, config, timeoutLimit, deadline, errCode))
 		return false;
 
 	setNominalTiming(mcan, config);
@@ -500,6 +512,22 @@ Mcan_setConfig(Mcan *const mcan, const Mcan_Config *const config,
 	return true;
 }
 
+bool
+Mcan_setConfig(Mcan *const mcan, const Mcan_Config *const config,
+		const uint32_t timeoutLimit, ErrorCode *const errCode)
+{
+	return configure(mcan, config, timeoutLimit, NULL, errCode);
+}
+
+bool
+Mcan_setConfigWithDeadline(Mcan *const mcan, const Mcan_Config *const config,
+		const Dwt_Deadline *const deadline, ErrorCode *const errCode)
+{
+	assert(deadline != NULL);
+
+	return configure(mcan, config, 0u, deadline, errCode);
+}
+
 static void
 getMsgRamBaseAddress(const Mcan *const mcan, Mcan_Config *const config)
 {
@@ -790,6 +818,139 @@ Mcan_getConfig(const Mcan *const mcan, Mcan_Config *const config)
 			MCAN_RWD_WDC, mcan->reg.base->rwd);
 }
 
+static bool
+isMessageRamLayoutValid(const Mcan_MessageRamLayout *const layout)
+{
+	if ((layout->standardFilterCount > 128u)
+			|| (layout->extendedFilterCount > 64u)
+			|| (layout->rxFifo0Count > 64u)
+			|| (layout->rxFifo1Count > 64u)
+			|| (layout->rxBufferCount > 64u)
+			|| (layout->txEventFifoCount > 32u)
+			|| (((uint32_t)layout->txBufferCount
+					    + layout->txQueueCount)
+					> 32u))
+		return false;
+
+	return (decodeElementSizeInBytes(layout->rxFifo0ElementSize)
+				       != Mcan_DataLengthRaw_Invalid)
+			&& (decodeElementSizeInBytes(layout->rxFifo1ElementSize)
+					!= Mcan_DataLengthRaw_Invalid)
+			&& (decodeElementSizeInBytes(
+					    layout->rxBufferElementSize)
+					!= Mcan_DataLengthRaw_Invalid)
+			&& (decodeElementSizeInBytes(layout->txElementSize)
+					!= Mcan_DataLengthRaw_Invalid);
+}
+
+uint32_t
+Mcan_getMessageRamSize(const Mcan_MessageRamLayout *const layout)
+{
+	assert(layout != NULL);
+
+	if (!isMessageRamLayoutValid(layout))
+		return 0u;
+
+	return MCAN_MESSAGE_RAM_BYTES(layout->standardFilterCount,
+			layout->extendedFilterCount, layout->rxFifo0Count,
+			decodeElementSizeInBytes(layout->rxFifo0ElementSize),
+			layout->rxFifo1Count,
+			decodeElementSizeInBytes(layout->rxFifo1ElementSize),
+			layout->rxBufferCount,
+			decodeElementSizeInBytes(layout->rxBufferElementSize),
+			layout->txEventFifoCount,
+			(uint32_t)layout->txBufferCount + layout->txQueueCount,
+			decodeElementSizeInBytes(layout->txElementSize));
+}
+
+static uint32_t *
+takeMessageRamSection(uint32_t **const cursor, const uint32_t count,
+		const uint32_t elementBytes)
+{
+	if (count == 0u)
+		return NULL;
+
+	uint32_t *const section = *cursor;
+	*cursor = &section[(count * elementBytes) / sizeof(uint32_t)];
+	return section;
+}
+
+bool
+Mcan_applyMessageRamLayout(const Mcan_MessageRamLayout *const layout,
+		uint32_t *const area, const uint32_t areaSize,
+		Mcan_Config *const config, uint32_t *const usedSize,
+		ErrorCode *const errCode)
+{
+	assert(layout != NULL);
+	assert(area != NULL);
+	assert(config != NULL);
+	assert(usedSize != NULL);
+
+	*usedSize = 0u;
+
+	const uint32_t size = Mcan_getMessageRamSize(layout);
+	if (size == 0u)
+		return returnError(errCode, Mcan_ErrorCode_LayoutInvalid);
+	if (size > areaSize)
+		return returnError(errCode, Mcan_ErrorCode_MessageRamTooSmall);
+
+	// cppcheck-suppress misra-c2012-11.4
+	const uint32_t start = (uint32_t)area;
+	if (((start & 0xFFFF0000u) != ((start + size - 1u) & 0xFFFF0000u))
+			|| ((start % sizeof(uint32_t)) != 0u))
+		return returnError(errCode, Mcan_ErrorCode_LayoutInvalid);
+
+	uint32_t *cursor = area;
+	config->msgRamBaseAddress = area;
+
+	config->standardIdFilter.filterListAddress = takeMessageRamSection(
+			&cursor, layout->standardFilterCount,
+			MCAN_STDRXFILTERELEMENT_SIZE);
+	config->standardIdFilter.filterListSize = layout->standardFilterCount;
+	config->extendedIdFilter.filterListAddress = takeMessageRamSection(
+			&cursor, layout->extendedFilterCount,
+			MCAN_EXTRXFILTERELEMENT_SIZE);
+	config->extendedIdFilter.filterListSize = layout->extendedFilterCount;
+
+	config->rxFifo0.isEnabled = layout->rxFifo0Count != 0u;
+	config->rxFifo0.startAddress = takeMessageRamSection(&cursor,
+			layout->rxFifo0Count,
+			decodeRxElementSizeInBytes(layout->rxFifo0ElementSize));
+	config->rxFifo0.size = layout->rxFifo0Count;
+	config->rxFifo0.elementSize = layout->rxFifo0ElementSize;
+
+	config->rxFifo1.isEnabled = layout->rxFifo1Count != 0u;
+	config->rxFifo1.startAddress = takeMessageRamSection(&cursor,
+			layout->rxFifo1Count,
+			decodeRxElementSizeInBytes(layout->rxFifo1ElementSize));
+	config->rxFifo1.size = layout->rxFifo1Count;
+	config->rxFifo1.elementSize = layout->rxFifo1ElementSize;
+
+	config->rxBuffer.startAddress = takeMessageRamSection(&cursor,
+			layout->rxBufferCount,
+			decodeRxElementSizeInBytes(
+					layout->rxBufferElementSize));
+	config->rxBuffer.elementSize = layout->rxBufferElementSize;
+
+	config->txEventFifo.isEnabled = layout->txEventFifoCount != 0u;
+	config->txEventFifo.startAddress = takeMessageRamSection(&cursor,
+			layout->txEventFifoCount, MCAN_TXEVENTELEMENT_SIZE);
+	config->txEventFifo.size = layout->txEventFifoCount;
+
+	const uint32_t txCount =
+			(uint32_t)layout->txBufferCount + layout->txQueueCount;
+	config->txBuffer.isEnabled = txCount != 0u;
+	config->txBuffer.startAddress = takeMessageRamSection(&cursor, txCount,
+			decodeTxElementSizeInBytes(layout->txElementSize));
+	config->txBuffer.bufferSize = layout->txBufferCount;
+	config->txBuffer.queueSize = layout->txQueueCount;
+	config->txBuffer.elementSize = layout->txElementSize;
+
+	*usedSize = size;
+
+	return true;
+}
+
 static Mcan_DataLengthCode
 encodeDataLengthCode(const Mcan_DataLengthRaw size)
 {
@@ -807,6 +968,13 @@ encodeDataLengthCode(const Mcan_DataLengthRaw size)
 	}
 }
 
+bool
+Mcan_isDataSizeValid(const uint8_t dataSize)
+{
+	return encodeDataLengthCode((Mcan_DataLengthRaw)dataSize)
+			!= Mcan_DataLengthCode_Invalid;
+}
+
 static Mcan_DataLengthRaw
 decodeDataLengthCode(const Mcan_DataLengthCode dlc, const bool isCanFdFrame)
 {
@@ -827,47 +995,70 @@ decodeDataLengthCode(const Mcan_DataLengthCode dlc, const bool isCanFdFrame)
 }
 
 static bool
-txAddElement(Mcan *const mcan, const Mcan_TxElement element,
-		uint32_t *const baseAddress, const uint8_t index)
+encodeTxHeader(const Mcan_TxElement *const element, uint32_t *const t0,
+		uint32_t *const t1)
 {
-	const uint32_t dataLengthCode = encodeDataLengthCode(element.dataSize);
+	const uint32_t dataLengthCode = encodeDataLengthCode(element->dataSize);
 	if (dataLengthCode == MCAN_DLC_INVALID)
 		return false;
 
-	(void)memset(baseAddress, 0, mcan->tx.elementSize);
+	*t0 = BIT_FIELD_VALUE(MCAN_TXELEMENT_ESI, element->esiFlag)
+			| BIT_FIELD_VALUE(MCAN_TXELEMENT_XTD, element->idType)
+			| BIT_FIELD_VALUE(MCAN_TXELEMENT_RTR, element->frameType);
+	if (element->idType == Mcan_IdType_Standard)
+		*t0 |= BIT_FIELD_VALUE(MCAN_TXELEMENT_STDID, element->id);
+	else
+		*t0 |= BIT_FIELD_VALUE(MCAN_TXELEMENT_EXTID, element->id);
+
+	*t1 = BIT_FIELD_VALUE(MCAN_TXELEMENT_MM, element->marker)
+			| BIT_VALUE(MCAN_TXELEMENT_EFC, element->isTxEventStored)
+			| BIT_VALUE(MCAN_TXELEMENT_FDF,
+					element->isCanFdFormatEnabled)
+			| BIT_VALUE(MCAN_TXELEMENT_BRS,
+					element->isBitRateSwitchingEnabled)
+			| BIT_FIELD_VALUE(MCAN_TXELEMENT_DLC, dataLengthCode);
+
+	return true;
+}
+
+static uint32_t *
+getTxElementAddress(const Mcan *const mcan, const uint32_t index)
+{
+	return &mcan->tx.bufferAddress[(mcan->tx.elementSize * index)
+			/ sizeof(uint32_t)];
+}
+
+static bool
+txWriteElement(const Mcan *const mcan, const Mcan_TxElement element,
+		uint32_t *const baseAddress)
+{
+	// Header words are composed locally, so that every message RAM word is
+	// written exactly once.
+	uint32_t t0 = 0u;
+	uint32_t t1 = 0u;
+	if (!encodeTxHeader(&element, &t0, &t1))
+		return false;
+
+	assert(((uint32_t)element.dataSize
+			       + (MCAN_TXELEMENT_DATA_WORD * sizeof(uint32_t)))
+			<= mcan->tx.elementSize);
 
 	// cppcheck-suppress [objectIndex]
-	baseAddress[MCAN_TXELEMENT_ESI_WORD] |=
-			BIT_FIELD_VALUE(MCAN_TXELEMENT_ESI, element.esiFlag);
-	// cppcheck-suppress [objectIndex]
-	baseAddress[MCAN_TXELEMENT_XTD_WORD] |=
-			BIT_FIELD_VALUE(MCAN_TXELEMENT_XTD, element.idType);
-	// cppcheck-suppress [objectIndex]
-	baseAddress[MCAN_TXELEMENT_RTR_WORD] |=
-			BIT_FIELD_VALUE(MCAN_TXELEMENT_RTR, element.frameType);
+	baseAddress[MCAN_TXELEMENT_ESI_WORD] = t0;
 	// cppcheck-suppress [objectIndex]
-	baseAddress[MCAN_TXELEMENT_MM_WORD] |=
-			BIT_FIELD_VALUE(MCAN_TXELEMENT_MM, element.marker);
+	baseAddress[MCAN_TXELEMENT_MM_WORD] = t1;
+	Memory_writeWords(&baseAddress[MCAN_TXELEMENT_DATA_WORD], element.data,
+			element.dataSize);
 
-	if (element.idType == Mcan_IdType_Standard)
-		baseAddress[MCAN_TXELEMENT_STDID_WORD] |= BIT_FIELD_VALUE(
-				MCAN_TXELEMENT_STDID, element.id);
-	else
-		baseAddress[MCAN_TXELEMENT_EXTID_WORD] |= BIT_FIELD_VALUE(
-				MCAN_TXELEMENT_EXTID, element.id);
-
-	if (element.isTxEventStored)
-		baseAddress[MCAN_TXELEMENT_EFC_WORD] |= MCAN_TXELEMENT_EFC_MASK;
-	if (element.isCanFdFormatEnabled)
-		baseAddress[MCAN_TXELEMENT_FDF_WORD] |= MCAN_TXELEMENT_FDF_MASK;
-	if (element.isBitRateSwitchingEnabled)
-		baseAddress[MCAN_TXELEMENT_BRS_WORD] |= MCAN_TXELEMENT_BRS_MASK;
-	baseAddress[MCAN_TXELEMENT_DLC_WORD] |=
-			BIT_FIELD_VALUE(MCAN_TXELEMENT_DLC, dataLengthCode);
-
-	uint8_t *dataPointer =
-			(uint8_t *)&baseAddress[MCAN_TXELEMENT_DATA_WORD];
-	(void)memcpy(dataPointer, element.data, element.dataSize);
+	return true;
+}
+
+static bool
+txAddElement(Mcan *const mcan, const Mcan_TxElement element,
+		uint32_t *const baseAddress, const uint8_t index)
+{
+	if (!txWriteElement(mcan, element, baseAddress))
+		return false;
 	MEMORY_SYNC_BARRIER();
 
 	changeBitAtOffset(&mcan->reg.base->txbtie, index,
@@ -918,28 +1109,122 @@ Mcan_txQueuePush(Mcan *const mcan, const Mcan_TxElement element,
 	return true;
 }
 
-bool
-Mcan_txBufferIsTransmissionFinished(const Mcan *const mcan, const uint8_t index)
+static uint32_t
+getTxQueueMask(const Mcan *const mcan)
 {
-	return isBitSet(mcan->reg.base->txbto, index);
+	if (mcan->tx.queueSize == 0u)
+		return 0u;
+	return (UINT32_MAX >> (32u - mcan->tx.queueSize))
+			<< mcan->tx.bufferSize;
+}
+
+static uint8_t
+txQueueNextIndex(const Mcan *const mcan, const uint32_t txbc,
+		const uint8_t index, const uint32_t freeMask)
+{
+	const uint8_t queueEnd =
+			(uint8_t)(mcan->tx.bufferSize + mcan->tx.queueSize);
+
+	if (GET_FIELD_VALUE(MCAN_TXBC_TFQM, txbc)
+			== (uint32_t)Mcan_TxQueueType_Fifo) {
+		// Tx FIFO elements are consecutive and wrap around within the
+		// queue section of the Tx Buffer.
+		const uint8_t next = (uint8_t)(index + 1u);
+		return (next < queueEnd) ? next : mcan->tx.bufferSize;
+	}
+
+	// Tx Queue may have non-consecutive free elements, the free mask covers
+	// the queue section only.
+	const uint32_t following = freeMask & ~((UINT32_C(2) << index) - 1u);
+	if (following == 0u)
+		return index;
+	return (uint8_t)countTrailingZeros(following);
+}
+
+static uint32_t
+getTxQueueFreeCount(const uint32_t txbc, const uint32_t txfqs,
+		const uint32_t freeMask)
+{
+	// TFFL reads as zero in Tx Queue mode, free elements are counted from
+	// the pending requests instead.
+	if (GET_FIELD_VALUE(MCAN_TXBC_TFQM, txbc)
+			== (uint32_t)Mcan_TxQueueType_Fifo)
+		return GET_FIELD_VALUE(MCAN_TXFQS_TFFL, txfqs);
+	return countSetBits(freeMask);
 }
 
 bool
-Mcan_txEventFifoPull(const Mcan *const mcan, Mcan_TxEventElement *const element,
+Mcan_txQueuePushBatch(Mcan *const mcan, const Mcan_TxElement *const elements,
+		const uint8_t count, uint8_t *const pushed,
 		ErrorCode *const errCode)
 {
-	uint32_t count =
-			GET_FIELD_VALUE(MCAN_TXEFS_EFFL, mcan->reg.base->txefs);
-	if (count == 0u)
-		return returnError(errCode, Mcan_ErrorCode_TxEventFifoEmpty);
+	assert(mcan != NULL);
+	assert((elements != NULL) || (count == 0u));
+	assert(pushed != NULL);
 
-	uint8_t getIndex = (uint8_t)GET_FIELD_VALUE(
-			MCAN_TXEFS_EFGI, mcan->reg.base->txefs);
-	const uint32_t *const baseAddr =
-			&mcan->txEventFifoAddress[(MCAN_TXEVENTELEMENT_SIZE
-								  * getIndex)
-					/ sizeof(uint32_t)];
+	*pushed = 0u;
+
+	const uint32_t txfqs = mcan->reg.base->txfqs;
+	if (IS_BIT_SET(MCAN_TXFQS_TFQF, txfqs))
+		return returnError(errCode, Mcan_ErrorCode_TxFifoFull);
+
+	const uint32_t txbc = mcan->reg.base->txbc;
+	const uint32_t freeMask = getTxQueueMask(mcan) & ~mcan->reg.base->txbrp;
+	const uint32_t freeLevel = getTxQueueFreeCount(txbc, txfqs, freeMask);
+	uint8_t index = (uint8_t)GET_FIELD_VALUE(MCAN_TXFQS_TFQPI, txfqs);
+
+	uint32_t requestMask = 0u;
+	uint32_t interruptSetMask = 0u;
+	bool isElementValid = true;
+	uint8_t i = 0u;
+	while ((i < count) && ((uint32_t)i < freeLevel)) {
+		uint32_t *const baseAddr = getTxElementAddress(mcan, index);
+		if (!txWriteElement(mcan, elements[i], baseAddr)) {
+			isElementValid = false;
+			break;
+		}
+
+		const uint32_t indexMask = shiftBitLeft(true, index);
+		requestMask |= indexMask;
+		if (elements[i].isInterruptEnabled)
+			interruptSetMask |= indexMask;
+
+		index = txQueueNextIndex(mcan, txbc, index, freeMask);
+		i++;
+	}
+
+	if (requestMask != 0u) {
+		MEMORY_SYNC_BARRIER();
+
+		mcan->reg.base->txbtie = (mcan->reg.base->txbtie & ~requestMask)
+				| interruptSetMask;
+		mcan->reg.base->txbar = requestMask;
+	}
+
+	*pushed = i;
 
+	if (!isElementValid)
+		return returnError(errCode, Mcan_ErrorCode_ElementSizeInvalid);
+
+	return true;
+}
+
+bool
+Mcan_txBufferIsTransmissionFinished(const Mcan *const mcan, const uint8_t index)
+{
+	return isBitSet(mcan->reg.base->txbto, index);
+}
+
+uint32_t
+Mcan_txBufferGetFinishedMask(const Mcan *const mcan)
+{
+	return mcan->reg.base->txbto;
+}
+
+static void
+decodeTxEventElement(const uint32_t *const baseAddr,
+		Mcan_TxEventElement *const element)
+{
 	element->esiFlag = GET_FIELD_VALUE(MCAN_TXEVENTELEMENT_ESI,
 			baseAddr[MCAN_TXEVENTELEMENT_ESI_WORD]);
 	element->idType = GET_FIELD_VALUE(MCAN_TXEVENTELEMENT_XTD,
@@ -968,15 +1253,101 @@ Mcan_txEventFifoPull(const Mcan *const mcan, Mcan_TxEventElement *const element,
 					baseAddr[MCAN_TXEVENTELEMENT_DLC_WORD]),
 			element->isCanFdFormatEnabled);
 	element->dataSize = (uint8_t)dataSize;
+}
+
+static const uint32_t *
+getTxEventElementAddress(const Mcan *const mcan, const uint32_t index)
+{
+	return &mcan->txEventFifoAddress[(MCAN_TXEVENTELEMENT_SIZE * index)
+			/ sizeof(uint32_t)];
+}
+
+static inline void
+callTxEventHook(const Mcan *const mcan, const Mcan_TxEventElement *const element)
+{
+	if (mcan->txEventHook != NULL)
+		mcan->txEventHook(element, mcan->txEventHookArg);
+}
+
+bool
+Mcan_txEventFifoPull(const Mcan *const mcan, Mcan_TxEventElement *const element,
+		ErrorCode *const errCode)
+{
+	const uint32_t txefs = mcan->reg.base->txefs;
+	const uint32_t count = GET_FIELD_VALUE(MCAN_TXEFS_EFFL, txefs);
+	if (count == 0u)
+		return returnError(errCode, Mcan_ErrorCode_TxEventFifoEmpty);
+
+	const uint8_t getIndex =
+			(uint8_t)GET_FIELD_VALUE(MCAN_TXEFS_EFGI, txefs);
+	decodeTxEventElement(getTxEventElementAddress(mcan, getIndex), element);
 
 	MEMORY_SYNC_BARRIER();
 
 	mcan->reg.base->txefa = BIT_FIELD_VALUE(MCAN_TXEFA_EFAI, getIndex);
+
+	callTxEventHook(mcan, element);
+	return true;
+}
+
+bool
+Mcan_txEventFifoPullBatch(const Mcan *const mcan,
+		Mcan_TxEventElement *const elements, const uint8_t count,
+		uint8_t *const pulled, ErrorCode *const errCode)
+{
+	assert(mcan != NULL);
+	assert((elements != NULL) || (count == 0u));
+	assert(pulled != NULL);
+
+	*pulled = 0u;
+
+	const uint32_t txefs = mcan->reg.base->txefs;
+	const uint32_t fillLevel = GET_FIELD_VALUE(MCAN_TXEFS_EFFL, txefs);
+	if (fillLevel == 0u)
+		return returnError(errCode, Mcan_ErrorCode_TxEventFifoEmpty);
+
+	if (count == 0u)
+		return true;
+
+	const uint32_t pullCount =
+			((uint32_t)count < fillLevel) ? count : fillLevel;
+	uint32_t index = GET_FIELD_VALUE(MCAN_TXEFS_EFGI, txefs);
+
+	for (uint32_t i = 0u; i < pullCount; i++) {
+		if (i != 0u) {
+			index++;
+			if (index >= mcan->txEventFifoSize)
+				index = 0u;
+		}
+		decodeTxEventElement(
+				getTxEventElementAddress(mcan, index),
+				&elements[i]);
+	}
+
+	MEMORY_SYNC_BARRIER();
+
+	// Acknowledging an index releases all elements up to and including it.
+	mcan->reg.base->txefa = BIT_FIELD_VALUE(MCAN_TXEFA_EFAI, index);
+
+	for (uint32_t i = 0u; i < pullCount; i++)
+		callTxEventHook(mcan, &elements[i]);
+
+	*pulled = (uint8_t)pullCount;
+
 	return true;
 }
 
+void
+Mcan_setTxEventHook(Mcan *const mcan, const McanTxEventHook hook, void *arg)
+{
+	assert(mcan != NULL);
+
+	mcan->txEventHook = hook;
+	mcan->txEventHookArg = arg;
+}
+
 static void
-getRxElement(const uint32_t *const baseAddr, Mcan_RxElement *const element)
+decodeRxElement(const uint32_t *const baseAddr, Mcan_RxElement *const element)
 {
 	element->esiFlag = GET_FIELD_VALUE(
 			MCAN_RXELEMENT_ESI, baseAddr[MCAN_RXELEMENT_ESI_WORD]);
@@ -1005,9 +1376,14 @@ getRxElement(const uint32_t *const baseAddr, Mcan_RxElement *const element)
 					baseAddr[MCAN_RXELEMENT_DLC_WORD]),
 			element->isCanFdFormatEnabled);
 	element->dataSize = (uint8_t)dataSize;
-	const uint8_t *const dataPointer =
-			(const uint8_t *)&baseAddr[MCAN_RXELEMENT_DATA_WORD];
-	(void)memcpy(element->data, dataPointer, element->dataSize);
+	Memory_readWords(element->data, &baseAddr[MCAN_RXELEMENT_DATA_WORD],
+			element->dataSize);
+}
+
+static void
+getRxElement(const uint32_t *const baseAddr, Mcan_RxElement *const element)
+{
+	decodeRxElement(baseAddr, element);
 
 	MEMORY_SYNC_BARRIER();
 }
@@ -1025,48 +1401,176 @@ Mcan_rxBufferGet(const Mcan *const mcan, const uint8_t index,
 	getRxElement(bufferPointer, element);
 }
 
-bool
-Mcan_rxFifoPull(Mcan *const mcan, const Mcan_RxFifoId id,
-		Mcan_RxElement *const element, ErrorCode *const errCode)
-{
-	assert(mcan != NULL);
-	uint32_t rxfs = 0u;
-	const uint32_t *fifoAddress = NULL;
-	uint32_t elementSize = 0u;
-	volatile uint32_t *ackReg = NULL;
+typedef struct {
+	uint32_t status;
+	const uint32_t *address;
+	uint32_t size;
+	uint32_t elementSize;
+	volatile uint32_t *ackReg;
+} RxFifoAccess;
 
+static bool
+getRxFifoAccess(const Mcan *const mcan, const Mcan_RxFifoId id,
+		RxFifoAccess *const access)
+{
 	switch (id) {
 	case Mcan_RxFifoId_0:
-		rxfs = mcan->reg.base->rxf0s;
-		fifoAddress = mcan->rxFifo0.address;
-		elementSize = mcan->rxFifo0.elementSize;
-		ackReg = &mcan->reg.base->rxf0a;
-		break;
+		access->status = mcan->reg.base->rxf0s;
+		access->address = mcan->rxFifo0.address;
+		access->size = mcan->rxFifo0.size;
+		access->elementSize = mcan->rxFifo0.elementSize;
+		access->ackReg = &mcan->reg.base->rxf0a;
+		return access->address != NULL;
 	case Mcan_RxFifoId_1:
-		rxfs = mcan->reg.base->rxf1s;
-		fifoAddress = mcan->rxFifo1.address;
-		elementSize = mcan->rxFifo1.elementSize;
-		ackReg = &mcan->reg.base->rxf1a;
-		break;
+		access->status = mcan->reg.base->rxf1s;
+		access->address = mcan->rxFifo1.address;
+		access->size = mcan->rxFifo1.size;
+		access->elementSize = mcan->rxFifo1.elementSize;
+		access->ackReg = &mcan->reg.base->rxf1a;
+		return access->address != NULL;
 	}
 
-	if (fifoAddress == NULL)
+	return false;
+}
+
+static const uint32_t *
+getRxFifoElementAddress(const RxFifoAccess *const access, const uint32_t index)
+{
+	return &access->address[(access->elementSize * index)
+			/ sizeof(uint32_t)];
+}
+
+bool
+Mcan_rxFifoPull(Mcan *const mcan, const Mcan_RxFifoId id,
+		Mcan_RxElement *const element, ErrorCode *const errCode)
+{
+	assert(mcan != NULL);
+	RxFifoAccess access;
+
+	if (!getRxFifoAccess(mcan, id, &access))
 		return returnError(errCode, Mcan_ErrorCode_InvalidRxFifoId);
 
-	const uint8_t count = (uint8_t)GET_FIELD_VALUE(MCAN_RXF0S_F0FL, rxfs);
+	const uint8_t count =
+			(uint8_t)GET_FIELD_VALUE(MCAN_RXF0S_F0FL, access.status);
 	if (count == 0u)
 		return returnError(errCode, Mcan_ErrorCode_RxFifoEmpty);
 	const uint8_t getIndex =
-			(uint8_t)GET_FIELD_VALUE(MCAN_RXF0S_F0GI, rxfs);
-	const uint32_t *const baseAddress =
-			&fifoAddress[(elementSize * getIndex)
-					/ sizeof(uint32_t)];
-	getRxElement(baseAddress, element);
-	*ackReg = getIndex;
+			(uint8_t)GET_FIELD_VALUE(MCAN_RXF0S_F0GI, access.status);
+	getRxElement(getRxFifoElementAddress(&access, getIndex), element);
+	*access.ackReg = getIndex;
+
+	return true;
+}
+
+bool
+Mcan_rxFifoPullBatch(Mcan *const mcan, const Mcan_RxFifoId id,
+		Mcan_RxElement *const elements, const uint8_t count,
+		uint8_t *const pulled, ErrorCode *const errCode)
+{
+	assert(mcan != NULL);
+	assert((elements != NULL) || (count == 0u));
+	assert(pulled != NULL);
+	RxFifoAccess access;
+
+	*pulled = 0u;
+
+	if (!getRxFifoAccess(mcan, id, &access))
+		return returnError(errCode, Mcan_ErrorCode_InvalidRxFifoId);
+
+	const uint32_t fillLevel =
+			GET_FIELD_VALUE(MCAN_RXF0S_F0FL, access.status);
+	if (fillLevel == 0u)
+		return returnError(errCode, Mcan_ErrorCode_RxFifoEmpty);
+
+	if (count == 0u)
+		return true;
+
+	const uint32_t pullCount =
+			((uint32_t)count < fillLevel) ? count : fillLevel;
+	uint32_t index = GET_FIELD_VALUE(MCAN_RXF0S_F0GI, access.status);
+
+	for (uint32_t i = 0u; i < pullCount; i++) {
+		if (i != 0u) {
+			index++;
+			if (index >= access.size)
+				index = 0u;
+		}
+		decodeRxElement(getRxFifoElementAddress(&access, index),
+				&elements[i]);
+	}
+
+	MEMORY_SYNC_BARRIER();
+
+	// Acknowledging an index releases all elements up to and including it.
+	*access.ackReg = index;
+
+	*pulled = (uint8_t)pullCount;
+
+	return true;
+}
+
+static void
+getRxElementView(const uint32_t *const baseAddr,
+		Mcan_RxElementView *const view)
+{
+	view->r0 = baseAddr[MCAN_RXELEMENT_ESI_WORD];
+	view->r1 = baseAddr[MCAN_RXELEMENT_ANMF_WORD];
+	view->data = (const uint8_t *)&baseAddr[MCAN_RXELEMENT_DATA_WORD];
+}
+
+bool
+Mcan_rxFifoPeekView(const Mcan *const mcan, const Mcan_RxFifoId id,
+		Mcan_RxElementView *const view, ErrorCode *const errCode)
+{
+	assert(mcan != NULL);
+	RxFifoAccess access;
+
+	if (!getRxFifoAccess(mcan, id, &access))
+		return returnError(errCode, Mcan_ErrorCode_InvalidRxFifoId);
+
+	if (GET_FIELD_VALUE(MCAN_RXF0S_F0FL, access.status) == 0u)
+		return returnError(errCode, Mcan_ErrorCode_RxFifoEmpty);
+
+	const uint32_t getIndex =
+			GET_FIELD_VALUE(MCAN_RXF0S_F0GI, access.status);
+	getRxElementView(getRxFifoElementAddress(&access, getIndex), view);
+
+	return true;
+}
+
+bool
+Mcan_rxFifoDrop(Mcan *const mcan, const Mcan_RxFifoId id,
+		ErrorCode *const errCode)
+{
+	assert(mcan != NULL);
+	RxFifoAccess access;
+
+	if (!getRxFifoAccess(mcan, id, &access))
+		return returnError(errCode, Mcan_ErrorCode_InvalidRxFifoId);
+
+	if (GET_FIELD_VALUE(MCAN_RXF0S_F0FL, access.status) == 0u)
+		return returnError(errCode, Mcan_ErrorCode_RxFifoEmpty);
+
+	MEMORY_SYNC_BARRIER();
+
+	*access.ackReg = GET_FIELD_VALUE(MCAN_RXF0S_F0GI, access.status);
 
 	return true;
 }
 
+void
+Mcan_rxBufferGetView(const Mcan *const mcan, const uint8_t index,
+		Mcan_RxElementView *const view)
+{
+	const uint32_t *const bufferPointer =
+			&mcan->rxBufferAddress
+					 [(mcan->rxBufferElementSize
+							  * (uint32_t)index)
+							 / sizeof(uint32_t)];
+
+	getRxElementView(bufferPointer, view);
+}
+
 bool
 Mcan_getRxFifoStatus(const Mcan *const mcan, const Mcan_RxFifoId id,
 		Mcan_RxFifoStatus *const status, ErrorCode *const errCode)
@@ -1144,7 +1648,8 @@ Mcan_setExtendedIdFilter(Mcan *const mcan, const Mcan_RxFilterElement element,
 								  * index)
 					/ sizeof(uint32_t)];
 
-	(void)memset(bufferPointer, 0, MCAN_EXTRXFILTERELEMENT_SIZE);
+	Memory_fillWords(bufferPointer, 0u,
+			MCAN_EXTRXFILTERELEMENT_SIZE / sizeof(uint32_t));
 
 	bufferPointer[MCAN_EXTRXFILTERELEMENT_EFT_WORD] |= BIT_FIELD_VALUE(
 			MCAN_EXTRXFILTERELEMENT_EFT, element.type);
@@ -1198,9 +1703,285 @@ Mcan_getInterruptStatus(
 bool
 Mcan_isTxFifoEmpty(const Mcan *const mcan)
 {
-	const uint32_t freeLevel =
-			GET_FIELD_VALUE(MCAN_TXFQS_TFFL, mcan->reg.base->txfqs);
-	const uint32_t queueSize =
-			GET_FIELD_VALUE(MCAN_TXBC_TFQS, mcan->reg.base->txbc);
+	const uint32_t txbc = mcan->reg.base->txbc;
+	const uint32_t freeMask = getTxQueueMask(mcan) & ~mcan->reg.base->txbrp;
+	const uint32_t freeLevel = getTxQueueFreeCount(
+			txbc, mcan->reg.base->txfqs, freeMask);
+	const uint32_t queueSize = GET_FIELD_VALUE(MCAN_TXBC_TFQS, txbc);
 	return freeLevel == queueSize;
 }
+
+static bool
+moveRxFrame(const RxFifoAccess *const access, const uint32_t index,
+		StructFifo *const ring)
+{
+	Mcan_RxFrame *const frame = StructFifo_reserve(ring);
+	if (frame == NULL)
+		return false;
+
+	const uint32_t *const baseAddr =
+			getRxFifoElementAddress(access, index);
+	frame->r0 = baseAddr[MCAN_RXELEMENT_ESI_WORD];
+	frame->r1 = baseAddr[MCAN_RXELEMENT_ANMF_WORD];
+
+	const Mcan_RxElementView view = {
+		.r0 = frame->r0, .r1 = frame->r1, .data = NULL
+	};
+	uint32_t dataSize = Mcan_rxViewGetDataSize(&view);
+	const uint32_t storedSize = access->elementSize
+			- (MCAN_RXELEMENT_DATA_WORD * sizeof(uint32_t));
+	if (dataSize > storedSize)
+		dataSize = storedSize;
+
+	Memory_readWords(frame->data, &baseAddr[MCAN_RXELEMENT_DATA_WORD],
+			dataSize);
+
+	StructFifo_commit(ring);
+	return true;
+}
+
+static uint32_t
+drainRxFifo(Mcan *const mcan, const Mcan_RxFifoId id, StructFifo *const ring)
+{
+	RxFifoAccess access;
+	if (!getRxFifoAccess(mcan, id, &access))
+		return 0u;
+
+	const uint32_t fillLevel =
+			GET_FIELD_VALUE(MCAN_RXF0S_F0FL, access.status);
+	uint32_t index = GET_FIELD_VALUE(MCAN_RXF0S_F0GI, access.status);
+	uint32_t lastIndex = index;
+	uint32_t moved = 0u;
+
+	while (moved < fillLevel) {
+		if (!moveRxFrame(&access, index, ring))
+			break;
+		lastIndex = index;
+		index++;
+		if (index >= access.size)
+			index = 0u;
+		moved++;
+	}
+
+	if (moved == 0u)
+		return 0u;
+
+	MEMORY_SYNC_BARRIER();
+	*access.ackReg = lastIndex;
+
+	return moved;
+}
+
+static void
+handleRxFifoInterrupt(
+		Mcan *const mcan, const Mcan_RxFifoId id, StructFifo *const ring)
+{
+	if ((drainRxFifo(mcan, id, ring) != 0u)
+			&& (mcan->interruptHandler.rxCallback != NULL))
+		mcan->interruptHandler.rxCallback(
+				id, mcan->interruptHandler.rxCallbackArg);
+}
+
+static uint32_t
+refillTxQueue(Mcan *const mcan)
+{
+	StructFifo *const ring = mcan->interruptHandler.txRing;
+
+	const uint32_t txfqs = mcan->reg.base->txfqs;
+	if (IS_BIT_SET(MCAN_TXFQS_TFQF, txfqs))
+		return 0u;
+
+	const uint32_t txbc = mcan->reg.base->txbc;
+	const uint32_t freeMask = getTxQueueMask(mcan) & ~mcan->reg.base->txbrp;
+	const uint32_t freeLevel = getTxQueueFreeCount(txbc, txfqs, freeMask);
+	uint8_t index = (uint8_t)GET_FIELD_VALUE(MCAN_TXFQS_TFQPI, txfqs);
+
+	uint32_t requestMask = 0u;
+	uint32_t moved = 0u;
+	while (moved < freeLevel) {
+		const Mcan_TxFrame *const frame = StructFifo_front(ring);
+		if (frame == NULL)
+			break;
+
+		uint32_t *const baseAddr = getTxElementAddress(mcan, index);
+		baseAddr[MCAN_TXELEMENT_ESI_WORD] = frame->t0;
+		baseAddr[MCAN_TXELEMENT_MM_WORD] = frame->t1;
+		Memory_writeWords(&baseAddr[MCAN_TXELEMENT_DATA_WORD],
+				frame->data, frame->dataSize);
+		StructFifo_release(ring);
+
+		requestMask |= shiftBitLeft(true, index);
+		index = txQueueNextIndex(mcan, txbc, index, freeMask);
+		moved++;
+	}
+
+	if (requestMask != 0u) {
+		MEMORY_SYNC_BARRIER();
+		mcan->reg.base->txbar = requestMask;
+	}
+
+	return moved;
+}
+
+void
+Mcan_setInterruptHandler(Mcan *const mcan, const Mcan_InterruptHandler handler)
+{
+	assert(mcan != NULL);
+	assert((handler.rxFifo0Ring == NULL)
+			|| (handler.rxFifo0Ring->elementSize
+					== sizeof(Mcan_RxFrame)));
+	assert((handler.rxFifo1Ring == NULL)
+			|| (handler.rxFifo1Ring->elementSize
+					== sizeof(Mcan_RxFrame)));
+	assert((handler.txRing == NULL)
+			|| (handler.txRing->elementSize
+					== sizeof(Mcan_TxFrame)));
+
+	mcan->reg.base->ie &= ~(MCAN_IE_RF0NE_MASK | MCAN_IE_RF1NE_MASK
+			| MCAN_IE_TCE_MASK);
+
+	mcan->interruptHandler = handler;
+
+	if (handler.txRing != NULL)
+		mcan->reg.base->txbtie |= getTxQueueMask(mcan);
+
+	mcan->reg.base->ir = MCAN_IR_RF0N_MASK | MCAN_IR_RF1N_MASK
+			| MCAN_IR_TC_MASK;
+	mcan->reg.base->ie |= BIT_VALUE(MCAN_IE_RF0NE,
+					      handler.rxFifo0Ring != NULL)
+			| BIT_VALUE(MCAN_IE_RF1NE, handler.rxFifo1Ring != NULL)
+			| BIT_VALUE(MCAN_IE_TCE, handler.txRing != NULL);
+}
+
+bool
+Mcan_txSubmit(Mcan *const mcan, const Mcan_TxElement element,
+		ErrorCode *const errCode)
+{
+	assert(mcan != NULL);
+	assert(element.dataSize <= MCAN_FRAME_DATA_SIZE_MAX);
+
+	StructFifo *const ring = mcan->interruptHandler.txRing;
+	if (ring == NULL)
+		return returnError(errCode, Mcan_ErrorCode_TxRingFull);
+
+	// The transmission completed interrupt is masked, so that the ring and
+	// the Tx Queue are not accessed concurrently by the interrupt handler.
+	const uint32_t ie = mcan->reg.base->ie;
+	mcan->reg.base->ie = ie & ~MCAN_IE_TCE_MASK;
+
+	bool isSubmitted = false;
+	ErrorCode submitError = Mcan_ErrorCode_TxRingFull;
+	Mcan_TxFrame *const frame = StructFifo_reserve(ring);
+	if (frame != NULL) {
+		if (encodeTxHeader(&element, &frame->t0, &frame->t1)) {
+			if (element.dataSize != 0u)
+				Memory_copy(frame->data, element.data,
+						element.dataSize);
+			frame->dataSize = element.dataSize;
+			StructFifo_commit(ring);
+			(void)refillTxQueue(mcan);
+			isSubmitted = true;
+		} else {
+			submitError = Mcan_ErrorCode_ElementSizeInvalid;
+		}
+	}
+
+	mcan->reg.base->ie = ie;
+
+	if (!isSubmitted)
+		return returnError(errCode, submitError);
+
+	return true;
+}
+
+static inline StructFifo *
+getRxRing(const Mcan *const mcan, const Mcan_RxFifoId id)
+{
+	return (id == Mcan_RxFifoId_0) ? mcan->interruptHandler.rxFifo0Ring
+				       : mcan->interruptHandler.rxFifo1Ring;
+}
+
+// The new message interrupt is masked, so that the ring and the Rx FIFO
+// are not accessed concurrently by the interrupt handler. A message
+// received meanwhile raises the interrupt once it is unmasked.
+static inline uint32_t
+maskRxNewMessageIrq(Mcan *const mcan, const Mcan_RxFifoId id)
+{
+	const uint32_t ie = mcan->reg.base->ie;
+	mcan->reg.base->ie = ie
+			& ~((id == Mcan_RxFifoId_0) ? MCAN_IE_RF0NE_MASK
+						    : MCAN_IE_RF1NE_MASK);
+	return ie;
+}
+
+uint32_t
+Mcan_rxResume(Mcan *const mcan, const Mcan_RxFifoId id)
+{
+	assert(mcan != NULL);
+
+	StructFifo *const ring = getRxRing(mcan, id);
+	if (ring == NULL)
+		return 0u;
+
+	const uint32_t ie = maskRxNewMessageIrq(mcan, id);
+
+	const uint32_t moved = drainRxFifo(mcan, id, ring);
+
+	mcan->reg.base->ie = ie;
+
+	return moved;
+}
+
+bool
+Mcan_rxRingPull(Mcan *const mcan, const Mcan_RxFifoId id,
+		Mcan_RxFrame *const frame)
+{
+	assert(mcan != NULL);
+	assert(frame != NULL);
+
+	StructFifo *const ring = getRxRing(mcan, id);
+	if (ring == NULL)
+		return false;
+
+	const uint32_t ie = maskRxNewMessageIrq(mcan, id);
+
+	const bool wasFull = StructFifo_isFull(ring);
+	const bool isPulled = StructFifo_pull(ring, frame);
+	// Frames left in the Rx FIFO by a full ring raise no further interrupt.
+	if (isPulled && wasFull)
+		(void)drainRxFifo(mcan, id, ring);
+
+	mcan->reg.base->ie = ie;
+
+	return isPulled;
+}
+
+void
+Mcan_handleInterrupt(Mcan *const mcan)
+{
+	assert(mcan != NULL);
+
+	const uint32_t flags = mcan->reg.base->ir & mcan->reg.base->ie;
+	mcan->reg.base->ir = flags;
+
+	if (((flags & MCAN_IR_RF0N_MASK) != 0u)
+			&& (mcan->interruptHandler.rxFifo0Ring != NULL))
+		handleRxFifoInterrupt(mcan, Mcan_RxFifoId_0,
+				mcan->interruptHandler.rxFifo0Ring);
+
+	if (((flags & MCAN_IR_RF1N_MASK) != 0u)
+			&& (mcan->interruptHandler.rxFifo1Ring != NULL))
+		handleRxFifoInterrupt(mcan, Mcan_RxFifoId_1,
+				mcan->interruptHandler.rxFifo1Ring);
+
+	if (((flags & MCAN_IR_TC_MASK) != 0u)
+			&& (mcan->interruptHandler.txRing != NULL)) {
+		const uint32_t moved = refillTxQueue(mcan);
+		if ((moved != 0u)
+				&& StructFifo_isEmpty(
+						mcan->interruptHandler.txRing)
+				&& (mcan->interruptHandler.txCallback != NULL))
+			mcan->interruptHandler.txCallback(
+					mcan->interruptHandler.txCallbackArg);
+	}
+}
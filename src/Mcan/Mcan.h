@@ -31,7 +31,9 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include <Dwt/Dwt.h>
 #include <Utils/ErrorCode.h>
+#include <Utils/StructFifo.h>
 
 #include "McanRegisters.h"
 
@@ -65,6 +67,20 @@ typedef enum {
 	Mcan_ErrorCode_ElementSizeInvalid = ERROR_CODE_DEFINE('C', 'A', 'N', 8),
 	/// \brief Invalid operation mode was requested.
 	Mcan_ErrorCode_ModeInvalid = ERROR_CODE_DEFINE('C', 'A', 'N', 9),
+	/// \brief Software TX ring is full or not configured.
+	Mcan_ErrorCode_TxRingFull = ERROR_CODE_DEFINE('C', 'A', 'N', 10),
+	/// \brief Software filter bank has no room for another route.
+	Mcan_ErrorCode_FilterBankFull = ERROR_CODE_DEFINE('C', 'A', 'N', 11),
+	/// \brief Filter list is too small for the requested Ids.
+	Mcan_ErrorCode_FilterListTooSmall =
+			ERROR_CODE_DEFINE('C', 'A', 'N', 12),
+	/// \brief Message RAM layout exceeds the hardware limits.
+	Mcan_ErrorCode_LayoutInvalid = ERROR_CODE_DEFINE('C', 'A', 'N', 13),
+	/// \brief Message RAM area is too small for the requested layout.
+	Mcan_ErrorCode_MessageRamTooSmall =
+			ERROR_CODE_DEFINE('C', 'A', 'N', 14),
+	/// \brief Tx scheduler has no room for another frame.
+	Mcan_ErrorCode_TxSchedulerFull = ERROR_CODE_DEFINE('C', 'A', 'N', 15),
 } Mcan_ErrorCode;
 
 /// \brief Mcan device identifiers.
@@ -490,6 +506,61 @@ typedef struct {
 	uint8_t *data; ///< Data pointer;
 } Mcan_RxElement;
 
+/// \brief Zero-copy view of an Mcan Rx element located in message RAM.
+/// \details Header words are captured at the time the view is obtained, the
+///          payload is referenced in place and stays valid only until the
+///          element is released.
+typedef struct {
+	uint32_t r0; ///< Raw R0 header word (ESI, XTD, RTR, ID).
+	uint32_t r1; ///< Raw R1 header word (ANMF, FIDX, FDF, BRS, DLC, RXTS).
+	const uint8_t *data; ///< Pointer to the payload within message RAM.
+} Mcan_RxElementView;
+
+/// \brief Maximum number of data bytes in a CAN FD frame.
+#define MCAN_FRAME_DATA_SIZE_MAX 64u
+
+/// \brief Self-contained Rx frame stored in a software Rx ring.
+typedef struct {
+	uint32_t r0; ///< Raw R0 header word (ESI, XTD, RTR, ID).
+	uint32_t r1; ///< Raw R1 header word (ANMF, FIDX, FDF, BRS, DLC, RXTS).
+	uint8_t data[MCAN_FRAME_DATA_SIZE_MAX]; ///< Frame payload.
+} Mcan_RxFrame;
+
+/// \brief Self-contained Tx frame stored in a software Tx ring.
+/// \details Header words are encoded when the frame is submitted, so that the
+///          interrupt handler only copies the frame to the message RAM. There
+///          is no per-frame interrupt flag: the ring keeps the transmission
+///          interrupt enabled for every Tx Queue element, as it is refilled on
+///          transmission completion.
+typedef struct {
+	uint32_t t0; ///< Encoded T0 header word (ESI, XTD, RTR, ID).
+	uint32_t t1; ///< Encoded T1 header word (MM, EFC, FDF, BRS, DLC).
+	uint8_t data[MCAN_FRAME_DATA_SIZE_MAX]; ///< Frame payload.
+	uint8_t dataSize; ///< Number of payload bytes.
+} Mcan_TxFrame;
+
+/// \brief Callback called after received frames were moved to a software Rx ring.
+typedef void (*McanRxCallback)(const Mcan_RxFifoId id, void *arg);
+
+/// \brief Callback called after the software Tx ring became empty.
+typedef void (*McanTxCallback)(void *arg);
+
+/// \brief Mcan interrupt-driven operation descriptor.
+/// \details Rings are StructFifo instances holding ::Mcan_RxFrame or
+///          ::Mcan_TxFrame elements; a NULL ring leaves the respective path
+///          for polling. StructFifo is not safe for concurrent access, so Rx
+///          rings shall be read only with ::Mcan_rxRingPull and the Tx ring
+///          written only with ::Mcan_txSubmit, never directly.
+typedef struct {
+	StructFifo *rxFifo0Ring; ///< Software ring receiving Rx FIFO 0 frames.
+	StructFifo *rxFifo1Ring; ///< Software ring receiving Rx FIFO 1 frames.
+	StructFifo *txRing; ///< Software ring refilling the Tx Queue.
+	McanRxCallback rxCallback; ///< Frames received callback.
+	void *rxCallbackArg; ///< Frames received callback argument.
+	McanTxCallback txCallback; ///< Tx ring empty callback.
+	void *txCallbackArg; ///< Tx ring empty callback argument.
+} Mcan_InterruptHandler;
+
 /// \brief The type of Rx filter.
 typedef enum {
 	Mcan_RxFilterType_Range = 0, ///< Range filter; id1 <= id <= id2.
@@ -522,6 +593,46 @@ typedef struct {
 	uint32_t id2; ///< Filter Id2; bits [10:0] for standard Id, [28:0] for extended Id.
 } Mcan_RxFilterElement;
 
+/// \brief Message RAM size of an Rx or Tx element with the given data size.
+/// \param [in] dataSize Element data field size in bytes (8, 12, ..., 64).
+// clang-format off
+#define MCAN_ELEMENT_BYTES(dataSize) (8u + (uint32_t)(dataSize))
+// clang-format on
+
+/// \brief Message RAM size (in bytes) required by a single Mcan layout.
+/// \details Usable in constant expressions, e.g. to size the message RAM
+///          buffer shared by both Mcan instances at compile time.
+///          All sections are multiples of 32-bit words, so packing them
+///          back to back keeps every section aligned.
+// clang-format off
+#define MCAN_MESSAGE_RAM_BYTES(stdFilters, extFilters, rxFifo0Count, rxFifo0DataSize, \
+		rxFifo1Count, rxFifo1DataSize, rxBufferCount, rxBufferDataSize, \
+		txEventCount, txCount, txDataSize) \
+	(((uint32_t)(stdFilters) * MCAN_STDRXFILTERELEMENT_SIZE) \
+	+ ((uint32_t)(extFilters) * MCAN_EXTRXFILTERELEMENT_SIZE) \
+	+ ((uint32_t)(rxFifo0Count) * MCAN_ELEMENT_BYTES(rxFifo0DataSize)) \
+	+ ((uint32_t)(rxFifo1Count) * MCAN_ELEMENT_BYTES(rxFifo1DataSize)) \
+	+ ((uint32_t)(rxBufferCount) * MCAN_ELEMENT_BYTES(rxBufferDataSize)) \
+	+ ((uint32_t)(txEventCount) * MCAN_TXEVENTELEMENT_SIZE) \
+	+ ((uint32_t)(txCount) * MCAN_ELEMENT_BYTES(txDataSize)))
+// clang-format on
+
+/// \brief Requested message RAM layout of a single Mcan instance.
+typedef struct {
+	uint8_t standardFilterCount; ///< Number of standard Id filters (0-128).
+	uint8_t extendedFilterCount; ///< Number of extended Id filters (0-64).
+	uint8_t rxFifo0Count; ///< Number of Rx FIFO 0 elements (0-64).
+	Mcan_ElementSize rxFifo0ElementSize; ///< Rx FIFO 0 element data size.
+	uint8_t rxFifo1Count; ///< Number of Rx FIFO 1 elements (0-64).
+	Mcan_ElementSize rxFifo1ElementSize; ///< Rx FIFO 1 element data size.
+	uint8_t rxBufferCount; ///< Number of dedicated Rx Buffers (0-64).
+	Mcan_ElementSize rxBufferElementSize; ///< Rx Buffer element data size.
+	uint8_t txEventFifoCount; ///< Number of Tx Event FIFO elements (0-32).
+	uint8_t txBufferCount; ///< Number of dedicated Tx Buffers.
+	uint8_t txQueueCount; ///< Number of Tx FIFO/Queue elements.
+	Mcan_ElementSize txElementSize; ///< Tx element data size.
+} Mcan_MessageRamLayout;
+
 /// \brief Mcan Tx descriptor
 typedef struct {
 	uint32_t *bufferAddress; ///< Address (32-bit) of the Tx Buffer within message RAM.
@@ -538,6 +649,10 @@ typedef struct {
 	uint8_t elementSize; ///< Size of the data field (in bytes) of the Rx Element in FIFO.
 } Mcan_RxFifo;
 
+/// \brief Hook called for every Tx Event element pulled from the Tx Event FIFO.
+typedef void (*McanTxEventHook)(
+		const Mcan_TxEventElement *const element, void *arg);
+
 /// \brief Mcan device descriptor.
 typedef struct {
 	uint32_t *msgRamBaseAddress; ///< Base address of the message ram;
@@ -553,6 +668,9 @@ typedef struct {
 	uint8_t rxStdFilterSize; ///< Size (number of 32-bit words) of the Standard Id filter.
 	uint32_t *rxExtFilterAddress; ///< Address (32-bit) of the Extended Id filter within message RAM.
 	uint8_t rxExtFilterSize; ///< Size (number of 32-bit words) of the Extended Id filter.
+	Mcan_InterruptHandler interruptHandler; ///< Interrupt-driven operation descriptor.
+	McanTxEventHook txEventHook; ///< Tx Event instrumentation hook.
+	void *txEventHookArg; ///< Tx Event instrumentation hook argument.
 } Mcan;
 
 /// \brief Returns Mcan registers base address.
@@ -575,11 +693,51 @@ void Mcan_init(Mcan *const mcan, const Mcan_Registers regs);
 bool Mcan_setConfig(Mcan *const mcan, const Mcan_Config *const config,
 		const uint32_t timeoutLimit, ErrorCode *const errCode);
 
+/// \brief Configures an Mcan device based on a configuration descriptor, waiting for
+///        the device until a deadline.
+/// \param [in] mcan Mcan device descriptor.
+/// \param [in] config A configuration descriptor.
+/// \param [in] deadline Deadline for the configuration process, started with
+///             ::Dwt_startDeadline.
+/// \param [out] errCode An error code generated during the operation.
+/// \retval true Configuration was successful.
+/// \retval false Configuration failed.
+bool Mcan_setConfigWithDeadline(Mcan *const mcan, const Mcan_Config *const config,
+		const Dwt_Deadline *const deadline, ErrorCode *const errCode);
+
 /// \brief Reads the current configuration of the Mcan device.
 /// \param [in] mcan Mcan device descriptor.
 /// \param [out] config A configuration descriptor.
 void Mcan_getConfig(const Mcan *const mcan, Mcan_Config *const config);
 
+/// \brief Computes the message RAM size required by the layout.
+/// \param [in] layout Message RAM layout.
+/// \returns Required size in bytes, or 0 if the layout is invalid.
+uint32_t Mcan_getMessageRamSize(const Mcan_MessageRamLayout *const layout);
+
+/// \brief Packs the message RAM sections of the layout into the given area
+///        and fills the respective addresses and sizes in the configuration.
+/// \details Sections are placed in the order: standard filters, extended
+///          filters, Rx FIFO 0, Rx FIFO 1, Rx Buffers, Tx Event FIFO and Tx
+///          Buffers with the Tx Queue. Sections with no elements are
+///          disabled. Enable flags, element sizes, addresses and counts are
+///          set; other settings (watermarks, filtering policies, modes) are
+///          left untouched. To place both Mcan instances in one area, call
+///          the function again with the area advanced by the used size.
+/// \param [in] layout Message RAM layout.
+/// \param [in] area Message RAM area, 32-bit aligned; all of it shall share
+///             the upper 16 address bits.
+/// \param [in] areaSize Message RAM area size in bytes.
+/// \param [in,out] config Configuration to fill.
+/// \param [out] usedSize Number of bytes taken from the area.
+/// \param [out] errCode An error code generated during the operation.
+/// \retval true Layout was applied.
+/// \retval false Layout is invalid or does not fit the area.
+bool Mcan_applyMessageRamLayout(const Mcan_MessageRamLayout *const layout,
+		uint32_t *const area, const uint32_t areaSize,
+		Mcan_Config *const config, uint32_t *const usedSize,
+		ErrorCode *const errCode);
+
 /// \brief Adds a new element to the Tx Buffer and initializes its transmission.
 /// \param [in] mcan Mcan device descriptor.
 /// \param [in] element Tx element to send.
@@ -600,6 +758,25 @@ bool Mcan_txBufferAdd(Mcan *const mcan, const Mcan_TxElement element,
 bool Mcan_txQueuePush(Mcan *const mcan, const Mcan_TxElement element,
 		uint8_t *const index, ErrorCode *const errCode);
 
+/// \brief Adds multiple elements to the Tx Queue and initializes their
+///        transmission with a single request.
+/// \details The Tx Queue status is read once, as many elements as fit into
+///          the free Tx Queue slots are written to the message RAM and their
+///          transmission is requested with a single write to TXBAR.
+///          Elements which did not fit are not added and shall be pushed
+///          again later.
+/// \param [in] mcan Mcan device descriptor.
+/// \param [in] elements Array of Tx elements to send.
+/// \param [in] count Number of elements in the array.
+/// \param [out] pushed Number of elements added to the Tx Queue.
+/// \param [out] errCode An error code generated during the operation.
+/// \retval true Adding elements was successful (possibly only a part of them).
+/// \retval false Tx Queue was full or an invalid element was encountered;
+///         elements preceding the invalid one are still transmitted.
+bool Mcan_txQueuePushBatch(Mcan *const mcan,
+		const Mcan_TxElement *const elements, const uint8_t count,
+		uint8_t *const pushed, ErrorCode *const errCode);
+
 /// \brief Checks whether the specified Tx Buffer or Queue element was sent.
 /// \param [in] mcan Mcan device descriptor.
 /// \param [in] index Queried element index.
@@ -608,6 +785,13 @@ bool Mcan_txQueuePush(Mcan *const mcan, const Mcan_TxElement element,
 bool Mcan_txBufferIsTransmissionFinished(
 		const Mcan *const mcan, const uint8_t index);
 
+/// \brief Returns the mask of Tx Buffer and Queue elements that were sent.
+/// \details Reads the "Transmission Occurred" register once; a bit is cleared when a new
+///          transmission of the element is requested.
+/// \param [in] mcan Mcan device descriptor.
+/// \returns Bit mask indexed by element index.
+uint32_t Mcan_txBufferGetFinishedMask(const Mcan *const mcan);
+
 /// \brief Pulls element the Tx Event Queue.
 /// \param [in] mcan Mcan device descriptor.
 /// \param [out] element Tx Event element pointer.
@@ -617,6 +801,28 @@ bool Mcan_txBufferIsTransmissionFinished(
 bool Mcan_txEventFifoPull(const Mcan *const mcan,
 		Mcan_TxEventElement *const element, ErrorCode *const errCode);
 
+/// \brief Pulls multiple elements from the Tx Event Queue.
+/// \details The Tx Event FIFO status is read once, up to count elements are
+///          decoded and only the last one is acknowledged.
+/// \param [in] mcan Mcan device descriptor.
+/// \param [out] elements Array of Tx Event elements to fill.
+/// \param [in] count Number of elements in the array.
+/// \param [out] pulled Number of elements pulled from the Tx Event FIFO.
+/// \param [out] errCode An error code generated during the operation.
+/// \retval true Pulling elements was successful.
+/// \retval false Pulling elements failed.
+bool Mcan_txEventFifoPullBatch(const Mcan *const mcan,
+		Mcan_TxEventElement *const elements, const uint8_t count,
+		uint8_t *const pulled, ErrorCode *const errCode);
+
+/// \brief Sets a hook called for every pulled Tx Event element.
+/// \details Intended for instrumentation, e.g. ::McanLatency_handleTxEvent.
+/// \param [in] mcan Mcan device descriptor.
+/// \param [in] hook Hook function, NULL to disable.
+/// \param [in] arg Hook function argument.
+void Mcan_setTxEventHook(
+		Mcan *const mcan, const McanTxEventHook hook, void *arg);
+
 /// \brief Receives element from the Rx Buffer.
 /// \param [in] mcan Mcan device descriptor.
 /// \param [in] index Index of the Rx element to obtain.
@@ -634,6 +840,175 @@ void Mcan_rxBufferGet(const Mcan *const mcan, const uint8_t index,
 bool Mcan_rxFifoPull(Mcan *const mcan, const Mcan_RxFifoId id,
 		Mcan_RxElement *const element, ErrorCode *const errCode);
 
+/// \brief Pulls multiple elements from the Rx Fifo.
+/// \details The Rx Fifo status is read once, up to count elements are decoded
+///          from consecutive Rx Fifo slots and only the last one is
+///          acknowledged, which releases all the preceding elements as well.
+/// \param [in] mcan Mcan device descriptor.
+/// \param [in] id The id of the Rx Fifo.
+/// \param [out] elements Array of Rx elements to fill; data pointers of the
+///             elements shall point to buffers large enough for the
+///             configured element size.
+/// \param [in] count Number of elements in the array.
+/// \param [out] pulled Number of elements pulled from the Rx Fifo.
+/// \param [out] errCode An error code generated during the operation.
+/// \retval true Pulling elements was successful.
+/// \retval false Pulling elements failed.
+bool Mcan_rxFifoPullBatch(Mcan *const mcan, const Mcan_RxFifoId id,
+		Mcan_RxElement *const elements, const uint8_t count,
+		uint8_t *const pulled, ErrorCode *const errCode);
+
+/// \brief Obtains a zero-copy view of the oldest element in the Rx Fifo.
+/// \details The element is not removed from the Rx Fifo; ::Mcan_rxFifoDrop
+///          shall be called once the payload is no longer referenced.
+/// \param [in] mcan Mcan device descriptor.
+/// \param [in] id The id of the Rx Fifo.
+/// \param [out] view Rx element view pointer.
+/// \param [out] errCode An error code generated during the operation.
+/// \retval true Obtaining the view was successful.
+/// \retval false Obtaining the view failed.
+bool Mcan_rxFifoPeekView(const Mcan *const mcan, const Mcan_RxFifoId id,
+		Mcan_RxElementView *const view, ErrorCode *const errCode);
+
+/// \brief Removes the oldest element from the Rx Fifo without reading it.
+/// \param [in] mcan Mcan device descriptor.
+/// \param [in] id The id of the Rx Fifo.
+/// \param [out] errCode An error code generated during the operation.
+/// \retval true Removing the element was successful.
+/// \retval false Removing the element failed.
+bool Mcan_rxFifoDrop(Mcan *const mcan, const Mcan_RxFifoId id,
+		ErrorCode *const errCode);
+
+/// \brief Obtains a zero-copy view of the Rx Buffer element.
+/// \param [in] mcan Mcan device descriptor.
+/// \param [in] index Index of the Rx element.
+/// \param [out] view Rx element view pointer.
+void Mcan_rxBufferGetView(const Mcan *const mcan, const uint8_t index,
+		Mcan_RxElementView *const view);
+
+/// \brief Returns the type of CAN Id of the viewed element.
+/// \param [in] view Rx element view.
+/// \returns The type of CAN Id.
+static inline Mcan_IdType
+Mcan_rxViewGetIdType(const Mcan_RxElementView *const view)
+{
+	return ((view->r0 & MCAN_RXELEMENT_XTD_MASK) != 0u)
+			? Mcan_IdType_Extended
+			: Mcan_IdType_Standard;
+}
+
+/// \brief Returns the CAN Id of the viewed element.
+/// \param [in] view Rx element view.
+/// \returns CAN Id - 11 or 29 bit, depending on the Id type.
+static inline uint32_t
+Mcan_rxViewGetId(const Mcan_RxElementView *const view)
+{
+	if ((view->r0 & MCAN_RXELEMENT_XTD_MASK) != 0u)
+		return (view->r0 & MCAN_RXELEMENT_EXTID_MASK)
+				>> MCAN_RXELEMENT_EXTID_OFFSET;
+	return (view->r0 & MCAN_RXELEMENT_STDID_MASK)
+			>> MCAN_RXELEMENT_STDID_OFFSET;
+}
+
+/// \brief Returns the frame type of the viewed element.
+/// \param [in] view Rx element view.
+/// \returns The type of frame.
+static inline Mcan_FrameType
+Mcan_rxViewGetFrameType(const Mcan_RxElementView *const view)
+{
+	return ((view->r0 & MCAN_RXELEMENT_RTR_MASK) != 0u)
+			? Mcan_FrameType_Remote
+			: Mcan_FrameType_Data;
+}
+
+/// \brief Returns the ESI flag of the viewed element.
+/// \param [in] view Rx element view.
+/// \returns CAN FD ESI flag value.
+static inline Mcan_ElementEsi
+Mcan_rxViewGetEsiFlag(const Mcan_RxElementView *const view)
+{
+	return ((view->r0 & MCAN_RXELEMENT_ESI_MASK) != 0u)
+			? Mcan_ElementEsi_Recessive
+			: Mcan_ElementEsi_Dominant;
+}
+
+/// \brief Returns whether the viewed element did not match any filter.
+/// \param [in] view Rx element view.
+/// \returns Non-matching frame flag.
+static inline bool
+Mcan_rxViewIsNonMatchingFrame(const Mcan_RxElementView *const view)
+{
+	return (view->r1 & MCAN_RXELEMENT_ANMF_MASK) != 0u;
+}
+
+/// \brief Returns the index of the filter matched by the viewed element.
+/// \param [in] view Rx element view.
+/// \returns Matching filter index (valid for matching frames only).
+static inline uint8_t
+Mcan_rxViewGetFilterIndex(const Mcan_RxElementView *const view)
+{
+	return (uint8_t)((view->r1 & MCAN_RXELEMENT_FIDX_MASK)
+			>> MCAN_RXELEMENT_FIDX_OFFSET);
+}
+
+/// \brief Returns whether the viewed element is in CAN FD format.
+/// \param [in] view Rx element view.
+/// \returns CAN FD format flag.
+static inline bool
+Mcan_rxViewIsCanFdFormatEnabled(const Mcan_RxElementView *const view)
+{
+	return (view->r1 & MCAN_RXELEMENT_FDF_MASK) != 0u;
+}
+
+/// \brief Returns whether the viewed element was sent with bit rate switching.
+/// \param [in] view Rx element view.
+/// \returns Bit rate switching flag.
+static inline bool
+Mcan_rxViewIsBitRateSwitchingEnabled(const Mcan_RxElementView *const view)
+{
+	return (view->r1 & MCAN_RXELEMENT_BRS_MASK) != 0u;
+}
+
+/// \brief Returns the timestamp of the viewed element.
+/// \param [in] view Rx element view.
+/// \returns Frame timestamp.
+static inline uint16_t
+Mcan_rxViewGetTimestamp(const Mcan_RxElementView *const view)
+{
+	return (uint16_t)((view->r1 & MCAN_RXELEMENT_RXTS_MASK)
+			>> MCAN_RXELEMENT_RXTS_OFFSET);
+}
+
+/// \brief Returns the number of data bytes of the viewed element.
+/// \param [in] view Rx element view.
+/// \returns Number of data bytes decoded from the DLC field.
+static inline uint8_t
+Mcan_rxViewGetDataSize(const Mcan_RxElementView *const view)
+{
+	static const uint8_t fdDataSizes[] = { 12u, 16u, 20u, 24u, 32u, 48u,
+		64u };
+	const uint32_t dlc = (view->r1 & MCAN_RXELEMENT_DLC_MASK)
+			>> MCAN_RXELEMENT_DLC_OFFSET;
+
+	if (dlc <= 8u)
+		return (uint8_t)dlc;
+	if ((view->r1 & MCAN_RXELEMENT_FDF_MASK) == 0u)
+		return 8u;
+	return fdDataSizes[dlc - 9u];
+}
+
+/// \brief Obtains a view of an Rx frame stored in a software Rx ring.
+/// \param [in] frame Rx frame.
+/// \param [out] view Rx element view pointer, valid as long as the frame.
+static inline void
+Mcan_rxFrameGetView(const Mcan_RxFrame *const frame,
+		Mcan_RxElementView *const view)
+{
+	view->r0 = frame->r0;
+	view->r1 = frame->r1;
+	view->data = frame->data;
+}
+
 /// \brief Reads the status of the Rx Fifo.
 /// \param [in] mcan Mcan device descriptor.
 /// \param [in] id The id of the Rx Fifo.
@@ -684,6 +1059,68 @@ bool Mcan_setExtendedIdFilter(Mcan *const mcan,
 void Mcan_getInterruptStatus(
 		const Mcan *const mcan, Mcan_InterruptStatus *const status);
 
+/// \brief Sets up the interrupt-driven operation of the Mcan device.
+/// \details Enables the Rx FIFO new message interrupts for the configured Rx
+///          rings and the transmission completed interrupt for the Tx Queue
+///          when the Tx ring is configured. ::Mcan_handleInterrupt shall be
+///          called from the interrupt handler of the line those interrupts
+///          are routed to.
+/// \param [in] mcan Mcan device descriptor.
+/// \param [in] handler Interrupt-driven operation descriptor.
+void Mcan_setInterruptHandler(
+		Mcan *const mcan, const Mcan_InterruptHandler handler);
+
+/// \brief Checks whether a data field size can be encoded in the DLC field.
+/// \param [in] dataSize Data field size in bytes.
+/// \retval true Size is 0 to 8, 12, 16, 20, 24, 32, 48 or 64 bytes.
+/// \retval false Size cannot be encoded.
+bool Mcan_isDataSizeValid(const uint8_t dataSize);
+
+/// \brief Encodes the element and appends it to the software Tx ring.
+/// \details The element is moved to the Tx Queue immediately, if there is room
+///          in it, or from the interrupt handler on transmission completion.
+///          The element data is copied, so its buffer can be reused. The
+///          isInterruptEnabled flag of the element is ignored, every
+///          transmission from the Tx Queue raises the interrupt refilling it.
+/// \param [in] mcan Mcan device descriptor.
+/// \param [in] element Tx element to send.
+/// \param [out] errCode An error code generated during the operation.
+/// \retval true Submitting element was successful.
+/// \retval false Submitting element failed.
+bool Mcan_txSubmit(Mcan *const mcan, const Mcan_TxElement element,
+		ErrorCode *const errCode);
+
+/// \brief Pulls a frame from a software Rx ring.
+/// \details The new message interrupt of the Rx FIFO is masked during the
+///          pull, so that the ring is not modified concurrently by
+///          ::Mcan_handleInterrupt. When the ring was full, frames left in
+///          the Rx FIFO are moved into the freed space.
+/// \param [in] mcan Mcan device descriptor.
+/// \param [in] id Rx FIFO identifier.
+/// \param [out] frame Pulled frame.
+/// \retval true A frame was pulled.
+/// \retval false The ring is empty or not configured.
+bool Mcan_rxRingPull(Mcan *const mcan, const Mcan_RxFifoId id,
+		Mcan_RxFrame *const frame);
+
+/// \brief Moves frames left in an Rx FIFO into its software Rx ring.
+/// \details Frames remaining in the Rx FIFO after the ring became full raise
+///          no further interrupt. ::Mcan_rxRingPull resumes the transfer on its
+///          own; this function allows doing so explicitly, e.g. after
+///          ::Mcan_setInterruptHandler. The Rx callback is not called.
+/// \param [in] mcan Mcan device descriptor.
+/// \param [in] id Rx FIFO identifier.
+/// \returns Number of moved frames.
+uint32_t Mcan_rxResume(Mcan *const mcan, const Mcan_RxFifoId id);
+
+/// \brief Mcan interrupt handler for the interrupt-driven operation.
+/// \details Moves received frames from Rx FIFO 0/1 into the software Rx rings
+///          and refills the Tx Queue from the software Tx ring. Frames which
+///          do not fit into a full Rx ring remain in the Rx FIFO until the
+///          next interrupt, ::Mcan_rxRingPull or ::Mcan_rxResume call.
+/// \param [in] mcan Mcan device descriptor.
+void Mcan_handleInterrupt(Mcan *const mcan);
+
 /// \brief Resets the timeout counter value when in Continuous mode.
 /// \param [in] mcan Mcan device descriptor.
 static inline void
@@ -0,0 +1,186 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "McanFilterBank.h"
+
+#include <assert.h>
+#include <string.h>
+
+void
+McanFilterBank_init(McanFilterBank *const bank)
+{
+	assert(bank != NULL);
+
+	(void)memset(bank, 0, sizeof(McanFilterBank));
+}
+
+bool
+McanFilterBank_addRoute(McanFilterBank *const bank,
+		const McanFilterBank_Route route, uint8_t *const routeId,
+		ErrorCode *const errCode)
+{
+	assert(bank != NULL);
+	assert(route.callback != NULL);
+
+	if (bank->routeCount >= MCAN_FILTER_BANK_ROUTE_COUNT)
+		return returnError(errCode, Mcan_ErrorCode_FilterBankFull);
+
+	bank->routes[bank->routeCount] = route;
+	*routeId = bank->routeCount;
+	bank->routeCount++;
+
+	return true;
+}
+
+bool
+McanFilterBank_subscribe(McanFilterBank *const bank, const uint8_t routeId,
+		const uint16_t firstId, const uint16_t lastId,
+		ErrorCode *const errCode)
+{
+	assert(bank != NULL);
+	assert(firstId <= lastId);
+
+	if (routeId >= bank->routeCount)
+		return returnError(errCode, Mcan_ErrorCode_IndexOutOfRange);
+	if (lastId > MCAN_STANDARD_ID_MAX)
+		return returnError(errCode, Mcan_ErrorCode_IndexOutOfRange);
+
+	(void)memset(&bank->routeIndex[firstId], (int)routeId + 1,
+			(size_t)lastId - firstId + 1u);
+
+	return true;
+}
+
+void
+McanFilterBank_unsubscribe(McanFilterBank *const bank, const uint16_t firstId,
+		const uint16_t lastId)
+{
+	assert(bank != NULL);
+	assert(firstId <= lastId);
+	assert(lastId <= MCAN_STANDARD_ID_MAX);
+
+	(void)memset(&bank->routeIndex[firstId], 0,
+			(size_t)lastId - firstId + 1u);
+}
+
+bool
+McanFilterBank_dispatch(const McanFilterBank *const bank,
+		const Mcan_RxElementView *const view)
+{
+	assert(bank != NULL);
+	assert(view != NULL);
+
+	if (Mcan_rxViewGetIdType(view) != Mcan_IdType_Standard)
+		return false;
+
+	const uint8_t route = bank->routeIndex[Mcan_rxViewGetId(view)];
+	if (route == 0u)
+		return false;
+
+	const McanFilterBank_Route *const target = &bank->routes[route - 1u];
+	target->callback(view, target->arg);
+
+	return true;
+}
+
+static bool
+appendFilter(Mcan_RxFilterElement *const filters, const size_t maxFilters,
+		size_t *const filterCount, const Mcan_RxFilterElement filter)
+{
+	if (*filterCount >= maxFilters)
+		return false;
+
+	filters[*filterCount] = filter;
+	(*filterCount)++;
+	return true;
+}
+
+bool
+McanFilterBank_compileFilters(const uint16_t *const ids, const size_t idCount,
+		const Mcan_RxFilterConfig config,
+		Mcan_RxFilterElement *const filters, const size_t maxFilters,
+		size_t *const filterCount, ErrorCode *const errCode)
+{
+	assert((ids != NULL) || (idCount == 0u));
+	assert(filterCount != NULL);
+
+	*filterCount = 0u;
+
+	bool isSinglePending = false;
+	uint16_t pendingId = 0u;
+	size_t i = 0u;
+	while (i < idCount) {
+		assert(ids[i] <= MCAN_STANDARD_ID_MAX);
+
+		size_t runEnd = i;
+		while (((runEnd + 1u) < idCount)
+				&& (ids[runEnd + 1u] == (ids[runEnd] + 1u)))
+			runEnd++;
+		assert(((runEnd + 1u) >= idCount)
+				|| (ids[runEnd + 1u] > ids[runEnd]));
+
+		if (runEnd > i) {
+			const Mcan_RxFilterElement filter = {
+				.type = Mcan_RxFilterType_Range,
+				.config = config,
+				.id1 = ids[i],
+				.id2 = ids[runEnd],
+			};
+			if (!appendFilter(filters, maxFilters, filterCount,
+					    filter))
+				return returnError(errCode,
+						Mcan_ErrorCode_FilterListTooSmall);
+		} else if (isSinglePending) {
+			const Mcan_RxFilterElement filter = {
+				.type = Mcan_RxFilterType_Dual,
+				.config = config,
+				.id1 = pendingId,
+				.id2 = ids[i],
+			};
+			if (!appendFilter(filters, maxFilters, filterCount,
+					    filter))
+				return returnError(errCode,
+						Mcan_ErrorCode_FilterListTooSmall);
+			isSinglePending = false;
+		} else {
+			pendingId = ids[i];
+			isSinglePending = true;
+		}
+
+		i = runEnd + 1u;
+	}
+
+	if (isSinglePending) {
+		const Mcan_RxFilterElement filter = {
+			.type = Mcan_RxFilterType_Dual,
+			.config = config,
+			.id1 = pendingId,
+			.id2 = pendingId,
+		};
+		if (!appendFilter(filters, maxFilters, filterCount, filter))
+			return returnError(errCode,
+					Mcan_ErrorCode_FilterListTooSmall);
+	}
+
+	return true;
+}
@@ -0,0 +1,160 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file McanFilterBank.h
+/// \addtogroup Bsp
+/// \brief Mcan software acceptance filter bank function prototypes and datatypes.
+/// \details The filter bank extends the hardware filter list for standard
+///          CAN Ids. Frames stored as non-matching are looked up in a table
+///          indexed by the 11-bit Id and dispatched to the subscribed route.
+
+#ifndef BSP_MCANFILTERBANK_H
+#define BSP_MCANFILTERBANK_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Utils/ErrorCode.h>
+
+#include "Mcan.h"
+
+/// @addtogroup McanFilterBank
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Number of standard (11-bit) CAN Ids.
+#define MCAN_STANDARD_ID_COUNT 2048u
+
+/// \brief Largest standard CAN Id.
+#define MCAN_STANDARD_ID_MAX (MCAN_STANDARD_ID_COUNT - 1u)
+
+#ifndef MCAN_FILTER_BANK_ROUTE_COUNT
+/// \brief Maximum number of routes in a filter bank.
+#define MCAN_FILTER_BANK_ROUTE_COUNT 16u
+#endif
+
+/// \brief Callback called for a frame with a subscribed Id.
+typedef void (*McanFilterBankCallback)(
+		const Mcan_RxElementView *const view, void *arg);
+
+/// \brief Filter bank route, i.e. a dispatch target for subscribed Ids.
+typedef struct {
+	McanFilterBankCallback callback; ///< Dispatch callback.
+	void *arg; ///< Dispatch callback argument.
+} McanFilterBank_Route;
+
+/// \brief Software acceptance filter bank for standard CAN Ids.
+/// \details Lookup is a single table access; the table costs one byte per
+///          standard Id.
+typedef struct {
+	/// \brief Route of every Id; 0 - not subscribed, otherwise route id + 1.
+	uint8_t routeIndex[MCAN_STANDARD_ID_COUNT];
+	/// \brief Registered routes.
+	McanFilterBank_Route routes[MCAN_FILTER_BANK_ROUTE_COUNT];
+	/// \brief Number of registered routes.
+	uint8_t routeCount;
+} McanFilterBank;
+
+/// \brief Initializes an empty filter bank.
+/// \param [out] bank Filter bank.
+void McanFilterBank_init(McanFilterBank *const bank);
+
+/// \brief Registers a new route in the filter bank.
+/// \param [in,out] bank Filter bank.
+/// \param [in] route Route to register.
+/// \param [out] routeId Identifier of the registered route.
+/// \param [out] errCode An error code generated during the operation.
+/// \retval true Registering the route was successful.
+/// \retval false Registering the route failed.
+bool McanFilterBank_addRoute(McanFilterBank *const bank,
+		const McanFilterBank_Route route, uint8_t *const routeId,
+		ErrorCode *const errCode);
+
+/// \brief Subscribes a range of Ids to a route.
+/// \param [in,out] bank Filter bank.
+/// \param [in] routeId Identifier of the route.
+/// \param [in] firstId First subscribed Id.
+/// \param [in] lastId Last subscribed Id (inclusive).
+/// \param [out] errCode An error code generated during the operation.
+/// \retval true Subscribing was successful.
+/// \retval false Subscribing failed.
+bool McanFilterBank_subscribe(McanFilterBank *const bank,
+		const uint8_t routeId, const uint16_t firstId,
+		const uint16_t lastId, ErrorCode *const errCode);
+
+/// \brief Unsubscribes a range of Ids.
+/// \param [in,out] bank Filter bank.
+/// \param [in] firstId First unsubscribed Id.
+/// \param [in] lastId Last unsubscribed Id (inclusive).
+void McanFilterBank_unsubscribe(McanFilterBank *const bank,
+		const uint16_t firstId, const uint16_t lastId);
+
+/// \brief Checks whether the Id is subscribed.
+/// \param [in] bank Filter bank.
+/// \param [in] id Standard CAN Id.
+/// \retval true Id is subscribed.
+/// \retval false Id is not subscribed.
+static inline bool
+McanFilterBank_isSubscribed(const McanFilterBank *const bank, const uint32_t id)
+{
+	return (id <= MCAN_STANDARD_ID_MAX) && (bank->routeIndex[id] != 0u);
+}
+
+/// \brief Dispatches the frame to the route subscribed for its Id.
+/// \param [in] bank Filter bank.
+/// \param [in] view Rx element view of the frame.
+/// \retval true Frame was dispatched.
+/// \retval false Frame has an extended or unsubscribed Id.
+bool McanFilterBank_dispatch(const McanFilterBank *const bank,
+		const Mcan_RxElementView *const view);
+
+/// \brief Compiles a list of standard Ids into hardware filter elements.
+/// \details Runs of consecutive Ids are covered with range filters and the
+///          remaining single Ids are paired in dual filters, which gives the
+///          minimal number of filter elements for the list.
+/// \param [in] ids Ids to accept, in strictly ascending order.
+/// \param [in] idCount Number of Ids.
+/// \param [in] config Filter behaviour of the generated elements.
+/// \param [out] filters Generated filter elements.
+/// \param [in] maxFilters Capacity of the filters array.
+/// \param [out] filterCount Number of generated filter elements.
+/// \param [out] errCode An error code generated during the operation.
+/// \retval true Compilation was successful.
+/// \retval false The filters array is too small.
+bool McanFilterBank_compileFilters(const uint16_t *const ids,
+		const size_t idCount, const Mcan_RxFilterConfig config,
+		Mcan_RxFilterElement *const filters, const size_t maxFilters,
+		size_t *const filterCount, ErrorCode *const errCode);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_MCANFILTERBANK_H
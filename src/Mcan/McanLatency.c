@@ -0,0 +1,110 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "McanLatency.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <Utils/Bits.h>
+
+void
+McanLatency_init(McanLatency *const latency,
+		const McanTimestamp *const timestamp, const uint32_t bucketWidth)
+{
+	assert(latency != NULL);
+	assert(timestamp != NULL);
+	assert(bucketWidth > 0u);
+
+	(void)memset(latency, 0, sizeof(McanLatency));
+	latency->timestamp = timestamp;
+	latency->histogram.bucketWidth = bucketWidth;
+	latency->histogram.minLatency = UINT32_MAX;
+}
+
+void
+McanLatency_markEnqueued(McanLatency *const latency, const uint8_t marker)
+{
+	latency->enqueueTime[marker] =
+			(uint32_t)McanTimestamp_now(latency->timestamp);
+	atomicSetBits(&latency->pendingMarkers[marker / 32u],
+			shiftBitLeft(true, marker % 32u));
+}
+
+static void
+recordLatency(McanLatency_Histogram *const histogram, const uint32_t latency)
+{
+	uint32_t bucket = latency / histogram->bucketWidth;
+	if (bucket >= MCAN_LATENCY_BUCKET_COUNT)
+		bucket = MCAN_LATENCY_BUCKET_COUNT - 1u;
+
+	histogram->buckets[bucket]++;
+	histogram->sampleCount++;
+	if (latency < histogram->minLatency)
+		histogram->minLatency = latency;
+	if (latency > histogram->maxLatency)
+		histogram->maxLatency = latency;
+}
+
+void
+McanLatency_handleTxEvent(const Mcan_TxEventElement *const element, void *arg)
+{
+	McanLatency *const latency = arg;
+	assert(latency != NULL);
+
+	const uint8_t marker = element->marker;
+	const uint32_t markerBit = shiftBitLeft(true, marker % 32u);
+	if (atomicTakeBits(&latency->pendingMarkers[marker / 32u], markerBit)
+			== 0u) {
+		latency->histogram.unmatchedCount++;
+		return;
+	}
+
+	// Cancelled frames were never transmitted.
+	if (element->eventType != Mcan_TxEventType_Tx)
+		return;
+
+	const uint32_t eventTime = (uint32_t)McanTimestamp_extend(
+			latency->timestamp, element->timestamp);
+	// Modulo 2^32 difference remains valid across the time base wrap.
+	recordLatency(&latency->histogram,
+			eventTime - latency->enqueueTime[marker]);
+}
+
+void
+McanLatency_getHistogram(const McanLatency *const latency,
+		McanLatency_Histogram *const histogram)
+{
+	*histogram = latency->histogram;
+}
+
+void
+McanLatency_resetHistogram(McanLatency *const latency)
+{
+	const uint32_t bucketWidth = latency->histogram.bucketWidth;
+
+	(void)memset(&latency->histogram, 0, sizeof(McanLatency_Histogram));
+	latency->histogram.bucketWidth = bucketWidth;
+	latency->histogram.minLatency = UINT32_MAX;
+}
@@ -0,0 +1,115 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file McanLatency.h
+/// \addtogroup Bsp
+/// \brief Mcan Tx latency instrumentation function prototypes and datatypes.
+/// \details Frames are tagged with the Tx element marker when enqueued; the
+///          matching Tx Event element provides the transmission timestamp.
+///          The difference covers the time spent in the Tx Queue and in bus
+///          arbitration, and is accumulated in a histogram.
+
+#ifndef BSP_MCANLATENCY_H
+#define BSP_MCANLATENCY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "Mcan.h"
+#include "McanTimestamp.h"
+
+/// @addtogroup McanLatency
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Number of distinct Tx element markers.
+#define MCAN_LATENCY_MARKER_COUNT 256u
+
+#ifndef MCAN_LATENCY_BUCKET_COUNT
+/// \brief Number of latency histogram buckets.
+#define MCAN_LATENCY_BUCKET_COUNT 32u
+#endif
+
+/// \brief Latency histogram.
+typedef struct {
+	/// \brief Sample counts; the last bucket also holds all longer latencies.
+	uint32_t buckets[MCAN_LATENCY_BUCKET_COUNT];
+	uint32_t bucketWidth; ///< Width of a bucket in timestamp ticks.
+	uint32_t sampleCount; ///< Number of recorded samples.
+	uint32_t minLatency; ///< Shortest recorded latency in timestamp ticks.
+	uint32_t maxLatency; ///< Longest recorded latency in timestamp ticks.
+	uint32_t unmatchedCount; ///< Tx events without a recorded enqueue time.
+} McanLatency_Histogram;
+
+/// \brief Latency instrumentation descriptor.
+typedef struct {
+	const McanTimestamp *timestamp; ///< Time base shared with Mcan.
+	uint32_t enqueueTime[MCAN_LATENCY_MARKER_COUNT]; ///< Enqueue time by marker.
+	/// \brief Markers awaiting an event, shared with the interrupt handler.
+	volatile uint32_t pendingMarkers[MCAN_LATENCY_MARKER_COUNT / 32u];
+	McanLatency_Histogram histogram; ///< Accumulated histogram.
+} McanLatency;
+
+/// \brief Initializes the latency instrumentation.
+/// \param [out] latency Latency instrumentation descriptor.
+/// \param [in] timestamp Time base providing enqueue and event times.
+/// \param [in] bucketWidth Width of a histogram bucket in timestamp ticks.
+void McanLatency_init(McanLatency *const latency,
+		const McanTimestamp *const timestamp, const uint32_t bucketWidth);
+
+/// \brief Records the enqueue time of the frame with the given marker.
+/// \details Shall be called when the frame is pushed, with the element's
+///          isTxEventStored flag set.
+/// \param [in,out] latency Latency instrumentation descriptor.
+/// \param [in] marker Tx element marker.
+void McanLatency_markEnqueued(McanLatency *const latency, const uint8_t marker);
+
+/// \brief Records the latency of the frame described by the Tx Event element.
+/// \details Matches ::McanTxEventHook, so it can be registered with
+///          ::Mcan_setTxEventHook with the latency descriptor as argument.
+/// \param [in] element Tx Event element.
+/// \param [in,out] arg Latency instrumentation descriptor.
+void McanLatency_handleTxEvent(
+		const Mcan_TxEventElement *const element, void *arg);
+
+/// \brief Returns the accumulated histogram.
+/// \param [in] latency Latency instrumentation descriptor.
+/// \param [out] histogram Histogram copy.
+void McanLatency_getHistogram(const McanLatency *const latency,
+		McanLatency_Histogram *const histogram);
+
+/// \brief Clears the accumulated histogram, keeping pending markers.
+/// \param [in,out] latency Latency instrumentation descriptor.
+void McanLatency_resetHistogram(McanLatency *const latency);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_MCANLATENCY_H
@@ -91,7 +91,22 @@ typedef struct {
 #define MCAN_CHIPCFG_CANXDMABA_MASK 0xFFFF0000u
 #define MCAN_CHIPCFG_CANXDMABA_OFFSET 16u
 
-#if defined(N7S_TARGET_SAMV71Q21)
+#if defined(BSP_HOST_REGISTERS)
+
+/// \brief In-memory MCAN register models, see HostRegisters/HostRegisters.h.
+extern Mcan_BaseRegisters HostRegisters_mcan[2];
+/// \brief In-memory CAN DMA base address registers, see HostRegisters/HostRegisters.h.
+extern uint32_t HostRegisters_mcanCanDmaBase[2];
+
+#define MCAN0_CHIPCFG_CAN_DMA_ADDRESS_BASE \
+	((uintptr_t)&HostRegisters_mcanCanDmaBase[0])
+#define MCAN1_CHIPCFG_CAN_DMA_ADDRESS_BASE \
+	((uintptr_t)&HostRegisters_mcanCanDmaBase[1])
+
+#define MCAN0_ADDRESS_BASE ((uintptr_t)&HostRegisters_mcan[0])
+#define MCAN1_ADDRESS_BASE ((uintptr_t)&HostRegisters_mcan[1])
+
+#elif defined(N7S_TARGET_SAMV71Q21)
 #define MCAN0_CHIPCFG_CAN_DMA_ADDRESS_BASE 0x40088110u
 #define MCAN1_CHIPCFG_CAN_DMA_ADDRESS_BASE 0x40088114u
 
@@ -0,0 +1,110 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "McanTimestamp.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+void
+McanTimestamp_init(McanTimestamp *const timestamp,
+		const McanTimestamp_Config *const config)
+{
+	assert(timestamp != NULL);
+	assert(config->tic != NULL);
+	// Mcan external timestamp is wired to Tic 0 channel 0 only.
+	assert(config->tic->ticId == Tic_Id_0);
+	assert(config->channel == Tic_Channel_0);
+
+	timestamp->tic = config->tic;
+	timestamp->channel = config->channel;
+	timestamp->irq = config->irq;
+	timestamp->periodCount = 0u;
+
+	Tic_ChannelConfig channelConfig;
+	(void)memset(&channelConfig, 0, sizeof(Tic_ChannelConfig));
+	channelConfig.isEnabled = true;
+	channelConfig.clockSource = config->clockSource;
+	channelConfig.channelMode = Tic_Mode_Waveform;
+	// The overflow is flagged as the counter wraps to 0, unlike the RC compare,
+	// which is flagged a tick before the wrap, while the counter still holds RC.
+	channelConfig.modeConfig.waveformModeConfig.waveformMode =
+			Tic_WaveformMode_Up;
+	channelConfig.irqConfig.isCounterOverflowIrqEnabled = true;
+
+	Tic_setChannelConfig(config->tic, config->channel, &channelConfig);
+	Tic_triggerChannel(config->tic, config->channel);
+}
+
+void
+McanTimestamp_handleInterrupt(McanTimestamp *const timestamp)
+{
+	Tic_ChannelStatus status;
+	Tic_getChannelStatus(timestamp->tic, timestamp->channel, &status);
+	if (status.hasCounterOverflowed)
+		timestamp->periodCount++;
+}
+
+uint64_t
+McanTimestamp_now(const McanTimestamp *const timestamp)
+{
+	uint32_t periods = 0u;
+	uint32_t counter = 0u;
+	bool isWrapPending = false;
+
+	// Repeat if a period was counted while sampling the counter.
+	do {
+		periods = timestamp->periodCount;
+		counter = Tic_getCounterValue(timestamp->tic, timestamp->channel);
+		// A wrap pending in the NVIC is not counted yet; the counter is
+		// sampled again, as the wrap may have followed the first sample.
+		isWrapPending = Nvic_isInterruptPending(timestamp->irq);
+		if (isWrapPending)
+			counter = Tic_getCounterValue(
+					timestamp->tic, timestamp->channel);
+	} while (periods != timestamp->periodCount);
+
+	if (isWrapPending)
+		periods++;
+
+	return ((uint64_t)periods * MCAN_TIMESTAMP_PERIOD_TICKS)
+			+ (counter % MCAN_TIMESTAMP_PERIOD_TICKS);
+}
+
+uint64_t
+McanTimestamp_extend(
+		const McanTimestamp *const timestamp, const uint16_t value)
+{
+	const uint64_t now = McanTimestamp_now(timestamp);
+	const uint64_t periodStart =
+			now - (now % MCAN_TIMESTAMP_PERIOD_TICKS);
+	const uint64_t extended = periodStart + value;
+
+	// Timestamp taken before the most recent counter wrap.
+	if ((extended > now) && (periodStart >= MCAN_TIMESTAMP_PERIOD_TICKS))
+		return extended - MCAN_TIMESTAMP_PERIOD_TICKS;
+
+	return extended;
+}
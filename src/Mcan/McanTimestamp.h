@@ -0,0 +1,106 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file McanTimestamp.h
+/// \addtogroup Bsp
+/// \brief Mcan 64-bit timestamp extension function prototypes and datatypes.
+/// \details The Mcan external timestamp is taken from a Tic channel counter
+///          (Tic 0 channel 0). The service runs that channel as a free-running
+///          16-bit counter and counts its overflows, which allows to
+///          extend the 16-bit Rx and Tx Event timestamps into a monotonic
+///          time base. Mcan shall be configured with
+///          ::Mcan_TimestampClk_External.
+
+#ifndef BSP_MCANTIMESTAMP_H
+#define BSP_MCANTIMESTAMP_H
+
+#include <stdint.h>
+
+#include <Nvic/Nvic.h>
+#include <Tic/Tic.h>
+
+/// @addtogroup McanTimestamp
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Number of counter ticks in a single timestamp period.
+#define MCAN_TIMESTAMP_PERIOD_TICKS 0x10000u
+
+/// \brief Timestamp service configuration.
+typedef struct {
+	Tic *tic; ///< Tic instance providing the external timestamp, shall be Tic 0.
+	Tic_Channel channel; ///< Tic channel providing the external timestamp, shall be channel 0.
+	Tic_ClockSelection clockSource; ///< Timestamp counter clock source.
+	Nvic_Irq irq; ///< Interrupt of the Tic channel.
+} McanTimestamp_Config;
+
+/// \brief Timestamp service descriptor.
+typedef struct {
+	Tic *tic; ///< Tic instance providing the external timestamp.
+	Tic_Channel channel; ///< Tic channel providing the external timestamp.
+	Nvic_Irq irq; ///< Interrupt of the Tic channel.
+	volatile uint32_t periodCount; ///< Number of elapsed counter periods.
+} McanTimestamp;
+
+/// \brief Initializes the timestamp service and starts the Tic channel.
+/// \details The channel runs in the waveform mode, wrapping after
+///          ::MCAN_TIMESTAMP_PERIOD_TICKS ticks, with the counter overflow
+///          interrupt enabled; ::McanTimestamp_handleInterrupt shall be called
+///          from the Tic channel interrupt handler.
+/// \param [out] timestamp Timestamp service descriptor.
+/// \param [in] config Timestamp service configuration.
+void McanTimestamp_init(McanTimestamp *const timestamp,
+		const McanTimestamp_Config *const config);
+
+/// \brief Handles the Tic channel interrupt, tracking counter periods.
+/// \param [in,out] timestamp Timestamp service descriptor.
+void McanTimestamp_handleInterrupt(McanTimestamp *const timestamp);
+
+/// \brief Returns the current extended time.
+/// \details The result has 48 significant bits. A counter wrap whose
+///          interrupt is still pending, e.g. when called from a higher priority
+///          interrupt handler or with interrupts masked, is accounted for; the
+///          Tic channel interrupt shall not be held off for a full period.
+/// \param [in] timestamp Timestamp service descriptor.
+/// \returns Current time in counter ticks.
+uint64_t McanTimestamp_now(const McanTimestamp *const timestamp);
+
+/// \brief Extends a 16-bit Mcan timestamp into the extended time base.
+/// \details The timestamp is assumed to lie less than one period in the past.
+/// \param [in] timestamp Timestamp service descriptor.
+/// \param [in] value Rx element or Tx Event element timestamp.
+/// \returns Extended time of the timestamp in counter ticks.
+uint64_t McanTimestamp_extend(
+		const McanTimestamp *const timestamp, const uint16_t value);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_MCANTIMESTAMP_H
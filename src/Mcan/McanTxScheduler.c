@@ -0,0 +1,205 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "McanTxScheduler.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <Utils/Bits.h>
+#include <Utils/Memory.h>
+
+_Static_assert(MCAN_TX_SCHEDULER_CAPACITY <= 32u,
+		"Tx scheduler capacity exceeds the entry mask width");
+
+void
+McanTxScheduler_init(McanTxScheduler *const scheduler, Mcan *const mcan)
+{
+	assert(scheduler != NULL);
+	assert(mcan != NULL);
+
+	(void)memset(scheduler, 0, sizeof(McanTxScheduler));
+	scheduler->mcan = mcan;
+}
+
+static uint32_t
+getPriority(const Mcan_TxElement *const element)
+{
+	// Standard Ids are aligned with the base part of extended Ids; the lowest
+	// bit makes a standard frame win against an extended one with the same
+	// base Id, as in bus arbitration.
+	if (element->idType == Mcan_IdType_Standard)
+		return (element->id & 0x7FFu) << 19u;
+	return ((element->id & 0x1FFFFFFFu) << 1u) | 1u;
+}
+
+static uint8_t
+allocateEntry(McanTxScheduler *const scheduler)
+{
+	const uint32_t freeEntries = ~scheduler->usedEntries;
+	const uint32_t index = countTrailingZeros(freeEntries);
+	if (index >= MCAN_TX_SCHEDULER_CAPACITY)
+		return MCAN_TX_SCHEDULER_CAPACITY;
+
+	scheduler->usedEntries |= shiftBitLeft(true, index);
+	return (uint8_t)index;
+}
+
+bool
+McanTxScheduler_submit(McanTxScheduler *const scheduler,
+		const Mcan_TxElement element, ErrorCode *const errCode)
+{
+	assert(scheduler != NULL);
+
+	if (!Mcan_isDataSizeValid(element.dataSize))
+		return returnError(errCode, Mcan_ErrorCode_ElementSizeInvalid);
+
+	const uint8_t slot = allocateEntry(scheduler);
+	if (slot >= MCAN_TX_SCHEDULER_CAPACITY)
+		return returnError(errCode, Mcan_ErrorCode_TxSchedulerFull);
+
+	McanTxScheduler_Entry *const entry = &scheduler->entries[slot];
+	entry->priority = getPriority(&element);
+	entry->element = element;
+	entry->element.data = NULL;
+	if (element.dataSize != 0u)
+		Memory_copy(entry->data, element.data, element.dataSize);
+
+	// Insert after all entries of higher or equal priority, keeping the
+	// submission order of frames with the same Id.
+	uint8_t position = scheduler->pendingCount;
+	while ((position > 0u)
+			&& (scheduler->entries[scheduler->order[position - 1u]]
+							.priority
+					> entry->priority)) {
+		scheduler->order[position] = scheduler->order[position - 1u];
+		position--;
+	}
+	scheduler->order[position] = slot;
+	scheduler->pendingCount++;
+
+	McanTxScheduler_service(scheduler);
+
+	return true;
+}
+
+static void
+popEntry(McanTxScheduler *const scheduler, const uint8_t position)
+{
+	scheduler->usedEntries &=
+			~shiftBitLeft(true, scheduler->order[position]);
+	scheduler->pendingCount--;
+	(void)memmove(&scheduler->order[position],
+			&scheduler->order[position + 1u],
+			(size_t)scheduler->pendingCount - position);
+}
+
+static McanTxScheduler_Entry *
+getEntry(McanTxScheduler *const scheduler, const uint8_t position)
+{
+	McanTxScheduler_Entry *const entry =
+			&scheduler->entries[scheduler->order[position]];
+	entry->element.data = entry->data;
+	return entry;
+}
+
+static void
+releaseFinishedBuffers(McanTxScheduler *const scheduler)
+{
+	scheduler->occupiedBuffers &=
+			~Mcan_txBufferGetFinishedMask(scheduler->mcan);
+}
+
+static uint32_t
+getLowestBufferedPriority(const McanTxScheduler *const scheduler)
+{
+	uint32_t lowest = 0u;
+	FOR_EACH_SET_BIT(index, scheduler->occupiedBuffers) {
+		if (scheduler->bufferPriorities[index] > lowest)
+			lowest = scheduler->bufferPriorities[index];
+	}
+	return lowest;
+}
+
+static void
+fillTxBuffers(McanTxScheduler *const scheduler)
+{
+	const uint8_t bufferCount = scheduler->mcan->tx.bufferSize;
+	for (uint8_t i = 0u;
+			(i < bufferCount) && (scheduler->pendingCount != 0u);
+			i++) {
+		if (isBitSet(scheduler->occupiedBuffers, i))
+			continue;
+
+		const McanTxScheduler_Entry *const entry =
+				getEntry(scheduler, 0u);
+		if (Mcan_txBufferAdd(scheduler->mcan, entry->element, i,
+				    NULL)) {
+			scheduler->occupiedBuffers |= shiftBitLeft(true, i);
+			scheduler->bufferPriorities[i] = entry->priority;
+		} else {
+			scheduler->droppedCount++;
+		}
+		popEntry(scheduler, 0u);
+	}
+}
+
+static void
+fillTxQueue(McanTxScheduler *const scheduler)
+{
+	// Frames ranking above any frame in the Tx Buffers are kept in software
+	// for the next free Tx Buffer, so that they do not wait behind bulk
+	// frames in the Tx Queue. Pending frames are ordered, so the frames
+	// allowed into the queue form the tail of the order.
+	const uint32_t lowestBuffered = getLowestBufferedPriority(scheduler);
+	uint8_t position = 0u;
+	while ((position < scheduler->pendingCount)
+			&& (getEntry(scheduler, position)->priority
+					< lowestBuffered))
+		position++;
+
+	while (position < scheduler->pendingCount) {
+		const McanTxScheduler_Entry *const entry =
+				getEntry(scheduler, position);
+		uint8_t index = 0u;
+		ErrorCode errCode = ErrorCode_NoError;
+		if (!Mcan_txQueuePush(scheduler->mcan, entry->element, &index,
+				    &errCode)) {
+			if (errCode == Mcan_ErrorCode_TxFifoFull)
+				break;
+			scheduler->droppedCount++;
+		}
+		popEntry(scheduler, position);
+	}
+}
+
+void
+McanTxScheduler_service(McanTxScheduler *const scheduler)
+{
+	assert(scheduler != NULL);
+
+	releaseFinishedBuffers(scheduler);
+	fillTxBuffers(scheduler);
+	fillTxQueue(scheduler);
+}
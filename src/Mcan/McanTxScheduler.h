@@ -0,0 +1,132 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file McanTxScheduler.h
+/// \addtogroup Bsp
+/// \brief Mcan priority-aware Tx scheduler function prototypes and datatypes.
+/// \details Pending frames are kept ordered by their arbitration priority. The
+///          highest priority ones are placed in the dedicated Tx Buffers,
+///          where the controller arbitrates them by Id, and the rest is pushed
+///          through the Tx Queue. Frames waiting in software are placed as soon
+///          as a dedicated Tx Buffer finishes its transmission, so critical
+///          frames do not wait behind bulk traffic inside the controller.
+
+#ifndef BSP_MCANTXSCHEDULER_H
+#define BSP_MCANTXSCHEDULER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <Utils/ErrorCode.h>
+
+#include "Mcan.h"
+
+/// @addtogroup McanTxScheduler
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef MCAN_TX_SCHEDULER_CAPACITY
+/// \brief Maximum number of frames waiting in the scheduler (up to 32).
+#define MCAN_TX_SCHEDULER_CAPACITY 16u
+#endif
+
+/// \brief Maximum number of dedicated Tx Buffers.
+#define MCAN_TX_BUFFER_COUNT_MAX 32u
+
+/// \brief Frame waiting in the scheduler.
+typedef struct {
+	uint32_t priority; ///< Arbitration priority key; lower is more important.
+	Mcan_TxElement element; ///< Element; data pointer is set on dispatch.
+	uint8_t data[MCAN_FRAME_DATA_SIZE_MAX]; ///< Frame payload copy.
+} McanTxScheduler_Entry;
+
+/// \brief Tx scheduler descriptor.
+typedef struct {
+	Mcan *mcan; ///< Scheduled Mcan device.
+	McanTxScheduler_Entry entries[MCAN_TX_SCHEDULER_CAPACITY]; ///< Entry pool.
+	uint8_t order[MCAN_TX_SCHEDULER_CAPACITY]; ///< Pending entries by priority.
+	uint8_t pendingCount; ///< Number of pending entries.
+	uint32_t usedEntries; ///< Bit mask of pool entries in use.
+	uint32_t occupiedBuffers; ///< Bit mask of Tx Buffers awaiting transmission.
+	/// \brief Priority keys of the frames placed in the Tx Buffers.
+	uint32_t bufferPriorities[MCAN_TX_BUFFER_COUNT_MAX];
+	uint32_t droppedCount; ///< Frames rejected by the controller.
+} McanTxScheduler;
+
+/// \brief Initializes the scheduler for the configured Mcan device.
+/// \param [out] scheduler Tx scheduler descriptor.
+/// \param [in] mcan Mcan device descriptor, with Tx Buffers configured.
+void McanTxScheduler_init(McanTxScheduler *const scheduler, Mcan *const mcan);
+
+/// \brief Submits a frame for transmission.
+/// \details The element data is copied, so its buffer can be reused.
+/// \param [in,out] scheduler Tx scheduler descriptor.
+/// \param [in] element Tx element to send.
+/// \param [out] errCode An error code generated during the operation.
+/// \retval true Submitting was successful.
+/// \retval false Scheduler is full or the element is invalid.
+bool McanTxScheduler_submit(McanTxScheduler *const scheduler,
+		const Mcan_TxElement element, ErrorCode *const errCode);
+
+/// \brief Re-evaluates the placement of pending frames.
+/// \details Releases dedicated Tx Buffers which finished their transmission,
+///          fills free Tx Buffers with the highest priority pending frames and
+///          pushes the remaining ones to the Tx Queue while it has room. Only
+///          frames ranking below every frame held in the Tx Buffers are pushed
+///          to the Tx Queue, the others wait for the next free Tx Buffer.
+///          Frames rejected by the controller are dropped and counted.
+///          Shall be called on transmission completion (e.g. from the Mcan
+///          interrupt handler); calls shall not preempt each other.
+/// \param [in,out] scheduler Tx scheduler descriptor.
+void McanTxScheduler_service(McanTxScheduler *const scheduler);
+
+/// \brief Returns the number of frames waiting in software.
+/// \param [in] scheduler Tx scheduler descriptor.
+/// \returns Number of frames not yet handed to the controller.
+static inline uint8_t
+McanTxScheduler_getPendingCount(const McanTxScheduler *const scheduler)
+{
+	return scheduler->pendingCount;
+}
+
+/// \brief Returns the number of frames dropped, because the controller
+///        rejected them.
+/// \param [in] scheduler Tx scheduler descriptor.
+/// \returns Number of dropped frames.
+static inline uint32_t
+McanTxScheduler_getDroppedCount(const McanTxScheduler *const scheduler)
+{
+	return scheduler->droppedCount;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_MCANTXSCHEDULER_H
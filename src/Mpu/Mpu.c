@@ -31,6 +31,12 @@
 
 #define MPU_REGIONS_COUNT 16u
 
+#define MPU_REGION_SIZE_MIN 32u
+
+// Provided by the linker script, left undefined if it has no .dma_nocache section.
+extern uint32_t _sdma_nocache __attribute__((weak));
+extern uint32_t _edma_nocache __attribute__((weak));
+
 void
 Mpu_init(Mpu *const mpu)
 {
@@ -217,3 +223,53 @@ Mpu_setRegionConfig(Mpu *const mpu, const uint8_t region,
 
 	MEMORY_SYNC_BARRIER();
 }
+
+static inline uint8_t
+getRegionSizeValue(const uint32_t size)
+{
+	uint8_t value = 0u;
+	for (uint32_t remaining = size; remaining > 2u; remaining >>= 1u)
+		value++;
+	return value;
+}
+
+void
+Mpu_setNonCacheableRegion(Mpu *const mpu, const uint8_t region,
+		const uint32_t address, const uint32_t size)
+{
+	assert(size >= MPU_REGION_SIZE_MIN);
+	assert((size & (size - 1u)) == 0u);
+	assert((address & (size - 1u)) == 0u);
+
+	const Mpu_RegionConfig config = {
+		.address = address,
+		.isEnabled = true,
+		.size = getRegionSizeValue(size),
+		.subregionDisableMask = 0u,
+		.isShareable = true,
+		.isExecutable = false,
+		.memoryType = Mpu_RegionMemoryType_Normal,
+		.innerCachePolicy = Mpu_RegionCachePolicy_NonCacheable,
+		.outerCachePolicy = Mpu_RegionCachePolicy_NonCacheable,
+		.privilegedAccess = Mpu_RegionAccess_ReadWrite,
+		.unprivilegedAccess = Mpu_RegionAccess_ReadWrite,
+	};
+	Mpu_setRegionConfig(mpu, region, &config);
+
+	// cppcheck-suppress misra-c2012-11.6
+	(void)Scb_cleanInvalidateDCacheByRange((const void *)address, size);
+}
+
+bool
+Mpu_setDmaNoCacheRegion(Mpu *const mpu, const uint8_t region)
+{
+	// cppcheck-suppress misra-c2012-11.4
+	const uint32_t begin = (uint32_t)&_sdma_nocache;
+	// cppcheck-suppress misra-c2012-11.4
+	const uint32_t end = (uint32_t)&_edma_nocache;
+	if (end <= begin)
+		return false;
+
+	Mpu_setNonCacheableRegion(mpu, region, begin, end - begin);
+	return true;
+}
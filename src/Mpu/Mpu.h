@@ -41,6 +41,12 @@
 extern "C" {
 #endif
 
+/// \brief Places a variable in the `.dma_nocache` linker section, mapped as non-cacheable
+///        by ::Mpu_setDmaNoCacheRegion.
+/// \details The section is empty unless the image is linked with DMA_NOCACHE_SIZE defined,
+///          e.g. `-Wl,--defsym=DMA_NOCACHE_SIZE=0x2000`.
+#define MPU_DMA_NOCACHE __attribute__((section(".dma_nocache")))
+
 /// \brief Access type to the memory region.
 typedef enum {
 	Mpu_RegionAccess_NoAccess, ///< No access is allowed.
@@ -141,6 +147,29 @@ uint32_t Mpu_generateAttributes(const Mpu_RegionMemoryType type,
 		const Mpu_RegionAccess privilegedAccess,
 		const Mpu_RegionAccess unprivilegedAccess);
 
+/// \brief Configures a memory region as shareable, non-cacheable and non-executable
+///        normal memory with read-write access.
+/// \details Cached lines of the range are cleaned and invalidated afterwards, so that no stale
+///          data are left in the data cache. The region should have a higher number than any
+///          overlapping cacheable region, as higher region numbers take priority.
+/// \param [in] mpu Mpu device descriptor.
+/// \param [in] region Memory region number.
+/// \param [in] address Region base address, aligned to the region size.
+/// \param [in] size Region size in bytes, a power of two not smaller than 32.
+void Mpu_setNonCacheableRegion(Mpu *const mpu, const uint8_t region,
+		const uint32_t address, const uint32_t size);
+
+/// \brief Configures the `.dma_nocache` linker section as a non-cacheable region, using
+///        ::Mpu_setNonCacheableRegion.
+/// \details Buffers declared with ::MPU_DMA_NOCACHE need no cache maintenance around DMA
+///          transfers. Intended to be called at startup, before the data cache is enabled.
+/// \param [in] mpu Mpu device descriptor.
+/// \param [in] region Memory region number.
+/// \retval true The region was configured.
+/// \retval false The linker script does not provide a `.dma_nocache` section, or it is
+///         empty.
+bool Mpu_setDmaNoCacheRegion(Mpu *const mpu, const uint8_t region);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
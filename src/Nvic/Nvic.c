@@ -148,6 +148,41 @@ Nvic_getPriorityGrouping(void)
 			>> SCB_AIRCR_PRIGROUP_OFFSET);
 }
 
+static void
+setSystemHandlerPriority(const Nvic_Irq irqn, const uint8_t priority)
+{
+	// cppcheck-suppress misra-c2012-11.4
+	Scb_Registers *scb = (Scb_Registers *)SCB_BASE_ADDRESS;
+
+	// SHPR1-3 hold byte-wide priorities of system exceptions 4 to 15.
+	// cppcheck-suppress misra-c2012-11.3
+	volatile uint8_t *const shpr = (volatile uint8_t *)&scb->shpr1;
+	const uint32_t index = (uint32_t)((int32_t)irqn
+			+ (int32_t)Nvic_SystemExceptionCount - 4);
+	shpr[index] = (uint8_t)(((uint32_t)priority << NVIC_IRQ_PRIORITY_OFFSET)
+			& 0xFFu);
+}
+
+void
+Nvic_applyPriorityProfile(const Nvic_PriorityProfile *const profile)
+{
+	assert((profile->entries != NULL) || (profile->entryCount == 0u));
+
+	Nvic_setPriorityGrouping(profile->priorityGrouping);
+
+	for (uint32_t i = 0u; i < profile->entryCount; i++) {
+		const Nvic_PriorityEntry *const entry = &profile->entries[i];
+		assert(entry->priority < NVIC_PRIORITY_LEVEL_COUNT);
+		assert(((int32_t)entry->irqn >= (int32_t)Nvic_Irq_MemoryManagement)
+				&& "NMI and HardFault priorities are fixed");
+
+		if ((int32_t)entry->irqn < 0)
+			setSystemHandlerPriority(entry->irqn, entry->priority);
+		else
+			Nvic_setInterruptPriority(entry->irqn, entry->priority);
+	}
+}
+
 void
 Nvic_relocateVectorTable(const void *const address)
 {
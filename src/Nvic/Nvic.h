@@ -32,6 +32,8 @@
 #include <stddef.h>
 #include <stdint.h>
 
+#include "NvicRegisters.h"
+
 /// @addtogroup Nvic
 /// @ingroup Bsp
 /// @{
@@ -276,6 +278,22 @@ enum {
 	Nvic_SystemExceptionCount = 16, /// \brief Number of system exceptions.
 };
 
+/// \brief Number of implemented interrupt priority levels.
+#define NVIC_PRIORITY_LEVEL_COUNT (1u << (8u - NVIC_IRQ_PRIORITY_OFFSET))
+
+/// \brief Structure describing a priority assigned to an interrupt.
+typedef struct {
+	Nvic_Irq irqn; ///< Interrupt or configurable system exception.
+	uint8_t priority; ///< Priority level, lower values take precedence.
+} Nvic_PriorityEntry;
+
+/// \brief Structure describing a system-wide interrupt priority profile.
+typedef struct {
+	uint8_t priorityGrouping; ///< Priority grouping, see ::Nvic_setPriorityGrouping.
+	const Nvic_PriorityEntry *entries; ///< Interrupt priorities.
+	uint32_t entryCount; ///< Number of interrupt priorities.
+} Nvic_PriorityProfile;
+
 /// \brief Function used to enable an interrupt in the NVIC.
 /// \param [in] irqn Numeric identifier of the interrupt to enable.
 void Nvic_enableInterrupt(const Nvic_Irq irqn);
@@ -327,6 +345,13 @@ void Nvic_setPriorityGrouping(const uint8_t priorityGroup);
 /// \returns Index of the bit splitting between group priority and subpriority.
 uint8_t Nvic_getPriorityGrouping(void);
 
+/// \brief Function used to apply an interrupt priority profile in one call.
+/// \details Sets the priority grouping and then the priority of every listed
+///          interrupt. Configurable system exceptions (MemoryManagement up to
+///          SysTick) can be listed as well.
+/// \param [in] profile Priority profile to be applied.
+void Nvic_applyPriorityProfile(const Nvic_PriorityProfile *const profile);
+
 /// \brief Function used to change the address of the vector table in NVIC.
 /// \details Function disables interrupts globally for vector address change,
 ///          then re-enables them afterwards. This has potentially unwanted side effect
@@ -351,6 +376,60 @@ void *Nvic_getVectorTableAddress(void);
 void Nvic_setInterruptHandlerAddress(
 		const Nvic_Irq irqn, const Nvic_InterruptHandler address);
 
+#if defined(BSP_HOST_REGISTERS)
+// Host builds call the interrupt handlers synchronously, so there is no interrupt state to
+// mask. The functions below keep the target API available to the drivers.
+static inline void
+Nvic_enableIrq(void)
+{
+}
+
+static inline void
+Nvic_disableIrq(void)
+{
+}
+
+static inline uint32_t
+Nvic_saveAndDisableIrq(void)
+{
+	return 0u;
+}
+
+static inline void
+Nvic_restoreIrq(const uint32_t primask)
+{
+	(void)primask;
+}
+
+static inline bool
+Nvic_isIrqDisabled(void)
+{
+	return false;
+}
+
+static inline uint32_t
+Nvic_enterCritical(const uint8_t level)
+{
+	(void)level;
+	return 0u;
+}
+
+static inline void
+Nvic_exitCritical(const uint32_t basepri)
+{
+	(void)basepri;
+}
+
+static inline void
+Nvic_enableFaultIrq(void)
+{
+}
+
+static inline void
+Nvic_disableFaultIrq(void)
+{
+}
+#else
 /// \brief Enable IRQ Interrupts.
 static inline void
 Nvic_enableIrq(void)
@@ -365,6 +444,68 @@ Nvic_disableIrq(void)
 	asm volatile("cpsid i" : : : "memory");
 }
 
+/// \brief Disable IRQ Interrupts, saving their previous state.
+/// \details Allows nesting of critical sections, see ::Nvic_restoreIrq.
+/// \returns PRIMASK value before the interrupts were disabled.
+static inline uint32_t
+Nvic_saveAndDisableIrq(void)
+{
+	uint32_t primask;
+	asm volatile("mrs %0, primask" : "=r"(primask));
+	asm volatile("cpsid i" : : : "memory");
+	return primask;
+}
+
+/// \brief Restore IRQ Interrupts state saved by ::Nvic_saveAndDisableIrq.
+/// \param [in] primask PRIMASK value to be restored.
+static inline void
+Nvic_restoreIrq(const uint32_t primask)
+{
+	asm volatile("msr primask, %0" : : "r"(primask) : "memory");
+}
+
+/// \brief Checks whether IRQ Interrupts are disabled through PRIMASK.
+/// \returns True if PRIMASK is set, false otherwise.
+static inline bool
+Nvic_isIrqDisabled(void)
+{
+	uint32_t primask;
+	asm volatile("mrs %0, primask" : "=r"(primask));
+	return (primask & 1u) != 0u;
+}
+
+/// \brief Enter a critical section masking interrupts of a priority level and
+///        below, while interrupts of higher priority keep being served.
+/// \details BASEPRI is only ever raised, so critical sections can be nested.
+///          Interrupts of level 0 can not be masked this way. PRIMASK is set
+///          around the BASEPRI write, as on Cortex-M7 r0p1 (erratum 837070)
+///          the new mask may not take effect on the next instruction.
+/// \param [in] level Lowest masked priority level, from 1 to
+///             ::NVIC_PRIORITY_LEVEL_COUNT - 1.
+/// \returns BASEPRI value to be passed to ::Nvic_exitCritical.
+static inline uint32_t
+Nvic_enterCritical(const uint8_t level)
+{
+	const uint32_t basepri = ((uint32_t)level << NVIC_IRQ_PRIORITY_OFFSET)
+			& 0xFFu;
+	uint32_t previous;
+	asm volatile("mrs %0, basepri" : "=r"(previous));
+
+	const uint32_t primask = Nvic_saveAndDisableIrq();
+	asm volatile("msr basepri_max, %0" : : "r"(basepri) : "memory");
+	Nvic_restoreIrq(primask);
+
+	return previous;
+}
+
+/// \brief Exit a critical section entered with ::Nvic_enterCritical.
+/// \param [in] basepri BASEPRI value to be restored.
+static inline void
+Nvic_exitCritical(const uint32_t basepri)
+{
+	asm volatile("msr basepri, %0" : : "r"(basepri) : "memory");
+}
+
 /// \brief Enable Fault IRQ Interrupts.
 // LCOV_EXCL_START
 // Faults are used by the GCOV itself, coverage cannot be gathered.
@@ -388,6 +529,20 @@ Nvic_disableFaultIrq(void)
 }
 
 // LCOV_EXCL_STOP
+#endif
+
+/// \brief Macro defining a parameterless interrupt handler NAME, which calls HANDLER
+///        with the address of INSTANCE. Allows drivers, e.g. Uart_handleInterrupt, to be
+///        installed directly in a RAM vector table with ::Nvic_setInterruptHandlerAddress.
+/// \param [in] NAME name of the generated handler.
+/// \param [in] HANDLER driver interrupt handling function.
+/// \param [in] INSTANCE driver instance passed to the handling function.
+// cppcheck-suppress misra-c2012-20.7
+#define NVIC_INTERRUPT_TRAMPOLINE(NAME, HANDLER, INSTANCE) \
+	static void NAME(void) \
+	{ \
+		HANDLER(&(INSTANCE)); \
+	}
 
 /// \brief Function used to retrieve the address of an interrupt handler from the currently used
 ///        vector table.
@@ -23,8 +23,14 @@
 
 #include "Pio.h"
 
+#include <assert.h>
+#include <string.h>
+
+#include <Utils/Bits.h>
 #include <Utils/Utils.h>
 
+#define PIO_PORT_COUNT 5u
+
 bool
 Pio_init(const Pio_Port port, Pio *const pio, ErrorCode *const errCode)
 {
@@ -57,6 +63,8 @@ Pio_init(const Pio_Port port, Pio *const pio, ErrorCode *const errCode)
 	default: return returnError(errCode, Pio_ErrorCode_InvalidPortId);
 	}
 
+	pio->pinHandlers = NULL;
+
 	return true;
 }
 
@@ -292,6 +300,310 @@ Pio_setPinsConfig(Pio *const pio, const uint32_t pinMask,
 					pio, pinMask, config, errCode);
 }
 
+/// \brief Register writes merged from all configuration table entries of a single port.
+typedef struct {
+	uint32_t pins; ///< All configured I/O lines.
+	uint32_t per; ///< Lines assigned to the PIO controller.
+	uint32_t pdr; ///< Lines assigned to peripherals.
+	uint32_t abcdsr1; ///< ABCDSR1 bits of lines assigned to peripherals.
+	uint32_t abcdsr2; ///< ABCDSR2 bits of lines assigned to peripherals.
+	uint32_t oer; ///< Lines with output enabled.
+	uint32_t odr; ///< Lines with output disabled.
+	uint32_t ower; ///< Lines with synchronous output enabled.
+	uint32_t owdr; ///< Lines with synchronous output disabled.
+	uint32_t puer; ///< Lines with pull-up enabled.
+	uint32_t pudr; ///< Lines with pull-up disabled.
+	uint32_t ppder; ///< Lines with pull-down enabled.
+	uint32_t ppddr; ///< Lines with pull-down disabled.
+	uint32_t ifer; ///< Lines with input filter enabled.
+	uint32_t ifdr; ///< Lines with input filter disabled.
+	uint32_t ifscer; ///< Lines with debounce filter selected.
+	uint32_t ifscdr; ///< Lines with glitch filter selected.
+	uint32_t mder; ///< Lines with multi-drive enabled.
+	uint32_t mddr; ///< Lines with multi-drive disabled.
+	uint32_t schmitt; ///< Lines with Schmitt trigger disabled.
+	uint32_t ier; ///< Lines with interrupt enabled.
+	uint32_t aimer; ///< Lines with additional interrupt modes enabled.
+	uint32_t aimdr; ///< Lines with additional interrupt modes disabled.
+	uint32_t esr; ///< Lines with edge interrupt selected.
+	uint32_t lsr; ///< Lines with level interrupt selected.
+	uint32_t rehlsr; ///< Lines with rising edge or high level interrupt selected.
+	uint32_t fellsr; ///< Lines with falling edge or low level interrupt selected.
+	uint32_t driver; ///< Lines with high drive strength.
+} Pio_PortWrites;
+
+static inline bool
+collectControlWrites(Pio_PortWrites *const writes, const uint32_t pins,
+		const Pio_Pin_Config *const config, ErrorCode *const errCode)
+{
+	switch (config->control) {
+	case Pio_Control_Pio: writes->per |= pins; break;
+	case Pio_Control_PeripheralA: writes->pdr |= pins; break;
+	case Pio_Control_PeripheralB:
+		writes->pdr |= pins;
+		writes->abcdsr1 |= pins;
+		break;
+	case Pio_Control_PeripheralC:
+		writes->pdr |= pins;
+		writes->abcdsr2 |= pins;
+		break;
+	case Pio_Control_PeripheralD:
+		writes->pdr |= pins;
+		writes->abcdsr1 |= pins;
+		writes->abcdsr2 |= pins;
+		break;
+	default:
+		return returnError(errCode, Pio_ErrorCode_InvalidControlConfig);
+	}
+
+	return true;
+}
+
+static inline bool
+collectDirectionWrites(Pio_PortWrites *const writes, const uint32_t pins,
+		const Pio_Pin_Config *const config, ErrorCode *const errCode)
+{
+	switch (config->direction) {
+	case Pio_Direction_Input:
+		writes->odr |= pins;
+		writes->owdr |= pins;
+		break;
+	case Pio_Direction_Output:
+		writes->oer |= pins;
+		writes->owdr |= pins;
+		break;
+	case Pio_Direction_SynchronousOutput:
+		writes->oer |= pins;
+		writes->ower |= pins;
+		break;
+	default:
+		return returnError(
+				errCode, Pio_ErrorCode_InvalidDirectionConfig);
+	}
+
+	return true;
+}
+
+static inline bool
+collectPullWrites(Pio_PortWrites *const writes, const uint32_t pins,
+		const Pio_Pin_Config *const config, ErrorCode *const errCode)
+{
+	switch (config->pull) {
+	case Pio_Pull_None:
+		writes->pudr |= pins;
+		writes->ppddr |= pins;
+		break;
+	case Pio_Pull_Up:
+		writes->ppddr |= pins;
+		writes->puer |= pins;
+		break;
+	case Pio_Pull_Down:
+		writes->pudr |= pins;
+		writes->ppder |= pins;
+		break;
+	default: return returnError(errCode, Pio_ErrorCode_InvalidPullConfig);
+	}
+
+	return true;
+}
+
+static inline bool
+collectFilterWrites(Pio_PortWrites *const writes, const uint32_t pins,
+		const Pio_Pin_Config *const config, ErrorCode *const errCode)
+{
+	switch (config->filter) {
+	case Pio_Filter_None:
+		writes->ifdr |= pins;
+		writes->ifscdr |= pins;
+		break;
+	case Pio_Filter_Glitch:
+		writes->ifscdr |= pins;
+		writes->ifer |= pins;
+		break;
+	case Pio_Filter_Debounce:
+		writes->ifscer |= pins;
+		writes->ifer |= pins;
+		break;
+	default: return returnError(errCode, Pio_ErrorCode_InvalidFilterConfig);
+	}
+
+	return true;
+}
+
+static inline bool
+collectIrqWrites(Pio_PortWrites *const writes, const uint32_t pins,
+		const Pio_Pin_Config *const config, ErrorCode *const errCode)
+{
+	switch (config->irq) {
+	case Pio_Irq_None: writes->aimdr |= pins; break;
+	case Pio_Irq_EdgeBoth:
+		writes->aimdr |= pins;
+		writes->ier |= pins;
+		break;
+	case Pio_Irq_EdgeRising:
+		writes->aimer |= pins;
+		writes->esr |= pins;
+		writes->rehlsr |= pins;
+		writes->ier |= pins;
+		break;
+	case Pio_Irq_EdgeFalling:
+		writes->aimer |= pins;
+		writes->esr |= pins;
+		writes->fellsr |= pins;
+		writes->ier |= pins;
+		break;
+	case Pio_Irq_LevelLow:
+		writes->aimer |= pins;
+		writes->lsr |= pins;
+		writes->fellsr |= pins;
+		writes->ier |= pins;
+		break;
+	case Pio_Irq_LevelHigh:
+		writes->aimer |= pins;
+		writes->lsr |= pins;
+		writes->rehlsr |= pins;
+		writes->ier |= pins;
+		break;
+	default: return returnError(errCode, Pio_ErrorCode_InvalidIrqConfig);
+	}
+
+	return true;
+}
+
+static inline bool
+collectDriveStrengthWrites(Pio_PortWrites *const writes, const uint32_t pins,
+		const Pio_Pin_Config *const config, ErrorCode *const errCode)
+{
+	if (config->driveStrength == Pio_Drive_High)
+		writes->driver |= pins;
+	else if (config->driveStrength != Pio_Drive_Low)
+		return returnError(errCode,
+				Pio_ErrorCode_InvalidDriveStrengthConfig);
+
+	return true;
+}
+
+static bool
+collectEntryWrites(Pio_PortWrites *const writes,
+		const Pio_Pins_Config_Entry *const entry,
+		ErrorCode *const errCode)
+{
+	const uint32_t pins = entry->pins;
+	const Pio_Pin_Config *const config = &entry->config;
+
+	if ((pins == 0u) || ((writes->pins & pins) != 0u))
+		return returnError(errCode, Pio_ErrorCode_InvalidPinMask);
+
+	writes->pins |= pins;
+
+	if (config->isMultiDriveEnabled)
+		writes->mder |= pins;
+	else
+		writes->mddr |= pins;
+
+	if (config->isSchmittTriggerDisabled)
+		writes->schmitt |= pins;
+
+	return collectControlWrites(writes, pins, config, errCode)
+			&& collectDirectionWrites(writes, pins, config, errCode)
+			&& collectPullWrites(writes, pins, config, errCode)
+			&& collectFilterWrites(writes, pins, config, errCode)
+			&& collectIrqWrites(writes, pins, config, errCode)
+			&& collectDriveStrengthWrites(
+					writes, pins, config, errCode);
+}
+
+static bool
+collectPortWrites(const Pio_Pins_Config_Entry *const table,
+		const uint32_t count, const Pio_Port port,
+		Pio_PortWrites *const writes, ErrorCode *const errCode)
+{
+	memset(writes, 0, sizeof(Pio_PortWrites));
+
+	for (uint32_t i = 0u; i < count; i++) {
+		if ((table[i].port == port)
+				&& !collectEntryWrites(writes, &table[i], errCode))
+			return false;
+	}
+
+	return true;
+}
+
+static void
+applyPortWrites(Pio *const pio, const Pio_PortWrites *const writes)
+{
+	const uint32_t pins = writes->pins;
+
+	pio->reg->mddr = writes->mddr;
+	pio->reg->mder = writes->mder;
+	pio->reg->schmitt = (pio->reg->schmitt & ~pins) | writes->schmitt;
+
+	pio->reg->per = writes->per;
+	if (writes->pdr != 0u) {
+		pio->reg->abcdsr1 = (pio->reg->abcdsr1 & ~writes->pdr)
+				| writes->abcdsr1;
+		pio->reg->abcdsr2 = (pio->reg->abcdsr2 & ~writes->pdr)
+				| writes->abcdsr2;
+		pio->reg->pdr = writes->pdr;
+	}
+
+	pio->reg->odr = writes->odr;
+	pio->reg->oer = writes->oer;
+	pio->reg->owdr = writes->owdr;
+	pio->reg->ower = writes->ower;
+
+	pio->reg->pudr = writes->pudr;
+	pio->reg->ppddr = writes->ppddr;
+	pio->reg->puer = writes->puer;
+	pio->reg->ppder = writes->ppder;
+
+	pio->reg->ifdr = writes->ifdr;
+	pio->reg->ifscdr = writes->ifscdr;
+	pio->reg->ifscer = writes->ifscer;
+	pio->reg->ifer = writes->ifer;
+
+	pio->reg->idr = pins;
+	pio->reg->aimdr = writes->aimdr;
+	pio->reg->aimer = writes->aimer;
+	pio->reg->esr = writes->esr;
+	pio->reg->lsr = writes->lsr;
+	pio->reg->rehlsr = writes->rehlsr;
+	pio->reg->fellsr = writes->fellsr;
+	pio->reg->ier = writes->ier;
+
+	pio->reg->driver = (pio->reg->driver & ~pins) | writes->driver;
+}
+
+bool
+Pio_setPinsConfigTable(const Pio_Pins_Config_Entry *const table,
+		const uint32_t count, ErrorCode *const errCode)
+{
+	Pio_PortWrites writes;
+
+	for (uint32_t i = 0u; i < count; i++) {
+		if (table[i].port > Pio_Port_E)
+			return returnError(errCode, Pio_ErrorCode_InvalidPortId);
+	}
+
+	for (uint32_t port = 0u; port < PIO_PORT_COUNT; port++) {
+		if (!collectPortWrites(table, count, (Pio_Port)port, &writes,
+				    errCode))
+			return false;
+	}
+
+	for (uint32_t port = 0u; port < PIO_PORT_COUNT; port++) {
+		(void)collectPortWrites(
+				table, count, (Pio_Port)port, &writes, NULL);
+		if (writes.pins != 0u) {
+			Pio pio;
+			(void)Pio_init((Pio_Port)port, &pio, NULL);
+			applyPortWrites(&pio, &writes);
+		}
+	}
+
+	return true;
+}
+
 static inline bool
 detectPeripheral(Pio_Pin_Config *const config, const uint32_t abcdsr1,
 		const uint32_t abcdsr2, const uint32_t pinMask)
@@ -529,3 +841,193 @@ Pio_getIrqStatus(const Pio *const pio)
 {
 	return pio->reg->isr;
 }
+
+void
+Pio_setPinHandlerTable(Pio *const pio, Pio_PinHandler *const table)
+{
+	assert(table != NULL);
+
+	memset(table, 0, PIO_PIN_COUNT * sizeof(Pio_PinHandler));
+	pio->pinHandlers = table;
+}
+
+bool
+Pio_setPinHandler(Pio *const pio, const uint8_t pin,
+		const Pio_PinHandler handler, const Pio_Filter filter,
+		ErrorCode *const errCode)
+{
+	assert(pin < PIO_PIN_COUNT);
+	assert(pio->pinHandlers != NULL);
+
+	Pio_Pin_Config config;
+	config.filter = filter;
+	if (!setFilterConfig(pio, UINT32_C(1) << pin, &config, errCode))
+		return false;
+
+	pio->pinHandlers[pin] = handler;
+
+	return true;
+}
+
+void
+Pio_handleInterrupt(const Pio *const pio)
+{
+	assert(pio->pinHandlers != NULL);
+
+	// Reading the status register clears it.
+	const uint32_t pending = pio->reg->isr & pio->reg->imr;
+
+	FOR_EACH_SET_BIT(pin, pending) {
+		const Pio_PinHandler *const handler = &pio->pinHandlers[pin];
+		if (handler->callback != NULL)
+			handler->callback((uint8_t)pin, handler->arg);
+	}
+}
+
+void
+Pio_setParallelCaptureConfig(
+		Pio *const pio, const Pio_ParallelCaptureConfig *const config)
+{
+	assert(pio->port == Pio_Port_A);
+
+	pio->reg->pcidr = PIO_PCISR_DRDY_MASK | PIO_PCISR_OVRE_MASK;
+	pio->reg->pcmr = BIT_FIELD_VALUE(PIO_PCMR_DSIZE, config->dataSize)
+			| BIT_VALUE(PIO_PCMR_ALWYS, config->isSamplingAlways)
+			| BIT_VALUE(PIO_PCMR_HALFS, config->isHalfSampling)
+			| BIT_VALUE(PIO_PCMR_FRSTS,
+					config->isSecondSampleKept);
+
+	// Clear status left by the previous capture.
+	(void)pio->reg->pcisr;
+
+	pio->reg->pcier = BIT_VALUE(
+					PIO_PCISR_DRDY, config->isDataReadyIrqEnabled)
+			| BIT_VALUE(PIO_PCISR_OVRE,
+					config->isOverrunIrqEnabled);
+}
+
+void
+Pio_getParallelCaptureConfig(
+		const Pio *const pio, Pio_ParallelCaptureConfig *const config)
+{
+	assert(pio->port == Pio_Port_A);
+
+	const uint32_t pcmr = pio->reg->pcmr;
+	const uint32_t pcimr = pio->reg->pcimr;
+
+	config->dataSize = (Pio_ParallelCaptureDataSize)GET_FIELD_VALUE(
+			PIO_PCMR_DSIZE, pcmr);
+	config->isSamplingAlways = IS_FIELD_SET(PIO_PCMR_ALWYS, pcmr);
+	config->isHalfSampling = IS_FIELD_SET(PIO_PCMR_HALFS, pcmr);
+	config->isSecondSampleKept = IS_FIELD_SET(PIO_PCMR_FRSTS, pcmr);
+	config->isDataReadyIrqEnabled = IS_FIELD_SET(PIO_PCISR_DRDY, pcimr);
+	config->isOverrunIrqEnabled = IS_FIELD_SET(PIO_PCISR_OVRE, pcimr);
+}
+
+void
+Pio_enableParallelCapture(Pio *const pio)
+{
+	assert(pio->port == Pio_Port_A);
+
+	pio->reg->pcmr |= PIO_PCMR_PCEN_MASK;
+}
+
+void
+Pio_disableParallelCapture(Pio *const pio)
+{
+	assert(pio->port == Pio_Port_A);
+
+	pio->reg->pcmr &= ~PIO_PCMR_PCEN_MASK;
+}
+
+void
+Pio_getParallelCaptureStatus(
+		const Pio *const pio, Pio_ParallelCaptureStatus *const status)
+{
+	assert(pio->port == Pio_Port_A);
+
+	const uint32_t pcisr = pio->reg->pcisr;
+
+	status->isDataReady = IS_FIELD_SET(PIO_PCISR_DRDY, pcisr);
+	status->hasOverrunOccurred = IS_FIELD_SET(PIO_PCISR_OVRE, pcisr);
+}
+
+uint32_t
+Pio_readParallelCaptureData(const Pio *const pio)
+{
+	assert(pio->port == Pio_Port_A);
+
+	return pio->reg->pcrhr;
+}
+
+static inline Xdmac_DataWidth
+parallelCaptureDataWidth(const uint32_t pcmr)
+{
+	switch ((Pio_ParallelCaptureDataSize)GET_FIELD_VALUE(
+			PIO_PCMR_DSIZE, pcmr)) {
+	case Pio_ParallelCaptureDataSize_HalfWord:
+		return Xdmac_DataWidth_HalfWord;
+	case Pio_ParallelCaptureDataSize_Word: return Xdmac_DataWidth_Word;
+	case Pio_ParallelCaptureDataSize_Byte:
+	default: return Xdmac_DataWidth_Byte;
+	}
+}
+
+void
+Pio_startParallelCaptureDma(
+		Pio *const pio, const Pio_ParallelCaptureDmaConfig *const config)
+{
+	assert(pio->port == Pio_Port_A);
+	assert(config->xdmac != NULL);
+	assert(config->descriptors != NULL);
+	assert(config->buffer != NULL);
+	assert(config->segmentCount > 0u);
+
+	const Xdmac_DataWidth dataWidth =
+			parallelCaptureDataWidth(pio->reg->pcmr);
+	const Xdmac_ChannelConfig channelConfig = {
+		.transferType = Xdmac_TransferType_PeripheralSync,
+		.direction = Xdmac_SyncDirection_PeripheralToMemory,
+		.peripheralId = Xdmac_PeripheralId_PioaRx,
+		.burstSize = Xdmac_BurstSize_1,
+		.chunkSize = Xdmac_ChunkSize_1,
+		.dataWidth = dataWidth,
+		.sourceInterface = Xdmac_Interface_1,
+		.destinationInterface = Xdmac_Interface_0,
+		.sourceAddressingMode = Xdmac_AddressingMode_Fixed,
+		.destinationAddressingMode = Xdmac_AddressingMode_Incremented,
+	};
+	Xdmac_setChannelConfig(config->xdmac, config->channel, &channelConfig);
+
+	const uint32_t segmentSize = config->segmentLength
+			<< (uint32_t)dataWidth;
+	uint8_t *segment = (uint8_t *)config->buffer;
+	for (uint32_t i = 0u; i < config->segmentCount; i++) {
+		Xdmac_initDescriptor(&config->descriptors[i],
+				(const void *)&pio->reg->pcrhr, segment,
+				config->segmentLength);
+		segment = &segment[segmentSize];
+	}
+	for (uint32_t i = 0u; i < config->segmentCount; i++) {
+		Xdmac_linkDescriptors(&config->descriptors[i],
+				&config->descriptors[(i + 1u)
+						% config->segmentCount]);
+	}
+
+	// Clear data and status left by the previous capture.
+	(void)pio->reg->pcrhr;
+	(void)pio->reg->pcisr;
+
+	Xdmac_startLinkedListTransfer(
+			config->xdmac, config->channel, config->descriptors);
+	Pio_enableParallelCapture(pio);
+}
+
+uint32_t
+Pio_getParallelCaptureDmaOffset(
+		const Pio_ParallelCaptureDmaConfig *const config)
+{
+	// cppcheck-suppress misra-c2012-11.4
+	return Xdmac_getDestinationAddress(config->xdmac, config->channel)
+			- (uint32_t)config->buffer;
+}
@@ -28,6 +28,8 @@
 
 #include <Utils/ErrorCode.h>
 
+#include <Xdmac/Xdmac.h>
+
 #include "PioRegisters.h"
 
 /// @addtogroup Pio
@@ -103,6 +105,9 @@ extern "C" {
 /// \brief Mask indicating pin 31.
 #define PIO_PIN_31 0x80000000u
 
+/// \brief Number of I/O lines in a port.
+#define PIO_PIN_COUNT 32u
+
 /// \brief Enumeration listing possible Pio error codes.
 typedef enum {
 	/// \brief Pio control configuration does not match for the selected mask.
@@ -223,10 +228,65 @@ typedef struct {
 	uint16_t debounceFilterDiv; ///< Slow Clock Divider Debouncing.
 } Pio_Port_Config;
 
+/// \brief I/O line configuration table entry.
+typedef struct {
+	Pio_Port port; ///< I/O port.
+	uint32_t pins; ///< I/O lines affected by config.
+	Pio_Pin_Config config; ///< I/O line configuration.
+} Pio_Pins_Config_Entry;
+
+/// \brief A function serving as a callback called upon an I/O line interrupt.
+typedef void (*PioPinCallback)(const uint8_t pin, void *arg);
+
+/// \brief A descriptor of an I/O line interrupt handler.
+typedef struct {
+	PioPinCallback callback; ///< Callback function.
+	void *arg; ///< Argument to the callback function.
+} Pio_PinHandler;
+
+/// \brief Parallel capture data sizes, i.e. number of bytes gathered in a single sample read.
+typedef enum {
+	Pio_ParallelCaptureDataSize_Byte = 0, ///< A single 8-bit sample.
+	Pio_ParallelCaptureDataSize_HalfWord = 1, ///< Two 8-bit samples.
+	Pio_ParallelCaptureDataSize_Word = 2, ///< Four 8-bit samples.
+} Pio_ParallelCaptureDataSize;
+
+/// \brief Parallel capture configuration structure.
+typedef struct {
+	Pio_ParallelCaptureDataSize dataSize; ///< Size of data read from the capture register.
+	/// \brief Samples are taken on each clock edge, regardless of the data enable lines.
+	bool isSamplingAlways;
+	bool isHalfSampling; ///< Only every second sample is kept.
+	/// \brief With half sampling, the second sample out of two is kept instead of the first one.
+	bool isSecondSampleKept;
+	bool isDataReadyIrqEnabled; ///< Enables the data ready interrupt.
+	bool isOverrunIrqEnabled; ///< Enables the overrun error interrupt.
+} Pio_ParallelCaptureConfig;
+
+/// \brief Parallel capture status flags.
+typedef struct {
+	bool isDataReady; ///< Data is waiting in the capture register.
+	bool hasOverrunOccurred; ///< Data was overwritten since the previous status read.
+} Pio_ParallelCaptureStatus;
+
+/// \brief Parallel capture DMA ring configuration structure.
+/// \details The buffer is split into equal segments, each transferred by a single descriptor of
+///          a circular linked list, so that DMA keeps writing into the ring until stopped.
+typedef struct {
+	Xdmac *xdmac; ///< Xdmac device performing the transfers.
+	uint8_t channel; ///< Xdmac channel used for the transfers.
+	Xdmac_LinkedListDescriptor *descriptors; ///< One descriptor per segment.
+	uint32_t segmentCount; ///< Number of ring segments.
+	uint32_t segmentLength; ///< Segment length in capture data units.
+	void *buffer; ///< Ring buffer, holding all the segments.
+} Pio_ParallelCaptureDmaConfig;
+
 /// \brief Pio descriptor.
 typedef struct {
 	Pio_Port port; ///< I/O port.
 	Pio_Registers *reg; ///< I/O port registers.
+	/// \brief Table of ::PIO_PIN_COUNT I/O line interrupt handlers, indexed by line number.
+	Pio_PinHandler *pinHandlers;
 } Pio;
 
 /// \brief Initializes Pio descriptor.
@@ -277,6 +337,19 @@ bool Pio_setPinsConfig(Pio *const pio, const uint32_t pinMask,
 bool Pio_getPinsConfig(const Pio *const pio, const uint32_t pinMask,
 		Pio_Pin_Config *const config, ErrorCode *const errCode);
 
+/// \brief Sets configuration for I/O lines listed in a table, possibly spanning many ports.
+/// \details Settings of all entries concerning a port are merged first, so that each of the
+///          port registers is written at most once, regardless of the number of entries.
+///          The table is validated as a whole before any register is written. Entries for the
+///          same port must not share I/O lines.
+/// \param [in] table Table of I/O line configuration entries, can be placed in flash.
+/// \param [in] count Number of entries in the table.
+/// \param [out] errCode An error code generated during the operation.
+/// \retval true Configuration for all the listed I/O lines was applied successfully.
+/// \retval false Table is invalid, no configuration was applied.
+bool Pio_setPinsConfigTable(const Pio_Pins_Config_Entry *const table,
+		const uint32_t count, ErrorCode *const errCode);
+
 /// \brief Sets the data to be driven on the I/O line.
 /// \param [in] pio Pio descriptor.
 /// \param [in] pinMask I/O line set.
@@ -302,6 +375,93 @@ void Pio_setPortValue(Pio *const pio, const uint32_t value);
 /// \returns I/O port's lines IRQ status.
 uint32_t Pio_getIrqStatus(const Pio *const pio);
 
+/// \brief Assigns the table of I/O line interrupt handlers used by ::Pio_handleInterrupt.
+///        All the handlers in the table are cleared.
+/// \param [in,out] pio Pio descriptor.
+/// \param [in] table Table of ::PIO_PIN_COUNT handlers; must stay valid as long as the
+///             descriptor is used.
+void Pio_setPinHandlerTable(Pio *const pio, Pio_PinHandler *const table);
+
+/// \brief Registers a handler called upon an I/O line interrupt.
+/// \details The interrupt condition itself is set with ::Pio_setPinsConfig. The I/O line input
+///          filter is configured as well, so that e.g. mechanical contacts can be debounced
+///          in hardware, with the divider set by ::Pio_setPortConfig.
+/// \param [in,out] pio Pio descriptor, with the handler table assigned.
+/// \param [in] pin I/O line number.
+/// \param [in] handler I/O line handler descriptor.
+/// \param [in] filter I/O line input filter.
+/// \param [out] errCode An error code generated during the operation.
+/// \retval true Handler was registered successfully.
+/// \retval false Filter configuration is invalid, handler was not registered.
+bool Pio_setPinHandler(Pio *const pio, const uint8_t pin,
+		const Pio_PinHandler handler, const Pio_Filter filter,
+		ErrorCode *const errCode);
+
+/// \brief Handles an interrupt of the I/O port, shall be called from the PIO interrupt
+///        handler of the port.
+/// \details The interrupt status is read (and thereby cleared) once, and the registered
+///          handler of each enabled I/O line with a pending event is called, in ascending
+///          line order.
+/// \param [in] pio Pio descriptor, with the handler table assigned.
+void Pio_handleInterrupt(const Pio *const pio);
+
+/// \brief Sets the parallel capture configuration and disables the capture.
+/// \details Parallel capture is available on port A only: the data lines, the clock and
+///          the enable lines are taken over by the capture once it is enabled. Samples are
+///          taken on the rising edge of the capture clock. The capture interrupts are routed
+///          through the port A interrupt line.
+/// \param [in] pio Pio descriptor of port A.
+/// \param [in] config Parallel capture configuration.
+void Pio_setParallelCaptureConfig(
+		Pio *const pio, const Pio_ParallelCaptureConfig *const config);
+
+/// \brief Gets the parallel capture configuration.
+/// \param [in] pio Pio descriptor of port A.
+/// \param [out] config Parallel capture configuration.
+void Pio_getParallelCaptureConfig(
+		const Pio *const pio, Pio_ParallelCaptureConfig *const config);
+
+/// \brief Enables the parallel capture.
+/// \param [in] pio Pio descriptor of port A.
+void Pio_enableParallelCapture(Pio *const pio);
+
+/// \brief Disables the parallel capture.
+/// \param [in] pio Pio descriptor of port A.
+void Pio_disableParallelCapture(Pio *const pio);
+
+/// \brief Reads the parallel capture status. Reading clears the overrun error flag.
+/// \param [in] pio Pio descriptor of port A.
+/// \param [out] status Parallel capture status flags.
+void Pio_getParallelCaptureStatus(
+		const Pio *const pio, Pio_ParallelCaptureStatus *const status);
+
+/// \brief Reads the captured data, clearing the data ready flag.
+/// \param [in] pio Pio descriptor of port A.
+/// \returns Captured data, the oldest sample in the least significant byte.
+uint32_t Pio_readParallelCaptureData(const Pio *const pio);
+
+/// \brief Starts DMA transfers of the captured data into a ring buffer and enables the capture.
+/// \details The channel is configured for transfers synchronized with the capture, with data
+///          width matching the configured data size, and the descriptors are linked in a
+///          circle over the buffer segments. The DMA write position can be tracked with
+///          ::Pio_getParallelCaptureDmaOffset. Before reading a part of the ring, it shall be
+///          invalidated with ::Xdmac_invalidateDCache. The capture is stopped with
+///          ::Pio_disableParallelCapture followed by ::Xdmac_stopTransfer.
+///          Requires prior call to ::Pio_setParallelCaptureConfig; the data ready interrupt
+///          should be disabled.
+/// \param [in] pio Pio descriptor of port A.
+/// \param [in] config Parallel capture DMA ring configuration.
+void Pio_startParallelCaptureDma(
+		Pio *const pio, const Pio_ParallelCaptureDmaConfig *const config);
+
+/// \brief Gets the offset of the DMA write position in the ring buffer.
+/// \param [in] config Parallel capture DMA ring configuration, as passed to
+///             ::Pio_startParallelCaptureDma.
+/// \returns Offset in bytes from the start of the ring buffer, equal to the buffer size
+///          right before wrapping around.
+uint32_t Pio_getParallelCaptureDmaOffset(
+		const Pio_ParallelCaptureDmaConfig *const config);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
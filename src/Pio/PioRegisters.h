@@ -115,4 +115,34 @@ typedef struct {
 /// \brief Slow Clock Divider Debouncing register mask.
 #define PIO_SCDR_DIV_MASK 0x00003FFFu
 
+/// \brief Parallel Capture Mode register Parallel Capture Mode Enable offset.
+#define PIO_PCMR_PCEN_OFFSET 0u
+/// \brief Parallel Capture Mode register Parallel Capture Mode Enable mask.
+#define PIO_PCMR_PCEN_MASK 0x00000001u
+/// \brief Parallel Capture Mode register Data Size offset.
+#define PIO_PCMR_DSIZE_OFFSET 4u
+/// \brief Parallel Capture Mode register Data Size mask.
+#define PIO_PCMR_DSIZE_MASK 0x00000030u
+/// \brief Parallel Capture Mode register Parallel Capture Mode Always Sampling offset.
+#define PIO_PCMR_ALWYS_OFFSET 9u
+/// \brief Parallel Capture Mode register Parallel Capture Mode Always Sampling mask.
+#define PIO_PCMR_ALWYS_MASK 0x00000200u
+/// \brief Parallel Capture Mode register Parallel Capture Mode Half Sampling offset.
+#define PIO_PCMR_HALFS_OFFSET 10u
+/// \brief Parallel Capture Mode register Parallel Capture Mode Half Sampling mask.
+#define PIO_PCMR_HALFS_MASK 0x00000400u
+/// \brief Parallel Capture Mode register Parallel Capture Mode First Sample offset.
+#define PIO_PCMR_FRSTS_OFFSET 11u
+/// \brief Parallel Capture Mode register Parallel Capture Mode First Sample mask.
+#define PIO_PCMR_FRSTS_MASK 0x00000800u
+
+/// \brief Parallel Capture Interrupt registers Parallel Capture Mode Data Ready offset.
+#define PIO_PCISR_DRDY_OFFSET 0u
+/// \brief Parallel Capture Interrupt registers Parallel Capture Mode Data Ready mask.
+#define PIO_PCISR_DRDY_MASK 0x00000001u
+/// \brief Parallel Capture Interrupt registers Parallel Capture Mode Overrun Error offset.
+#define PIO_PCISR_OVRE_OFFSET 1u
+/// \brief Parallel Capture Interrupt registers Parallel Capture Mode Overrun Error mask.
+#define PIO_PCISR_OVRE_MASK 0x00000002u
+
 #endif // BSP_PIO_REGISTERS_H
@@ -30,6 +30,9 @@
 #include <Utils/ErrorCode.h>
 #include <Utils/Utils.h>
 
+#include <Eefc/Eefc.h>
+#include <Rstc/Rstc.h>
+
 #include "PmcPeripheralId.h"
 #include "PmcRegisters.h"
 
@@ -460,10 +463,33 @@ configurePllb(Pmc *pmc, const Pmc_PllConfig *const config,
 }
 #endif
 
+#if defined(N7S_TARGET_SAMRH71F20) || defined(N7S_TARGET_SAMRH707F18)
+static void
+setClockFailureConfig(Pmc *pmc, const Pmc_MainckConfig *const config)
+{
+	uint32_t ckgrMor = pmc->registers->ckgrMor;
+
+	ckgrMor &= ~CKGR_MOR_KEY_MASK;
+	ckgrMor |= BIT_FIELD_VALUE(CKGR_MOR_KEY, CKGR_MOR_KEY_VALUE);
+	ckgrMor &= ~(CKGR_MOR_CFDEN_MASK | CKGR_MOR_XT32KFME_MASK
+			| CKGR_MOR_BCPURST_MASK | CKGR_MOR_BCPUNMIC_MASK);
+	ckgrMor |= BIT_VALUE(CKGR_MOR_CFDEN, config->detectClockFail)
+			| BIT_VALUE(CKGR_MOR_XT32KFME,
+					config->xt32kMonitorEnabled)
+			| BIT_VALUE(CKGR_MOR_BCPURST,
+					config->badCpuResetEnabled)
+			| BIT_VALUE(CKGR_MOR_BCPUNMIC,
+					config->badCpuNmicIrqEnabled);
+
+	pmc->registers->ckgrMor = ckgrMor;
+}
+#endif
+
 void
 Pmc_init(Pmc *const pmc, Pmc_Registers *pmcRegistersAddress)
 {
 	pmc->registers = pmcRegistersAddress;
+	pmc->listeners = NULL;
 }
 
 bool
@@ -489,21 +515,7 @@ Pmc_setMainckConfig(Pmc *pmc, const Pmc_MainckConfig *const config,
 	}
 
 #if defined(N7S_TARGET_SAMRH71F20) || defined(N7S_TARGET_SAMRH707F18)
-	uint32_t ckgrMor = pmc->registers->ckgrMor;
-
-	ckgrMor &= ~CKGR_MOR_KEY_MASK;
-	ckgrMor |= BIT_FIELD_VALUE(CKGR_MOR_KEY, CKGR_MOR_KEY_VALUE);
-	ckgrMor &= ~(CKGR_MOR_CFDEN_MASK | CKGR_MOR_XT32KFME_MASK
-			| CKGR_MOR_BCPURST_MASK | CKGR_MOR_BCPUNMIC_MASK);
-	ckgrMor |= BIT_VALUE(CKGR_MOR_CFDEN, config->detectClockFail)
-			| BIT_VALUE(CKGR_MOR_XT32KFME,
-					config->xt32kMonitorEnabled)
-			| BIT_VALUE(CKGR_MOR_BCPURST,
-					config->badCpuResetEnabled)
-			| BIT_VALUE(CKGR_MOR_BCPUNMIC,
-					config->badCpuNmicIrqEnabled);
-
-	pmc->registers->ckgrMor = ckgrMor;
+	setClockFailureConfig(pmc, config);
 #endif
 
 	return true;
@@ -640,10 +652,258 @@ Pmc_getMasterckConfig(const Pmc *const pmc, Pmc_MasterckConfig *const config)
 	config->divider = (mckr & PMC_MCKR_MDIV_MASK) >> PMC_MCKR_MDIV_OFFSET;
 }
 
+static uint32_t
+getMasterckSourceFrequency(const Pmc_PllConfig *const pll,
+		const Pmc_MasterckSrc src, const uint32_t mainckFrequency)
+{
+	switch (src) {
+	case Pmc_MasterckSrc_Slck: return PMC_SLOW_CLOCK_FREQ;
+	case Pmc_MasterckSrc_Mainck: return mainckFrequency;
+	case Pmc_MasterckSrc_Pllack:
+		if ((pll->pllaMul == 0u) || (pll->pllaDiv == 0u))
+			return 0u;
+		return (uint32_t)(((uint64_t)mainckFrequency
+						  * ((uint64_t)pll->pllaMul + 1u))
+				/ pll->pllaDiv);
+	default: return 0u;
+	}
+}
+
+static uint32_t
+getMasterckPrescaler(const Pmc_MasterckPresc presc)
+{
+#if defined(N7S_TARGET_SAMV71Q21)
+	if (presc == Pmc_MasterckPresc_3)
+		return 3u;
+#endif
+	return 1u << (uint32_t)presc;
+}
+
+static void
+calculateFrequencies(const Pmc_PllConfig *const pll,
+		const Pmc_MasterckConfig *const masterck,
+		const uint32_t mainckFrequency,
+		Pmc_ClockFrequencies *const frequencies)
+{
+	frequencies->processorClockFrequency =
+			getMasterckSourceFrequency(
+					pll, masterck->src, mainckFrequency)
+			/ getMasterckPrescaler(masterck->presc);
+	frequencies->masterckFrequency = frequencies->processorClockFrequency
+			>> (uint32_t)masterck->divider;
+}
+
+static void
+readFrequencies(const Pmc *const pmc, const uint32_t mainckFrequency,
+		Pmc_ClockFrequencies *const frequencies)
+{
+	Pmc_PllConfig pll;
+	Pmc_MasterckConfig masterck;
+	Pmc_getPllConfig(pmc, &pll);
+	Pmc_getMasterckConfig(pmc, &masterck);
+
+	calculateFrequencies(&pll, &masterck, mainckFrequency, frequencies);
+}
+
+uint32_t
+Pmc_getProcessorClockFrequency(
+		const Pmc *const pmc, const uint32_t mainckFrequency)
+{
+	Pmc_ClockFrequencies frequencies;
+	readFrequencies(pmc, mainckFrequency, &frequencies);
+
+	return frequencies.processorClockFrequency;
+}
+
+uint32_t
+Pmc_getMasterckFrequency(const Pmc *const pmc, const uint32_t mainckFrequency)
+{
+	Pmc_ClockFrequencies frequencies;
+	readFrequencies(pmc, mainckFrequency, &frequencies);
+
+	return frequencies.masterckFrequency;
+}
+
+void
+Pmc_getOperatingPointFrequencies(const Pmc_OperatingPoint *const point,
+		Pmc_ClockFrequencies *const frequencies)
+{
+	calculateFrequencies(&point->pll, &point->masterck,
+			point->mainckFrequency, frequencies);
+}
+
+bool
+Pmc_validateOperatingPoint(const Pmc_OperatingPoint *const point,
+		const Pmc_ClockFrequencies *const limits, ErrorCode *const errCode)
+{
+	assert(point != NULL);
+	assert(limits != NULL);
+
+	if ((point->masterck.src != Pmc_MasterckSrc_Slck)
+			&& (point->masterck.src != Pmc_MasterckSrc_Mainck)
+			&& (point->masterck.src != Pmc_MasterckSrc_Pllack))
+		return returnError(errCode, Pmc_ErrorCode_InvalidClockSource);
+
+	if ((point->masterck.divider != Pmc_MasterckDiv_1)
+			&& (point->masterck.divider != Pmc_MasterckDiv_2))
+		return returnError(errCode, Pmc_ErrorCode_InvalidMasterckDiv);
+
+	Pmc_ClockFrequencies frequencies;
+	Pmc_getOperatingPointFrequencies(point, &frequencies);
+
+	if ((frequencies.masterckFrequency == 0u)
+			|| (frequencies.processorClockFrequency
+					> limits->processorClockFrequency)
+			|| (frequencies.masterckFrequency
+					> limits->masterckFrequency))
+		return returnError(
+				errCode, Pmc_ErrorCode_InvalidOperatingPoint);
+
+	return true;
+}
+
+void
+Pmc_registerClockChangeListener(
+		Pmc *const pmc, Pmc_ClockChangeListener *const listener)
+{
+	assert(listener != NULL);
+	assert(listener->callback != NULL);
+
+	listener->next = pmc->listeners;
+	pmc->listeners = listener;
+}
+
+void
+Pmc_unregisterClockChangeListener(
+		Pmc *const pmc, Pmc_ClockChangeListener *const listener)
+{
+	Pmc_ClockChangeListener **link = &pmc->listeners;
+	while ((*link != NULL) && (*link != listener))
+		link = &(*link)->next;
+
+	if (*link != NULL) {
+		*link = listener->next;
+		listener->next = NULL;
+	}
+}
+
+static void
+notifyListeners(const Pmc *const pmc, const Pmc_ClockChangePhase phase,
+		const Pmc_ClockFrequencies *const frequencies)
+{
+	for (const Pmc_ClockChangeListener *listener = pmc->listeners;
+			listener != NULL; listener = listener->next)
+		listener->callback(phase, frequencies, listener->arg);
+}
+
+static bool
+isPllaChangeRequired(const Pmc *const pmc, const Pmc_PllConfig *const config)
+{
+	const uint32_t ckgrPllar = pmc->registers->ckgrPllar;
+	const uint32_t mul = (ckgrPllar & CKGR_PLLAR_MULA_MASK)
+			>> CKGR_PLLAR_MULA_OFFSET;
+	const uint32_t div = (ckgrPllar & CKGR_PLLAR_DIVA_MASK)
+			>> CKGR_PLLAR_DIVA_OFFSET;
+	const bool isEnabled = (mul != 0u) && (div != 0u);
+	const bool isRequested =
+			(config->pllaMul != 0u) && (config->pllaDiv != 0u);
+
+	if (!isRequested)
+		// Keep an unused PLLA running, it may be needed by other clocks.
+		return false;
+
+	if (isEnabled && ((pmc->registers->sr & PMC_SR_LOCKA_MASK) == 0u))
+		return true;
+
+	return (!isEnabled) || (mul != config->pllaMul)
+			|| (div != config->pllaDiv)
+#if defined(N7S_TARGET_SAMRH71F20) || defined(N7S_TARGET_SAMRH707F18)
+			|| (((ckgrPllar & CKGR_PLLAR_FREQVCO_MASK)
+					    >> CKGR_PLLAR_FREQVCO_OFFSET)
+					!= config->pllaVco)
+#endif
+			;
+}
+
+static bool
+applyMasterckAndPlla(Pmc *const pmc, const Pmc_PllConfig *const pll,
+		const Pmc_MasterckConfig *const masterck, const uint32_t timeout,
+		ErrorCode *const errCode)
+{
+	if (isPllaChangeRequired(pmc, pll)) {
+		const uint32_t css = (pmc->registers->mckr & PMC_MCKR_CSS_MASK)
+				>> PMC_MCKR_CSS_OFFSET;
+		// PLLA cannot be reprogrammed while it drives the Master clock,
+		// the main clock is used in the meantime with the current prescaler.
+		if ((css == (uint32_t)Pmc_MasterckSrc_Pllack)
+				&& (!setMasterClockSource(pmc,
+						Pmc_MasterckSrc_Mainck, timeout,
+						errCode)))
+			return false;
+
+		if (!configurePlla(pmc, pll, timeout, errCode))
+			return false;
+	}
+
+	return Pmc_setMasterckConfig(pmc, masterck, timeout, errCode);
+}
+
+bool
+Pmc_changeMasterck(Pmc *const pmc, const Pmc_OperatingPoint *const point,
+		const uint32_t timeout, ErrorCode *const errCode)
+{
+	assert(point != NULL);
+
+	Pmc_ClockFrequencies frequencies;
+	Pmc_getOperatingPointFrequencies(point, &frequencies);
+	notifyListeners(pmc, Pmc_ClockChangePhase_Before, &frequencies);
+
+#if defined(N7S_TARGET_SAMV71Q21)
+	// Flash wait states must cover both the current and the requested
+	// frequency while the master clock is being switched.
+	const uint32_t waitStates = Eefc_getMinimumWaitStates(
+			frequencies.masterckFrequency);
+	if (waitStates > Eefc_getWaitStates())
+		Eefc_setWaitStates(waitStates);
+#endif
+
+	const bool result = applyMasterckAndPlla(
+			pmc, &point->pll, &point->masterck, timeout, errCode);
+
+	readFrequencies(pmc, point->mainckFrequency, &frequencies);
+#if defined(N7S_TARGET_SAMV71Q21)
+	Eefc_setWaitStatesForFrequency(frequencies.masterckFrequency);
+#endif
+	notifyListeners(pmc, Pmc_ClockChangePhase_After, &frequencies);
+
+	return result;
+}
+
+#if defined(N7S_TARGET_SAMV71Q21)
+static uint32_t
+getMainckFrequency(const Pmc_MainckConfig *const config)
+{
+	if (config->src != Pmc_MainckSrc_RcOsc)
+		return PMC_MAIN_CRYSTAL_FREQ;
+
+	switch (config->rcOscFreq) {
+	case Pmc_RcOscFreq_4M: return 4000000u;
+	case Pmc_RcOscFreq_8M: return 8000000u;
+	default: return 12000000u;
+	}
+}
+#endif
+
 bool
 Pmc_setConfig(Pmc *const pmc, const Pmc_Config *const config,
 		const uint32_t timeout, ErrorCode *const errCode)
 {
+#if defined(N7S_TARGET_SAMV71Q21)
+	// The clock path is unknown until the whole configuration is applied,
+	// use wait states safe for any frequency in the meantime.
+	Eefc_setWaitStates(EEFC_MAX_WAIT_STATES);
+#endif
+
 	if (!resetMainAndMasterClockConfiguration(pmc, timeout, errCode))
 		return false;
 
@@ -660,6 +920,11 @@ Pmc_setConfig(Pmc *const pmc, const Pmc_Config *const config,
 	if (!Pmc_setMasterckConfig(pmc, &config->masterck, timeout, errCode))
 		return false;
 
+#if defined(N7S_TARGET_SAMV71Q21)
+	Eefc_setWaitStatesForFrequency(Pmc_getMasterckFrequency(
+			pmc, getMainckFrequency(&config->mainck)));
+#endif
+
 	for (uint32_t i = 0; i < (uint32_t)Pmc_PckId_Count; i++) {
 		if (!Pmc_setPckConfig(pmc, (Pmc_PckId)i, &config->pck[i],
 				    timeout, errCode))
@@ -669,6 +934,197 @@ Pmc_setConfig(Pmc *const pmc, const Pmc_Config *const config,
 	return true;
 }
 
+static bool
+isWarmReset(void)
+{
+	switch (Rstc_getLastResetType()) {
+	case Rstc_ResetType_Watchdog:
+	case Rstc_ResetType_Software:
+	case Rstc_ResetType_User: return true;
+	default: return false;
+	}
+}
+
+static bool
+isMainckConfigSatisfied(
+		const Pmc *const pmc, const Pmc_MainckConfig *const config)
+{
+	const uint32_t ckgrMor = pmc->registers->ckgrMor;
+	const uint32_t sr = pmc->registers->sr;
+	const bool isXtalSelected = (ckgrMor & CKGR_MOR_MOSCSEL_MASK) != 0u;
+	const bool isRcEnabled = (ckgrMor & CKGR_MOR_MOSCRCEN_MASK) != 0u;
+#if defined(N7S_TARGET_SAMV71Q21) || defined(N7S_TARGET_SAMRH71F20)
+	const bool isBypassed = (ckgrMor & CKGR_MOR_MOSCXTBY_MASK) != 0u;
+#else
+	const bool isBypassed = false;
+#endif
+
+	if ((sr & PMC_SR_MOSCSELS_MASK) == 0u)
+		return false;
+
+	switch (config->src) {
+	case Pmc_MainckSrc_RcOsc:
+		return (!isXtalSelected) && isRcEnabled
+				&& (((ckgrMor & CKGR_MOR_MOSCRCF_MASK)
+						    >> CKGR_MOR_MOSCRCF_OFFSET)
+						== (uint32_t)config->rcOscFreq)
+				&& ((sr & PMC_SR_MOSCRCS_MASK) != 0u);
+	case Pmc_MainckSrc_XOsc:
+		return isXtalSelected && (!isRcEnabled) && (!isBypassed)
+				&& ((ckgrMor & CKGR_MOR_MOSCXTEN_MASK) != 0u)
+				&& (((ckgrMor & CKGR_MOR_MOSCXTST_MASK)
+						    >> CKGR_MOR_MOSCXTST_OFFSET)
+						== ((uint32_t)config->xoscStartupTime
+								>> 3u))
+				&& ((sr & PMC_SR_MOSCXTS_MASK) != 0u);
+#if defined(N7S_TARGET_SAMV71Q21) || defined(N7S_TARGET_SAMRH71F20)
+	case Pmc_MainckSrc_XOscBypassed:
+		return isXtalSelected && (!isRcEnabled) && isBypassed;
+#endif
+	default: return false;
+	}
+}
+
+#if defined(N7S_TARGET_SAMRH71F20) || defined(N7S_TARGET_SAMRH707F18)
+static bool
+isPllbConfigSatisfied(const Pmc *const pmc, const Pmc_PllConfig *const config)
+{
+	Pmc_PllConfig current;
+	Pmc_getPllConfig(pmc, &current);
+
+	if ((config->pllbDiv == 0u) || (config->pllbMul == 0u))
+		return (current.pllbDiv == 0u) || (current.pllbMul == 0u);
+
+	return (current.pllbSrc == config->pllbSrc)
+			&& (current.pllbMul == config->pllbMul)
+			&& (current.pllbDiv == config->pllbDiv)
+			&& (current.pllbVco == config->pllbVco)
+			&& (current.pllbFilterCapacitor
+					== config->pllbFilterCapacitor)
+			&& (current.pllbFilterResistor
+					== config->pllbFilterResistor)
+			&& (current.pllbCurrent == config->pllbCurrent)
+			&& ((pmc->registers->sr & PMC_SR_LOCKB_MASK) != 0u);
+}
+#endif
+
+static bool
+isPckConfigSatisfied(const Pmc *const pmc, const Pmc_PckId id,
+		const Pmc_PckConfig *const config)
+{
+	const uint32_t pck = BIT_FIELD_VALUE(PMC_PCK_CSS, config->src)
+			| BIT_FIELD_VALUE(PMC_PCK_PRES, config->presc);
+	const bool isEnabled = (pmc->registers->scsr
+					       & (1u << (PMC_SCSR_PCK0_OFFSET
+							       + (uint32_t)id)))
+			!= 0u;
+	const bool isReady = (pmc->registers->sr
+					     & (1u << (PMC_SR_PCKRDY0_OFFSET
+							     + (uint32_t)id)))
+			!= 0u;
+
+	return (pmc->registers->pck[id] == pck)
+			&& (isEnabled == config->isEnabled)
+			&& ((!isEnabled) || isReady);
+}
+
+bool
+Pmc_setConfigFastBoot(Pmc *const pmc, const Pmc_Config *const config,
+		const uint32_t timeout, ErrorCode *const errCode)
+{
+	if ((!isWarmReset())
+			|| (!isMainckConfigSatisfied(pmc, &config->mainck)))
+		return Pmc_setConfig(pmc, config, timeout, errCode);
+
+	// The main clock was verified before the reset, the measurement and
+	// oscillator startup are skipped.
+#if defined(N7S_TARGET_SAMRH71F20) || defined(N7S_TARGET_SAMRH707F18)
+	setClockFailureConfig(pmc, &config->mainck);
+	Pmc_setRc2OscillatorConfig(pmc, &config->rc2Osc);
+
+	if ((!isPllbConfigSatisfied(pmc, &config->pll))
+			&& (!configurePllb(
+					pmc, &config->pll, timeout, errCode)))
+		return false;
+#endif
+
+	Pmc_MasterckConfig masterck;
+	Pmc_getMasterckConfig(pmc, &masterck);
+	const bool isMasterckSatisfied = (masterck.src == config->masterck.src)
+			&& (masterck.presc == config->masterck.presc)
+			&& (masterck.divider == config->masterck.divider);
+
+	if ((!isMasterckSatisfied) || isPllaChangeRequired(pmc, &config->pll)) {
+#if defined(N7S_TARGET_SAMV71Q21)
+		Eefc_setWaitStates(EEFC_MAX_WAIT_STATES);
+#endif
+		if (!applyMasterckAndPlla(pmc, &config->pll, &config->masterck,
+				    timeout, errCode))
+			return false;
+	}
+
+#if defined(N7S_TARGET_SAMV71Q21)
+	Eefc_setWaitStatesForFrequency(Pmc_getMasterckFrequency(
+			pmc, getMainckFrequency(&config->mainck)));
+#endif
+
+	for (uint32_t i = 0; i < (uint32_t)Pmc_PckId_Count; i++) {
+		if (isPckConfigSatisfied(pmc, (Pmc_PckId)i, &config->pck[i]))
+			continue;
+		if (!Pmc_setPckConfig(pmc, (Pmc_PckId)i, &config->pck[i],
+				    timeout, errCode))
+			return false;
+	}
+
+	return true;
+}
+
+#if defined(N7S_TARGET_SAMV71Q21)
+void
+Pmc_setFastStartupConfig(
+		Pmc *const pmc, const Pmc_FastStartupConfig *const config)
+{
+	uint32_t fsmr = pmc->registers->fsmr;
+	fsmr &= ~(PMC_FSMR_FSTT_MASK | PMC_FSMR_RTTAL_MASK | PMC_FSMR_RTCAL_MASK
+			| PMC_FSMR_USBAL_MASK);
+	fsmr |= BIT_FIELD_VALUE(PMC_FSMR_FSTT, config->wakeupInputs)
+			| BIT_VALUE(PMC_FSMR_RTTAL, config->isRttAlarmEnabled)
+			| BIT_VALUE(PMC_FSMR_RTCAL, config->isRtcAlarmEnabled)
+			| BIT_VALUE(PMC_FSMR_USBAL, config->isUsbAlarmEnabled);
+
+	pmc->registers->fspr = BIT_FIELD_VALUE(
+			PMC_FSPR_FSTP, config->wakeupInputsActiveHigh);
+	pmc->registers->fsmr = fsmr;
+}
+
+bool
+Pmc_enterWaitMode(Pmc *const pmc, const Pmc_FlashLowPowerMode flashMode,
+		const uint32_t timeout, ErrorCode *const errCode)
+{
+	assert((pmc->registers->ckgrMor & CKGR_MOR_MOSCSEL_MASK) == 0u);
+
+	uint32_t fsmr = pmc->registers->fsmr;
+	fsmr &= ~(PMC_FSMR_LPM_MASK | PMC_FSMR_FLPM_MASK);
+	fsmr |= BIT_FIELD_VALUE(PMC_FSMR_FLPM, flashMode);
+	pmc->registers->fsmr = fsmr;
+
+	uint32_t ckgrMor = pmc->registers->ckgrMor;
+	ckgrMor &= ~CKGR_MOR_KEY_MASK;
+	ckgrMor |= BIT_FIELD_VALUE(CKGR_MOR_KEY, CKGR_MOR_KEY_VALUE)
+			| CKGR_MOR_WAITMODE_MASK;
+	pmc->registers->ckgrMor = ckgrMor;
+
+	// The core stops here until a fast startup event restarts the main RC
+	// oscillator and raises MCKRDY.
+	if (!waitForRegisterWithTimeout(
+			    &(pmc->registers->sr), PMC_SR_MCKRDY_MASK, timeout))
+		return returnError(
+				errCode, Pmc_ErrorCode_MasterClkReadyTimeout);
+
+	return true;
+}
+#endif
+
 void
 Pmc_getConfig(const Pmc *const pmc, Pmc_Config *const config)
 {
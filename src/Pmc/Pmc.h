@@ -93,6 +93,9 @@ typedef enum {
 	/// \brief PLL B not locked in a specified time.
 	Pmc_ErrorCode_PllbNotLocked = ERROR_CODE_DEFINE('P', 'M', 'C', 11),
 #endif
+	/// \brief Operating point exceeds the given limits or is inconsistent
+	Pmc_ErrorCode_InvalidOperatingPoint =
+			ERROR_CODE_DEFINE('P', 'M', 'C', 12),
 } Pmc_ErrorCode;
 
 /// \brief Main clock source selection enumeration.
@@ -321,10 +324,66 @@ typedef struct {
 	uint32_t measuredFreq; ///< Measured frequency.
 } Pmc_MainckMeasurement;
 
+#if defined(N7S_TARGET_SAMV71Q21)
+/// \brief Fast startup (Wait mode wake-up) sources configuration descriptor.
+typedef struct {
+	uint16_t wakeupInputs; ///< Mask of enabled WKUP0..15 fast startup inputs.
+	uint16_t wakeupInputsActiveHigh; ///< Mask of WKUP inputs triggering on a high level.
+	bool isRttAlarmEnabled; ///< RTT alarm triggers a fast startup.
+	bool isRtcAlarmEnabled; ///< RTC alarm triggers a fast startup.
+	bool isUsbAlarmEnabled; ///< USB alarm triggers a fast startup.
+} Pmc_FastStartupConfig;
+
+/// \brief Flash low-power mode selection in Wait mode.
+typedef enum {
+	Pmc_FlashLowPowerMode_Standby = 0, ///< Flash in standby mode, faster wake-up.
+	Pmc_FlashLowPowerMode_DeepPowerDown = 1, ///< Flash in deep power-down mode.
+} Pmc_FlashLowPowerMode;
+#endif
+
+/// \brief Master clock operating point, switched to by ::Pmc_changeMasterck.
+/// \details The main clock is not modified when switching operating points, so all
+///          operating points used together must share the same main clock.
+typedef struct {
+	Pmc_PllConfig pll; ///< Pll configuration, only PLLA is applied.
+	Pmc_MasterckConfig masterck; ///< Master clock configuration.
+	uint32_t mainckFrequency; ///< Main clock frequency in [Hz].
+} Pmc_OperatingPoint;
+
+/// \brief Frequencies resulting from an operating point.
+typedef struct {
+	uint32_t processorClockFrequency; ///< Processor clock (HCLK) frequency in [Hz].
+	uint32_t masterckFrequency; ///< Master clock (MCK) frequency in [Hz].
+} Pmc_ClockFrequencies;
+
+/// \brief Enumeration listing phases of a Master clock change.
+typedef enum {
+	/// \brief Clock is about to change, drivers shall finish or suspend transfers.
+	Pmc_ClockChangePhase_Before = 0,
+	/// \brief Clock has changed, drivers shall recompute their dividers.
+	Pmc_ClockChangePhase_After = 1,
+} Pmc_ClockChangePhase;
+
+/// \brief A function serving as a callback called around a Master clock change.
+/// \details For Pmc_ClockChangePhase_Before frequencies are the requested ones,
+///          for Pmc_ClockChangePhase_After they are read back from the hardware.
+typedef void (*PmcClockChangeCallback)(const Pmc_ClockChangePhase phase,
+		const Pmc_ClockFrequencies *const frequencies, void *arg);
+
+/// \brief A descriptor of a Master clock change listener.
+typedef struct Pmc_ClockChangeListener {
+	PmcClockChangeCallback callback; ///< Callback function.
+	void *arg; ///< Argument to the callback function.
+	struct Pmc_ClockChangeListener
+			*next; ///< Next registered listener, managed by the driver.
+} Pmc_ClockChangeListener;
+
 /// \brief Structure representing a PMC instance.
 typedef struct {
 	volatile Pmc_Registers
 			*registers; ///< Pointer to PMC instance registers.
+	Pmc_ClockChangeListener
+			*listeners; ///< Registered Master clock change listeners.
 } Pmc;
 
 /// \brief Returns PMC registers base address.
@@ -386,7 +445,89 @@ bool Pmc_setMasterckConfig(Pmc *const pmc,
 void Pmc_getMasterckConfig(
 		const Pmc *const pmc, Pmc_MasterckConfig *const config);
 
+/// \brief Function used to calculate the processor clock (HCLK) frequency from the current
+///        Master clock and PLLA configuration.
+/// \param [in] pmc PMC instance pointer
+/// \param [in] mainckFrequency Main clock frequency in [Hz], e.g. of the crystal in use.
+/// \returns Processor clock frequency in [Hz], 0 for an unsupported clock source.
+uint32_t Pmc_getProcessorClockFrequency(
+		const Pmc *const pmc, const uint32_t mainckFrequency);
+
+/// \brief Function used to calculate the Master clock (MCK) frequency from the current
+///        Master clock and PLLA configuration.
+/// \param [in] pmc PMC instance pointer
+/// \param [in] mainckFrequency Main clock frequency in [Hz], e.g. of the crystal in use.
+/// \returns Master clock frequency in [Hz], 0 for an unsupported clock source.
+uint32_t Pmc_getMasterckFrequency(
+		const Pmc *const pmc, const uint32_t mainckFrequency);
+
+/// \brief Function used to calculate frequencies resulting from an operating point.
+/// \param [in] point Operating point descriptor.
+/// \param [out] frequencies Resulting frequencies, 0 for an unsupported clock source.
+void Pmc_getOperatingPointFrequencies(const Pmc_OperatingPoint *const point,
+		Pmc_ClockFrequencies *const frequencies);
+
+/// \brief Function used to validate an operating point before it is used with
+///        ::Pmc_changeMasterck.
+/// \param [in] point Operating point descriptor.
+/// \param [in] limits Maximum allowed processor and master clock frequencies.
+/// \param [out] errCode Possible error code in case of a failure (may be NULL).
+/// \returns Whether the operating point is valid.
+bool Pmc_validateOperatingPoint(const Pmc_OperatingPoint *const point,
+		const Pmc_ClockFrequencies *const limits, ErrorCode *const errCode);
+
+/// \brief Function used to register a Master clock change listener.
+/// \param [in] pmc PMC instance pointer
+/// \param [in] listener Listener descriptor, must stay valid until unregistered.
+void Pmc_registerClockChangeListener(
+		Pmc *const pmc, Pmc_ClockChangeListener *const listener);
+
+/// \brief Function used to unregister a Master clock change listener.
+/// \param [in] pmc PMC instance pointer
+/// \param [in] listener Previously registered listener descriptor.
+void Pmc_unregisterClockChangeListener(
+		Pmc *const pmc, Pmc_ClockChangeListener *const listener);
+
+/// \brief Function used to switch the Master clock to another operating point.
+/// \details Unlike ::Pmc_setConfig, the main clock is kept and the RC oscillator is
+///          not used as an intermediate source. If the PLLA has to be reprogrammed while
+///          it drives the Master clock, the Master clock is temporarily switched to
+///          the main clock. Listeners are notified before and after the change, the
+///          latter also on failure. On SAMV71 the flash wait states are raised before
+///          the change if required and set to the minimum for the resulting Master clock
+///          afterwards, see ::Eefc_setWaitStatesForFrequency.
+/// \param [in] pmc PMC instance pointer
+/// \param [in] point Operating point validated with ::Pmc_validateOperatingPoint.
+/// \param [in] timeout Timeout for busy-wait operations on registers
+/// \param [out] errCode Possible error code in case of a failure (may be NULL).
+/// \returns Whether the operating point was successfully applied.
+bool Pmc_changeMasterck(Pmc *const pmc, const Pmc_OperatingPoint *const point,
+		const uint32_t timeout, ErrorCode *const errCode);
+
+#if defined(N7S_TARGET_SAMV71Q21)
+/// \brief Function used to select the sources of a fast startup from Wait mode.
+/// \param [in] pmc PMC instance pointer
+/// \param [in] config Configuration structure
+void Pmc_setFastStartupConfig(
+		Pmc *const pmc, const Pmc_FastStartupConfig *const config);
+
+/// \brief Function used to enter the Wait mode, returning after a fast startup.
+/// \details The main clock shall be driven by the main RC oscillator and the Master
+///          clock by the main clock. After the wake-up the core runs from the main
+///          RC oscillator, the previous configuration has to be restored by the caller.
+/// \param [in] pmc PMC instance pointer
+/// \param [in] flashMode Flash low-power mode used in Wait mode.
+/// \param [in] timeout Timeout for busy-wait operations on registers
+/// \param [out] errCode Possible error code in case of a failure (may be NULL).
+/// \returns Whether the Wait mode was entered and exited.
+bool Pmc_enterWaitMode(Pmc *const pmc, const Pmc_FlashLowPowerMode flashMode,
+		const uint32_t timeout, ErrorCode *const errCode);
+#endif
+
 /// \brief Function used to configure the PMC.
+/// \details On SAMV71 the flash wait states are set to the maximum for the duration of
+///          the clock changes and then to the minimum legal for the resulting Master
+///          clock, see ::Eefc_setWaitStatesForFrequency.
 /// \param [in] pmc PMC instance pointer
 /// \param [in] config PMC configuration descriptor.
 /// \param [in] timeout Timeout for busy-wait operations on registers
@@ -395,6 +536,21 @@ void Pmc_getMasterckConfig(
 bool Pmc_setConfig(Pmc *const pmc, const Pmc_Config *const config,
 		const uint32_t timeout, ErrorCode *const errCode);
 
+/// \brief Function used to configure the PMC, skipping steps already satisfied
+///        after a warm reset.
+/// \details After a watchdog, software or user reset (see ::Rstc_getLastResetType)
+///          the current main clock is compared with the requested one. If it matches,
+///          the RC oscillator fallback, oscillator startup and frequency measurement
+///          are skipped and only differing PLL, Master clock and programmable clock
+///          settings are applied. Otherwise ::Pmc_setConfig is used.
+/// \param [in] pmc PMC instance pointer
+/// \param [in] config PMC configuration descriptor.
+/// \param [in] timeout Timeout for busy-wait operations on registers
+/// \param [out] errCode Possible error code in case of a failure (may be NULL).
+/// \returns Whether the configuration was successfully set.
+bool Pmc_setConfigFastBoot(Pmc *const pmc, const Pmc_Config *const config,
+		const uint32_t timeout, ErrorCode *const errCode);
+
 /// \brief Function used to retrieve current configuration of the PMC.
 /// \param [in] pmc PMC instance pointer
 /// \param [out] config Pointer to a configuration descriptor used to store current configuration.
@@ -0,0 +1,125 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "PmcClockManager.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <Nvic/Nvic.h>
+
+#include "Pmc.h"
+
+#if defined(N7S_TARGET_SAMV71Q21)
+// Lower identifiers belong to system peripherals without gated clocks.
+#define FIRST_GATED_PERIPHERAL_ID 7u
+#define GATED_PERIPHERAL_ID_LIMIT 64u
+#elif defined(N7S_TARGET_SAMRH71F20) || defined(N7S_TARGET_SAMRH707F18)
+#define FIRST_GATED_PERIPHERAL_ID 0u
+#define GATED_PERIPHERAL_ID_LIMIT ((uint32_t)Pmc_PeripheralCount)
+#endif
+
+static Pmc pmc;
+static Pmc *managedPmc;
+static uint8_t referenceCounts[Pmc_PeripheralCount];
+
+static inline bool
+isGated(const Pmc_PeripheralId peripheralId)
+{
+	return ((uint32_t)peripheralId >= FIRST_GATED_PERIPHERAL_ID)
+			&& ((uint32_t)peripheralId < GATED_PERIPHERAL_ID_LIMIT);
+}
+
+void
+PmcClockManager_init(Pmc_Registers *const registers)
+{
+	assert(registers != NULL);
+
+	(void)memset(referenceCounts, 0, sizeof(referenceCounts));
+	Pmc_init(&pmc, registers);
+	managedPmc = &pmc;
+}
+
+void
+PmcClockManager_acquire(const Pmc_PeripheralId peripheralId)
+{
+	assert(isGated(peripheralId));
+
+	if (managedPmc == NULL)
+		return;
+
+	const uint32_t primask = Nvic_saveAndDisableIrq();
+	assert(referenceCounts[peripheralId] < UINT8_MAX);
+	if (referenceCounts[peripheralId] == 0u)
+		Pmc_enablePeripheralClk(managedPmc, peripheralId);
+	referenceCounts[peripheralId]++;
+	Nvic_restoreIrq(primask);
+}
+
+void
+PmcClockManager_release(const Pmc_PeripheralId peripheralId)
+{
+	assert(isGated(peripheralId));
+
+	if (managedPmc == NULL)
+		return;
+
+	// Unbalanced releases are ignored, as drivers may be shut down without
+	// a prior startup.
+	const uint32_t primask = Nvic_saveAndDisableIrq();
+	if (referenceCounts[peripheralId] > 0u) {
+		referenceCounts[peripheralId]--;
+		if (referenceCounts[peripheralId] == 0u)
+			Pmc_disablePeripheralClk(managedPmc, peripheralId);
+	}
+	Nvic_restoreIrq(primask);
+}
+
+uint8_t
+PmcClockManager_getReferenceCount(const Pmc_PeripheralId peripheralId)
+{
+	assert((uint32_t)peripheralId < (uint32_t)Pmc_PeripheralCount);
+
+	return referenceCounts[peripheralId];
+}
+
+uint32_t
+PmcClockManager_getEnabledClocks(
+		Pmc_PeripheralId *const ids, const uint32_t capacity)
+{
+	assert(managedPmc != NULL);
+
+	uint32_t count = 0u;
+	for (uint32_t id = FIRST_GATED_PERIPHERAL_ID;
+			id < GATED_PERIPHERAL_ID_LIMIT; ++id) {
+		if (!Pmc_isPeripheralClkEnabled(
+				    managedPmc, (Pmc_PeripheralId)id))
+			continue;
+		if ((ids != NULL) && (count < capacity))
+			ids[count] = (Pmc_PeripheralId)id;
+		count++;
+	}
+
+	return count;
+}
@@ -0,0 +1,84 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file PmcClockManager.h
+/// \addtogroup Bsp
+/// \brief Header containing interface for the reference counted peripheral clock manager.
+/// \details Drivers acquire the clocks of their peripherals on startup and release them
+///          on shutdown. A clock is enabled by its first acquisition and disabled when
+///          the last user releases it. Until ::PmcClockManager_init is called, acquiring
+///          and releasing has no effect, leaving the clocks to the application.
+
+#ifndef BSP_PMCCLOCKMANAGER_H
+#define BSP_PMCCLOCKMANAGER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "PmcPeripheralId.h"
+#include "PmcRegisters.h"
+
+/// @addtogroup PmcClockManager
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Initializes the clock manager, clearing all reference counts.
+/// \details Clocks already enabled are left running until acquired and released. The
+///          manager keeps its own PMC instance, so that drivers using it do not depend
+///          on the PMC configuration interface.
+/// \param [in] registers Base address of PMC registers.
+void PmcClockManager_init(Pmc_Registers *const registers);
+
+/// \brief Acquires a peripheral clock, enabling it on the first acquisition.
+/// \param [in] peripheralId Identifier of the peripheral clock.
+void PmcClockManager_acquire(const Pmc_PeripheralId peripheralId);
+
+/// \brief Releases a peripheral clock, disabling it on the last release.
+/// \param [in] peripheralId Identifier of the acquired peripheral clock.
+void PmcClockManager_release(const Pmc_PeripheralId peripheralId);
+
+/// \brief Returns the number of users of a peripheral clock.
+/// \param [in] peripheralId Identifier of the peripheral clock.
+/// \returns Reference count of the clock.
+uint8_t PmcClockManager_getReferenceCount(const Pmc_PeripheralId peripheralId);
+
+/// \brief Lists currently enabled peripheral clocks, as reported by the hardware.
+/// \details Clocks enabled directly with ::Pmc_enablePeripheralClk are reported as well,
+///          which allows finding clocks left running without a user.
+/// \param [out] ids Array receiving identifiers of enabled clocks (may be NULL).
+/// \param [in] capacity Number of elements of the ids array.
+/// \returns Number of enabled clocks, possibly greater than capacity.
+uint32_t PmcClockManager_getEnabledClocks(
+		Pmc_PeripheralId *const ids, const uint32_t capacity);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_PMCCLOCKMANAGER_H
@@ -112,9 +112,18 @@ typedef struct {
 #endif
 } Pmc_Registers;
 
+#if defined(BSP_HOST_REGISTERS)
+/// \brief In-memory PMC register model, see HostRegisters/HostRegisters.h.
+extern Pmc_Registers HostRegisters_pmc;
+#endif
+
 #if defined(N7S_TARGET_SAMV71Q21)
 
+#if defined(BSP_HOST_REGISTERS)
+#define PMC_BASE_ADDRESS ((uintptr_t)&HostRegisters_pmc)
+#else
 #define PMC_BASE_ADDRESS 0x400E0600
+#endif
 
 #define PMC_PCER0_MASK 0xFFFFFF80u
 #define PMC_PCDR0_MASK 0xFFFFFF80u
@@ -125,7 +134,11 @@ typedef struct {
 #define PMC_PCSR1_MASK 0x1F3FFFAFu
 
 #elif defined(N7S_TARGET_SAMRH71F20) || defined(N7S_TARGET_SAMRH707F18)
+#if defined(BSP_HOST_REGISTERS)
+#define PMC_BASE_ADDRESS ((uintptr_t)&HostRegisters_pmc)
+#else
 #define PMC_BASE_ADDRESS 0x4000C000u
+#endif
 
 #else
 #error "No target platform specified (missing N7S_TARGET_* macro)"
@@ -374,6 +387,11 @@ typedef struct {
 #define PMC_FSMR_FLPM_OFFSET    21u
 #define PMC_FSMR_FFLPM_MASK     0x00800000
 #define PMC_FSMR_FFLPM_OFFSET   23u
+#define PMC_FSMR_FSTT_MASK      0x0000FFFFu
+#define PMC_FSMR_FSTT_OFFSET    0u
+
+#define PMC_FSPR_FSTP_MASK      0x0000FFFFu
+#define PMC_FSPR_FSTP_OFFSET    0u
 #endif
 
 #define PMC_PCR_PID_MASK 0x0000007Fu
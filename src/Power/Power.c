@@ -0,0 +1,169 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Power.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <Dwt/Dwt.h>
+#include <Nvic/Nvic.h>
+#include <Scb/Scb.h>
+
+static void
+enterSdramLowPower(const Power *const power,
+		const Sdramc_LowPowerConfiguration mode)
+{
+	if (power->config.sdramc != NULL)
+		Sdramc_enterLowPower(power->config.sdramc, mode);
+}
+
+static bool
+exitSdramLowPower(const Power *const power, ErrorCode *const errCode)
+{
+	if ((power->config.sdramc != NULL)
+			&& (!Sdramc_exitLowPower(power->config.sdramc)))
+		return returnError(errCode, Power_ErrorCode_SdramRefreshError);
+
+	return true;
+}
+
+static uint32_t
+recordWakeLatency(Power *const power, const uint32_t wakeCycles)
+{
+	const uint32_t latency = Dwt_getCycleCount() - wakeCycles;
+	power->stats.lastWakeLatencyCycles = latency;
+	return latency;
+}
+
+#if defined(N7S_TARGET_SAMV71Q21)
+static bool
+switchToRcOscillator(Power *const power, ErrorCode *const errCode)
+{
+	Pmc *const pmc = power->config.pmc;
+	const uint32_t timeout = power->config.timeout;
+
+	// The Master clock leaves the PLLA first, so that the PLLA input can change.
+	Pmc_MasterckConfig masterck;
+	(void)memset(&masterck, 0, sizeof(masterck));
+	masterck.src = Pmc_MasterckSrc_Mainck;
+	masterck.presc = Pmc_MasterckPresc_1;
+	masterck.divider = Pmc_MasterckDiv_1;
+	if (!Pmc_setMasterckConfig(pmc, &masterck, timeout, errCode))
+		return false;
+
+	Pmc_MainckConfig mainck;
+	(void)memset(&mainck, 0, sizeof(mainck));
+	mainck.src = Pmc_MainckSrc_RcOsc;
+	mainck.rcOscFreq = power->config.waitRcOscFreq;
+	if (!Pmc_setMainckConfig(pmc, &mainck, timeout, errCode))
+		return false;
+
+	Pmc_PllConfig pll;
+	(void)memset(&pll, 0, sizeof(pll));
+	return Pmc_setPllConfig(pmc, &pll, timeout, errCode);
+}
+#endif
+
+void
+Power_init(Power *const power, const Power_Config *const config)
+{
+	assert(power != NULL);
+	assert(config != NULL);
+	assert(config->pmc != NULL);
+
+	(void)memset(power, 0, sizeof(Power));
+	power->config = *config;
+
+	Dwt_enableCycleCounter();
+}
+
+bool
+Power_sleep(Power *const power, ErrorCode *const errCode)
+{
+	// cppcheck-suppress misra-c2012-11.4
+	volatile Scb_Registers *const scb =
+			(volatile Scb_Registers *)SCB_BASE_ADDRESS;
+
+	const uint32_t primask = Nvic_saveAndDisableIrq();
+
+	enterSdramLowPower(power, power->config.sdramSleepMode);
+	scb->scr &= ~SCB_SCR_SLEEPDEEP_MASK;
+
+	// A pending interrupt wakes the core up even with interrupts masked.
+	MEMORY_SYNC_BARRIER();
+	asm volatile("wfi" ::: "memory");
+	const uint32_t wakeCycles = Dwt_getCycleCount();
+
+	const bool result = exitSdramLowPower(power, errCode);
+
+	power->stats.sleepCount++;
+	const uint32_t latency = recordWakeLatency(power, wakeCycles);
+	if (latency > power->stats.maxSleepWakeLatencyCycles)
+		power->stats.maxSleepWakeLatencyCycles = latency;
+
+	Nvic_restoreIrq(primask);
+	return result;
+}
+
+#if defined(N7S_TARGET_SAMV71Q21)
+bool
+Power_wait(Power *const power, ErrorCode *const errCode)
+{
+	Pmc *const pmc = power->config.pmc;
+
+	const uint32_t primask = Nvic_saveAndDisableIrq();
+
+	enterSdramLowPower(power, Sdramc_LowPowerConfiguration_SelfRefresh);
+
+	bool result = switchToRcOscillator(power, errCode);
+	if (result) {
+		Pmc_setFastStartupConfig(pmc, &power->config.wakeupSources);
+		result = Pmc_enterWaitMode(pmc, power->config.flashMode,
+				power->config.timeout, errCode);
+	}
+	const uint32_t wakeCycles = Dwt_getCycleCount();
+
+	// The clocks are restored also after a failure, to leave the core running
+	// at the configured frequency.
+	const bool isClockRestored = Pmc_setConfig(pmc,
+			&power->config.clockConfig, power->config.timeout,
+			errCode);
+	const bool isSdramRetained = exitSdramLowPower(power, errCode);
+
+	power->stats.waitCount++;
+	const uint32_t latency = recordWakeLatency(power, wakeCycles);
+	if (latency > power->stats.maxWaitWakeLatencyCycles)
+		power->stats.maxWaitWakeLatencyCycles = latency;
+
+	Nvic_restoreIrq(primask);
+	return result && isClockRestored && isSdramRetained;
+}
+#endif
+
+void
+Power_getStats(const Power *const power, Power_Stats *const stats)
+{
+	*stats = power->stats;
+}
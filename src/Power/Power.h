@@ -0,0 +1,127 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file Power.h
+/// \addtogroup Bsp
+/// \brief Header containing interface for the low-power Sleep and Wait modes.
+/// \details Sleep mode stops the core clock until an enabled interrupt, including PIO
+///          interrupts, becomes pending. Wait mode additionally stops the Master clock and
+///          all oscillators except the main RC oscillator, waking up on the fast startup
+///          sources only: WKUP pins, RTT, RTC and USB alarms. Peripheral clocks gated
+///          through ::PmcClockManager_release are not affected by either mode. SDRAM is
+///          placed in a low-power mode for the idle period and its content is checked on
+///          wake-up.
+
+#ifndef BSP_POWER_H
+#define BSP_POWER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <Pmc/Pmc.h>
+#include <Sdramc/Sdramc.h>
+#include <Utils/ErrorCode.h>
+
+/// @addtogroup Power
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Enumeration listing possible error codes.
+typedef enum {
+	/// \brief SDRAM refresh error detected during the low-power period.
+	Power_ErrorCode_SdramRefreshError = ERROR_CODE_DEFINE('P', 'W', 'R', 1),
+} Power_ErrorCode;
+
+/// \brief Power module configuration descriptor.
+typedef struct {
+	Pmc *pmc; ///< PMC instance, used by the Wait mode.
+	Sdramc *sdramc; ///< SDRAMC put into a low-power mode while idle, NULL if unused.
+	/// \brief SDRAM low-power mode in Sleep mode, self-refresh is always used in Wait mode.
+	Sdramc_LowPowerConfiguration sdramSleepMode;
+#if defined(N7S_TARGET_SAMV71Q21)
+	Pmc_Config clockConfig; ///< Clock configuration restored after the Wait mode.
+	Pmc_FastStartupConfig wakeupSources; ///< Wait mode wake-up sources.
+	Pmc_FlashLowPowerMode flashMode; ///< Flash low-power mode in Wait mode.
+	Pmc_RcOscFreq waitRcOscFreq; ///< Main RC oscillator frequency in Wait mode.
+	uint32_t timeout; ///< Timeout for busy-wait operations on PMC registers.
+#endif
+} Power_Config;
+
+/// \brief Structure holding low-power statistics.
+typedef struct {
+	uint32_t sleepCount; ///< Number of Sleep mode periods.
+	uint32_t waitCount; ///< Number of Wait mode periods.
+	/// \brief Core clock cycles from the wake-up until the clocks and SDRAM were restored.
+	uint32_t lastWakeLatencyCycles;
+	uint32_t maxSleepWakeLatencyCycles; ///< Largest Sleep mode wake-up latency.
+	uint32_t maxWaitWakeLatencyCycles; ///< Largest Wait mode wake-up latency.
+} Power_Stats;
+
+/// \brief Structure representing the power module.
+typedef struct {
+	Power_Config config; ///< Configuration descriptor.
+	Power_Stats stats; ///< Low-power statistics.
+} Power;
+
+/// \brief Initializes the power module and starts the DWT cycle counter.
+/// \param [out] power Power module descriptor.
+/// \param [in] config Configuration descriptor.
+void Power_init(Power *const power, const Power_Config *const config);
+
+/// \brief Enters Sleep mode until an interrupt becomes pending.
+/// \details Interrupts are masked for the duration of the call, so that the SDRAM is
+///          restored before the handler of the wake-up interrupt runs.
+/// \param [in,out] power Power module descriptor.
+/// \param [out] errCode Possible error code in case of a failure (may be NULL).
+/// \returns Whether the SDRAM content was retained.
+bool Power_sleep(Power *const power, ErrorCode *const errCode);
+
+#if defined(N7S_TARGET_SAMV71Q21)
+/// \brief Enters Wait mode until a fast startup event occurs.
+/// \details The Master clock is switched to the main RC oscillator and the PLLA is
+///          stopped before entering Wait mode. On wake-up the clock configuration from
+///          the descriptor is applied again. Interrupts are masked for the duration of
+///          the call.
+/// \param [in,out] power Power module descriptor.
+/// \param [out] errCode Possible error code in case of a failure (may be NULL).
+/// \returns Whether the Wait mode was entered, the clocks restored and the SDRAM content
+///          retained.
+bool Power_wait(Power *const power, ErrorCode *const errCode);
+#endif
+
+/// \brief Gets the low-power statistics.
+/// \param [in] power Power module descriptor.
+/// \param [out] stats Low-power statistics.
+void Power_getStats(const Power *const power, Power_Stats *const stats);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_POWER_H
@@ -0,0 +1,173 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Profile.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <Stubs/Stubs.h>
+
+#define PROFILE_DECIMAL_DIGITS_MAX 20u
+#define PROFILE_DECIMAL_BASE 10u
+#define PROFILE_CALIBRATION_ROUNDS 8u
+
+static Profile_Probe *probes;
+static uint32_t overheadCycles;
+
+void
+Profile_init(void)
+{
+	Dwt_enableCycleCounter();
+	probes = NULL;
+	overheadCycles = 0u;
+
+	Profile_Probe calibration;
+	Profile_initProbe(&calibration, "");
+	for (uint32_t i = 0u; i < PROFILE_CALIBRATION_ROUNDS; i++) {
+		Profile_begin(&calibration);
+		Profile_end(&calibration);
+	}
+
+	probes = NULL;
+	overheadCycles = calibration.minCycles;
+}
+
+void
+Profile_initProbe(Profile_Probe *const probe, const char *const name)
+{
+	assert(name != NULL);
+
+	probe->name = name;
+	Profile_resetProbe(probe);
+	probe->next = probes;
+	probes = probe;
+}
+
+void
+Profile_resetProbe(Profile_Probe *const probe)
+{
+	probe->beginCycles = 0u;
+	probe->count = 0u;
+	probe->minCycles = UINT32_MAX;
+	probe->maxCycles = 0u;
+	probe->totalCycles = 0u;
+	memset(probe->histogram, 0, sizeof(probe->histogram));
+}
+
+static inline uint32_t
+histogramBin(const uint32_t cycles)
+{
+	if (cycles < 2u)
+		return 0u;
+
+	const uint32_t bin = 31u - (uint32_t)__builtin_clz(cycles);
+	return (bin < PROFILE_HISTOGRAM_BIN_COUNT)
+			? bin
+			: (PROFILE_HISTOGRAM_BIN_COUNT - 1u);
+}
+
+void
+Profile_record(Profile_Probe *const probe, const uint32_t cycles)
+{
+	const uint32_t duration =
+			(cycles > overheadCycles) ? (cycles - overheadCycles) : 0u;
+
+	probe->count++;
+	probe->totalCycles += duration;
+	if (duration < probe->minCycles)
+		probe->minCycles = duration;
+	if (duration > probe->maxCycles)
+		probe->maxCycles = duration;
+	probe->histogram[histogramBin(duration)]++;
+}
+
+uint32_t
+Profile_getMeanCycles(const Profile_Probe *const probe)
+{
+	if (probe->count == 0u)
+		return 0u;
+
+	return (uint32_t)(probe->totalCycles / probe->count);
+}
+
+void
+Profile_writeString(const char *const string)
+{
+	for (const char *it = string; *it != '\0'; it++)
+		Stubs_writeByte((uint8_t)*it);
+}
+
+void
+Profile_writeDecimal(const uint64_t value)
+{
+	char digits[PROFILE_DECIMAL_DIGITS_MAX];
+	uint32_t length = 0u;
+	uint64_t remainder = value;
+
+	do {
+		digits[length] = (char)('0'
+				+ (char)(remainder % PROFILE_DECIMAL_BASE));
+		remainder /= PROFILE_DECIMAL_BASE;
+		length++;
+	} while (remainder != 0u);
+
+	while (length > 0u) {
+		length--;
+		Stubs_writeByte((uint8_t)digits[length]);
+	}
+}
+
+static void
+writeField(const char *const label, const uint64_t value)
+{
+	Profile_writeString(label);
+	Profile_writeDecimal(value);
+}
+
+static void
+dumpProbe(const Profile_Probe *const probe)
+{
+	Profile_writeString(probe->name);
+	writeField(" count=", probe->count);
+	writeField(" min=", (probe->count != 0u) ? probe->minCycles : 0u);
+	writeField(" max=", probe->maxCycles);
+	writeField(" mean=", Profile_getMeanCycles(probe));
+	Profile_writeString("\r\n ");
+
+	for (uint32_t bin = 0u; bin < PROFILE_HISTOGRAM_BIN_COUNT; bin++) {
+		if (probe->histogram[bin] == 0u)
+			continue;
+		writeField(" 2^", bin);
+		writeField(":", probe->histogram[bin]);
+	}
+	Profile_writeString("\r\n");
+}
+
+void
+Profile_dump(void)
+{
+	for (const Profile_Probe *it = probes; it != NULL; it = it->next)
+		dumpProbe(it);
+}
@@ -0,0 +1,122 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file Profile.h
+/// \addtogroup Bsp
+/// \brief Header containing interface for the cycle-accurate profiling service, built on
+///        the DWT cycle counter.
+
+#ifndef BSP_PROFILE_H
+#define BSP_PROFILE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <Dwt/Dwt.h>
+
+/// @addtogroup Profile
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef PROFILE_HISTOGRAM_BIN_COUNT
+/// \brief Number of histogram bins of a probe. Bin 0 counts scopes shorter than 2 cycles and
+///        bin n counts scopes of [2^n, 2^(n+1)) cycles; the last bin counts all longer scopes.
+#define PROFILE_HISTOGRAM_BIN_COUNT 24u
+#endif
+
+/// \brief Structure representing a named profiling probe, accumulating durations of
+///        the measured scopes.
+typedef struct Profile_Probe {
+	const char *name; ///< Probe name, used in dumps.
+	uint32_t beginCycles; ///< Cycle counter value at the beginning of the current scope.
+	uint32_t count; ///< Number of measured scopes.
+	uint32_t minCycles; ///< Shortest scope duration.
+	uint32_t maxCycles; ///< Longest scope duration.
+	uint64_t totalCycles; ///< Sum of scope durations.
+	uint32_t histogram[PROFILE_HISTOGRAM_BIN_COUNT]; ///< Logarithmic duration histogram.
+	struct Profile_Probe *next; ///< Next registered probe.
+} Profile_Probe;
+
+/// \brief Starts the cycle counter and measures the overhead of an empty scope, which is
+///        subtracted from all the measured durations.
+void Profile_init(void);
+
+/// \brief Initializes a probe and registers it for ::Profile_dump.
+/// \param [out] probe Probe to initialize, must stay valid as long as the service is used.
+/// \param [in] name Probe name.
+void Profile_initProbe(Profile_Probe *const probe, const char *const name);
+
+/// \brief Clears accumulated measurements of a probe.
+/// \param [in,out] probe Probe.
+void Profile_resetProbe(Profile_Probe *const probe);
+
+/// \brief Adds a scope duration to the probe measurements.
+/// \param [in,out] probe Probe.
+/// \param [in] cycles Scope duration in core clock cycles.
+void Profile_record(Profile_Probe *const probe, const uint32_t cycles);
+
+/// \brief Begins a measured scope.
+/// \param [in,out] probe Probe.
+static inline void
+Profile_begin(Profile_Probe *const probe)
+{
+	probe->beginCycles = Dwt_getCycleCount();
+}
+
+/// \brief Ends a measured scope, begun with ::Profile_begin, and records its duration.
+/// \param [in,out] probe Probe.
+static inline void
+Profile_end(Profile_Probe *const probe)
+{
+	Profile_record(probe, Dwt_getCycleCount() - probe->beginCycles);
+}
+
+/// \brief Returns the mean scope duration of a probe.
+/// \param [in] probe Probe.
+/// \returns Mean duration in core clock cycles, 0 if no scope was measured.
+uint32_t Profile_getMeanCycles(const Profile_Probe *const probe);
+
+/// \brief Writes measurements of all registered probes as text, through ::Stubs_writeByte.
+/// \details Each probe is written in a line holding its name, count, minimum, maximum and
+///          mean duration in cycles, followed by a line with the non-empty histogram bins.
+void Profile_dump(void);
+
+/// \brief Writes a string through ::Stubs_writeByte.
+/// \param [in] string Null-terminated string.
+void Profile_writeString(const char *const string);
+
+/// \brief Writes an unsigned decimal number through ::Stubs_writeByte.
+/// \param [in] value Number to write.
+void Profile_writeDecimal(const uint64_t value);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_PROFILE_H
@@ -0,0 +1,194 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ProfileIrq.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <Dwt/Dwt.h>
+
+#include "Profile.h"
+
+#define PROFILE_IRQ_PERMILLE 1000u
+
+static ProfileIrq_Entry entries[Nvic_InterruptCount];
+static uint32_t windowStartCycles;
+static uint32_t nestedCycles;
+
+static void
+dispatch(void)
+{
+	const uint32_t entryCycles = Dwt_getCycleCount();
+
+	uint32_t ipsr;
+	asm volatile("mrs %0, ipsr" : "=r"(ipsr));
+	ProfileIrq_Entry *const entry =
+			&entries[ipsr - (uint32_t)Nvic_SystemExceptionCount];
+
+	if (entry->isTriggered) {
+		const uint32_t latency = entryCycles - entry->triggerCycles;
+		if (latency > entry->maxLatencyCycles)
+			entry->maxLatencyCycles = latency;
+		entry->isTriggered = false;
+	}
+
+	// Nested handlers add their durations to nestedCycles, which is then
+	// excluded from the duration of this handler.
+	const uint32_t outerNestedCycles = nestedCycles;
+	nestedCycles = 0u;
+
+	entry->handler();
+
+	const uint32_t duration = Dwt_getCycleCount() - entryCycles;
+	const uint32_t ownDuration = duration - nestedCycles;
+	nestedCycles = outerNestedCycles + duration;
+
+	entry->count++;
+	entry->totalDurationCycles += ownDuration;
+	if (ownDuration > entry->maxDurationCycles)
+		entry->maxDurationCycles = ownDuration;
+}
+
+static void
+resetEntry(ProfileIrq_Entry *const entry)
+{
+	entry->count = 0u;
+	entry->isTriggered = false;
+	entry->triggerCycles = 0u;
+	entry->maxLatencyCycles = 0u;
+	entry->maxDurationCycles = 0u;
+	entry->totalDurationCycles = 0u;
+}
+
+bool
+ProfileIrq_init(void)
+{
+	for (uint32_t i = 0u; i < (uint32_t)Nvic_InterruptCount; i++)
+		if (entries[i].handler != NULL)
+			return false;
+
+	Dwt_enableCycleCounter();
+	(void)memset(entries, 0, sizeof(entries));
+	nestedCycles = 0u;
+	windowStartCycles = Dwt_getCycleCount();
+
+	return true;
+}
+
+void
+ProfileIrq_instrument(const Nvic_Irq irqn)
+{
+	assert(((int32_t)irqn >= 0) && (irqn < Nvic_InterruptCount));
+
+	ProfileIrq_Entry *const entry = &entries[irqn];
+	if (entry->handler != NULL)
+		return;
+
+	resetEntry(entry);
+	entry->handler = Nvic_getInterruptHandlerAddress(irqn);
+	Nvic_setInterruptHandlerAddress(irqn, dispatch);
+}
+
+void
+ProfileIrq_restore(const Nvic_Irq irqn)
+{
+	assert(((int32_t)irqn >= 0) && (irqn < Nvic_InterruptCount));
+
+	ProfileIrq_Entry *const entry = &entries[irqn];
+	if (entry->handler == NULL)
+		return;
+
+	Nvic_setInterruptHandlerAddress(irqn, entry->handler);
+	entry->handler = NULL;
+}
+
+void
+ProfileIrq_trigger(const Nvic_Irq irqn)
+{
+	assert(((int32_t)irqn >= 0) && (irqn < Nvic_InterruptCount));
+
+	ProfileIrq_Entry *const entry = &entries[irqn];
+	entry->triggerCycles = Dwt_getCycleCount();
+	entry->isTriggered = true;
+	Nvic_triggerInterrupt(irqn);
+}
+
+void
+ProfileIrq_reset(void)
+{
+	const uint32_t primask = Nvic_saveAndDisableIrq();
+	for (uint32_t i = 0u; i < (uint32_t)Nvic_InterruptCount; i++)
+		resetEntry(&entries[i]);
+	windowStartCycles = Dwt_getCycleCount();
+	Nvic_restoreIrq(primask);
+}
+
+const ProfileIrq_Entry *
+ProfileIrq_getEntry(const Nvic_Irq irqn)
+{
+	assert(((int32_t)irqn >= 0) && (irqn < Nvic_InterruptCount));
+	return &entries[irqn];
+}
+
+uint32_t
+ProfileIrq_getLoadPermille(const Nvic_Irq irqn)
+{
+	assert(((int32_t)irqn >= 0) && (irqn < Nvic_InterruptCount));
+
+	const uint32_t window = Dwt_getCycleCount() - windowStartCycles;
+	if (window == 0u)
+		return 0u;
+
+	return (uint32_t)((entries[irqn].totalDurationCycles
+					  * PROFILE_IRQ_PERMILLE)
+			/ window);
+}
+
+void
+ProfileIrq_dump(void)
+{
+	for (uint32_t i = 0u; i < (uint32_t)Nvic_InterruptCount; i++) {
+		const ProfileIrq_Entry *const entry = &entries[i];
+		if (entry->handler == NULL)
+			continue;
+
+		Profile_writeString("irq ");
+		Profile_writeDecimal(i);
+		Profile_writeString(" count=");
+		Profile_writeDecimal(entry->count);
+		Profile_writeString(" latency=");
+		Profile_writeDecimal(entry->maxLatencyCycles);
+		Profile_writeString(" max=");
+		Profile_writeDecimal(entry->maxDurationCycles);
+		Profile_writeString(" mean=");
+		Profile_writeDecimal((entry->count != 0u)
+						? (entry->totalDurationCycles
+								/ entry->count)
+						: 0u);
+		Profile_writeString(" load=");
+		Profile_writeDecimal(ProfileIrq_getLoadPermille((Nvic_Irq)i));
+		Profile_writeString("\r\n");
+	}
+}
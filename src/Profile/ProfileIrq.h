@@ -0,0 +1,108 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file ProfileIrq.h
+/// \addtogroup Bsp
+/// \brief Header containing interface for the interrupt latency and load measurement
+///        service, built on the DWT cycle counter.
+/// \details An instrumented interrupt has its vector table entry replaced with a common
+///          dispatcher, which timestamps the entry and exit of the original handler. The
+///          vector table shall be writable, e.g. placed in RAM by the startup code.
+
+#ifndef BSP_PROFILEIRQ_H
+#define BSP_PROFILEIRQ_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <Nvic/Nvic.h>
+
+/// @addtogroup ProfileIrq
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Structure holding measurements of a single interrupt.
+typedef struct {
+	Nvic_InterruptHandler handler; ///< Original handler, NULL if not instrumented.
+	uint32_t count; ///< Number of handled interrupts.
+	volatile bool isTriggered; ///< Is a latency measurement pending.
+	uint32_t triggerCycles; ///< Cycle counter value at ::ProfileIrq_trigger.
+	uint32_t maxLatencyCycles; ///< Longest trigger to handler entry time.
+	uint32_t maxDurationCycles; ///< Longest handler duration.
+	uint64_t totalDurationCycles; ///< Sum of handler durations.
+} ProfileIrq_Entry;
+
+/// \brief Starts the cycle counter and clears all measurements.
+/// \details Clearing the entries of instrumented interrupts would lose their original
+///          handlers, so the call is rejected while any interrupt is instrumented.
+/// \returns Whether the service was initialized, false if any interrupt is instrumented.
+bool ProfileIrq_init(void);
+
+/// \brief Replaces the handler of an interrupt with the measuring dispatcher.
+/// \param [in] irqn Interrupt to be instrumented.
+void ProfileIrq_instrument(const Nvic_Irq irqn);
+
+/// \brief Restores the original handler of an instrumented interrupt.
+/// \param [in] irqn Interrupt to be restored.
+void ProfileIrq_restore(const Nvic_Irq irqn);
+
+/// \brief Triggers an interrupt through ::Nvic_triggerInterrupt, measuring the latency
+///        of the handler entry.
+/// \details Hardware interrupts have no timestamp of becoming pending, so the latency is
+///          only measured for triggered interrupts.
+/// \param [in] irqn Interrupt to be triggered.
+void ProfileIrq_trigger(const Nvic_Irq irqn);
+
+/// \brief Clears measurements of all interrupts and starts a new load measurement window.
+void ProfileIrq_reset(void);
+
+/// \brief Returns measurements of an interrupt.
+/// \param [in] irqn Interrupt.
+/// \returns Interrupt measurements.
+const ProfileIrq_Entry *ProfileIrq_getEntry(const Nvic_Irq irqn);
+
+/// \brief Returns the CPU share taken by an interrupt handler.
+/// \details Handler durations exclude the time of nested interrupts, which are accounted
+///          to the nested handlers. The window, started by ::ProfileIrq_reset, shall be
+///          shorter than the cycle counter range.
+/// \param [in] irqn Interrupt.
+/// \returns CPU share in permille of the current window.
+uint32_t ProfileIrq_getLoadPermille(const Nvic_Irq irqn);
+
+/// \brief Writes measurements of all instrumented interrupts as text, through
+///        ::Stubs_writeByte.
+/// \details Each interrupt is written in a line holding its number, count, maximum
+///          latency, maximum and mean duration in cycles and load in permille.
+void ProfileIrq_dump(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_PROFILEIRQ_H
@@ -34,8 +34,8 @@
 
 #include "ScbRegisters.h"
 
-#ifdef CLANG_TIDY
-// Clang-tidy assumes x86 architecture.
+#if defined(CLANG_TIDY) || defined(BSP_HOST_REGISTERS)
+// Clang-tidy assumes x86 architecture, host builds run on one.
 #define ASM_R0 "eax"
 #define ASM_R1 "ebx"
 #define ASM_R2 "ecx"
@@ -55,13 +55,62 @@
 extern "C" {
 #endif
 
+#if defined(BSP_HOST_REGISTERS)
+// Register models live in the host memory, only the access order has to be kept.
+// Cache maintenance is skipped, as the modelled CCR reports the caches as disabled.
+/// \brief A data synchronization barrier macro.
+#define DATA_SYNC_BARRIER() __sync_synchronize()
+/// \brief An instruction synchronization barrier macro.
+#define INSTRUCTION_SYNC_BARRIER() __sync_synchronize()
+/// \brief Set/way cache maintenance sequence, reduced to a barrier.
+#define SCB_CACHE_MAINTENANCE_ASM(...) __sync_synchronize()
+// Operands prepared for the reduced sequences are left unused.
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-variable"
+#else
+/// \brief A data synchronization barrier macro.
+#define DATA_SYNC_BARRIER() asm volatile("dsb" ::: "memory")
+/// \brief An instruction synchronization barrier macro.
+#define INSTRUCTION_SYNC_BARRIER() asm volatile("isb" ::: "memory")
+/// \brief Set/way cache maintenance sequence.
+#define SCB_CACHE_MAINTENANCE_ASM(...) asm volatile(__VA_ARGS__)
+#endif
+
 /// \brief A memory barrier macro.
 #define MEMORY_SYNC_BARRIER() \
 	do { \
-		asm volatile("dsb" ::: "memory"); \
-		asm volatile("isb" ::: "memory"); \
+		DATA_SYNC_BARRIER(); \
+		INSTRUCTION_SYNC_BARRIER(); \
 	} while (0)
 
+/// \brief Mask of the address bits within a cache line.
+#define SCB_CACHE_LINE_MASK (SCB_CACHE_LINE_SIZE - 1u)
+
+/// \brief Aligns a buffer declaration to the cache line size, so that a DMA buffer does not
+///        share cache lines with unrelated data. The buffer size should also be a multiple
+///        of ::SCB_CACHE_LINE_SIZE.
+#define SCB_CACHE_ALIGNED __attribute__((aligned(SCB_CACHE_LINE_SIZE)))
+
+/// \brief Places a function in the ITCM, see the `.itcm_text` section of the linker script.
+/// \details Calls between ITCM and SRAM are out of the branch range and go through linker
+///          generated veneers.
+#define SCB_ITCM_TEXT __attribute__((section(".itcm_text")))
+
+/// \brief Places a function in the SRAM, see the `.ramfunc` input of the `.relocate` section
+///        of the linker script.
+/// \details Intended for hot code of images executing from flash, where it avoids the flash
+///          wait states. The code is copied along with the initialized data by Reset_Handler.
+#define SCB_RAM_TEXT __attribute__((section(".ramfunc")))
+
+/// \brief Places a variable in the DTCM, see the `.dtcm_data` section of the linker script.
+#define SCB_DTCM_DATA __attribute__((section(".dtcm_data")))
+
+#ifndef SCB_DCACHE_SET_WAY_THRESHOLD
+/// \brief Range size in bytes, above which the range maintenance functions operate on the
+///        whole data cache by set/way instead of walking the range line by line.
+#define SCB_DCACHE_SET_WAY_THRESHOLD 16384u
+#endif
+
 /// \brief Returns whether the instruction cache is enabled.
 /// \returns Whether the instruction cache is enabled.
 static inline bool
@@ -117,7 +166,7 @@ Scb_disableICache(void)
 	//   asm volatile ("dsb");
 	//   asm volatile ("isb");
 	const uint32_t newCcr = scb->ccr & ~(uint32_t)SCB_CCR_IC_MASK;
-	asm volatile("mov r1, #0\n" // r1 = 0;
+	SCB_CACHE_MAINTENANCE_ASM("mov r1, #0\n" // r1 = 0;
 		     "dsb\n"
 		     "isb\n"
 		     "str %2, [%1]\n" // *CCR = newCcr;
@@ -159,7 +208,7 @@ Scb_enableICache(void)
 	//   asm volatile ("dsb");
 	//   asm volatile ("isb");
 	const uint32_t newCcr = scb->ccr | SCB_CCR_IC_MASK;
-	asm volatile("mov r1, #0\n" // r1 = 0;
+	SCB_CACHE_MAINTENANCE_ASM("mov r1, #0\n" // r1 = 0;
 		     "dsb\n" //
 		     "isb\n" //
 		     "str r1, [%0]\n" // *ICIALLU = r1 (0);
@@ -197,7 +246,7 @@ Scb_cleanDCache(void)
 	const uint32_t ways = (ccsidr & SCB_CCSIDR_ASSOCIATIVITY_MASK)
 			>> SCB_CCSIDR_ASSOCIATIVITY_OFFSET;
 
-	asm volatile("dsb\n"
+	SCB_CACHE_MAINTENANCE_ASM("dsb\n"
 		     "ESETLOOP%=:\n"
 		     "mov r0, %2\n" // r0(way) = ways;
 		     "EWAYLOOP%=:\n" //
@@ -252,7 +301,7 @@ Scb_invalidateDCache(void)
 	//     "isb\n"
 	//   );
 
-	asm volatile("dsb\n"
+	SCB_CACHE_MAINTENANCE_ASM("dsb\n"
 		     "ESETLOOP%=:\n"
 		     "mov r0, %2\n" // r0(way) = ways;
 		     "EWAYLOOP%=:\n" //
@@ -288,11 +337,11 @@ Scb_invalidateICache(void)
 	static volatile Scb_Registers *const scb =
 			(volatile Scb_Registers *)SCB_BASE_ADDRESS;
 
-	asm volatile("dsb");
-	asm volatile("isb");
+	DATA_SYNC_BARRIER();
+	INSTRUCTION_SYNC_BARRIER();
 	scb->iciallu = 0u;
-	asm volatile("dsb");
-	asm volatile("isb");
+	DATA_SYNC_BARRIER();
+	INSTRUCTION_SYNC_BARRIER();
 
 	return true;
 }
@@ -315,7 +364,7 @@ Scb_invalidateDCacheByAddr(const void *const addr, const uint32_t size)
 
 	// cppcheck-suppress misra-c2012-11.6
 	uint32_t addrValue = (uint32_t)addr;
-	asm volatile("dsb");
+	DATA_SYNC_BARRIER();
 
 	uint32_t bytesLeft = size;
 	while (bytesLeft != 0u) {
@@ -323,8 +372,8 @@ Scb_invalidateDCacheByAddr(const void *const addr, const uint32_t size)
 		addrValue += SCB_CACHE_LINE_SIZE;
 		bytesLeft -= SCB_CACHE_LINE_SIZE;
 	}
-	asm volatile("dsb");
-	asm volatile("isb");
+	DATA_SYNC_BARRIER();
+	INSTRUCTION_SYNC_BARRIER();
 
 	return true;
 }
@@ -347,7 +396,7 @@ Scb_invalidateICacheByAddr(const void *const addr, const uint32_t size)
 
 	// cppcheck-suppress misra-c2012-11.6
 	uint32_t addrValue = (uint32_t)addr;
-	asm volatile("dsb");
+	DATA_SYNC_BARRIER();
 
 	uint32_t bytesLeft = size;
 	while (bytesLeft != 0u) {
@@ -355,8 +404,8 @@ Scb_invalidateICacheByAddr(const void *const addr, const uint32_t size)
 		addrValue += SCB_CACHE_LINE_SIZE;
 		bytesLeft -= SCB_CACHE_LINE_SIZE;
 	}
-	asm volatile("dsb");
-	asm volatile("isb");
+	DATA_SYNC_BARRIER();
+	INSTRUCTION_SYNC_BARRIER();
 
 	return true;
 }
@@ -379,7 +428,7 @@ Scb_cleanInvalidateDCacheByAddr(const void *const addr, const uint32_t size)
 
 	// cppcheck-suppress misra-c2012-11.6
 	uint32_t addrValue = (uint32_t)addr;
-	asm volatile("dsb");
+	DATA_SYNC_BARRIER();
 
 	uint32_t bytesLeft = size;
 	while (bytesLeft != 0u) {
@@ -387,8 +436,8 @@ Scb_cleanInvalidateDCacheByAddr(const void *const addr, const uint32_t size)
 		addrValue += SCB_CACHE_LINE_SIZE;
 		bytesLeft -= SCB_CACHE_LINE_SIZE;
 	}
-	asm volatile("dsb");
-	asm volatile("isb");
+	DATA_SYNC_BARRIER();
+	INSTRUCTION_SYNC_BARRIER();
 
 	return true;
 }
@@ -411,7 +460,7 @@ Scb_cleanDCacheByAddr(const void *const addr, const uint32_t size)
 
 	// cppcheck-suppress misra-c2012-11.6
 	uint32_t addrValue = (uint32_t)addr;
-	asm volatile("dsb");
+	DATA_SYNC_BARRIER();
 
 	uint32_t bytesLeft = size;
 	while (bytesLeft != 0u) {
@@ -419,8 +468,8 @@ Scb_cleanDCacheByAddr(const void *const addr, const uint32_t size)
 		addrValue += SCB_CACHE_LINE_SIZE;
 		bytesLeft -= SCB_CACHE_LINE_SIZE;
 	}
-	asm volatile("dsb");
-	asm volatile("isb");
+	DATA_SYNC_BARRIER();
+	INSTRUCTION_SYNC_BARRIER();
 
 	return true;
 }
@@ -458,7 +507,7 @@ Scb_enableDCache(void)
 	//   );
 
 	const uint32_t newCcr = scb->ccr | SCB_CCR_DC_MASK;
-	asm volatile("dsb\n"
+	SCB_CACHE_MAINTENANCE_ASM("dsb\n"
 		     "ESETLOOP%=:\n"
 		     "mov r0, %[ways]\n" // r0(way) = ways;
 		     "EWAYLOOP%=:\n" //
@@ -522,7 +571,7 @@ Scb_disableDCache(void)
 	//     "isb\n"
 	//   );
 	const uint32_t newCcr = scb->ccr & ~(uint32_t)SCB_CCR_DC_MASK;
-	asm volatile("dsb\n"
+	SCB_CACHE_MAINTENANCE_ASM("dsb\n"
 		     "str %2, [%1]\n" // CCR = newCcr;
 		     "DSETLOOP%=:\n" //
 		     "mov r0, %4\n" // r0(way) = ways;
@@ -549,6 +598,159 @@ Scb_disableDCache(void)
 	return true;
 }
 
+/// \brief Cleans and invalidates the whole data cache, leaving it enabled.
+/// \returns Whether the cache clean-invalidation procedure was executed.
+static inline bool
+Scb_cleanInvalidateDCache(void)
+{
+	if (!Scb_isDCacheEnabled())
+		return false;
+	// cppcheck-suppress misra-c2012-11.4
+	static const volatile Scb_Registers *const scb =
+			(volatile Scb_Registers *)SCB_BASE_ADDRESS;
+	const uint32_t ccsidr = scb->ccsidr;
+	const uint32_t sets = (ccsidr & SCB_CCSIDR_NUMSETS_MASK)
+			>> SCB_CCSIDR_NUMSETS_OFFSET;
+	const uint32_t ways = (ccsidr & SCB_CCSIDR_ASSOCIATIVITY_MASK)
+			>> SCB_CCSIDR_ASSOCIATIVITY_OFFSET;
+
+	SCB_CACHE_MAINTENANCE_ASM("dsb\n"
+		     "CSETLOOP%=:\n"
+		     "mov r0, %2\n" // r0(way) = ways;
+		     "CWAYLOOP%=:\n" //
+		     "mov r1, %1\n" // r1 = sets;
+		     "lsl r1, %3\n" // r1 = r1 << SCB_DCCISW_SET_OFFSET;
+		     "mov r2, r0\n" // r2 = way;
+		     "lsl r2, %4\n" // r2 = r2 << SCB_DCCISW_WAY_OFFSET;
+		     "orr r1, r2\n" // r1 |= r2;
+		     "str r1, [%0]\n" // DCCISW = r1;
+		     "sub r0, r0, 1\n" // r1(ways)--;
+		     "cmp r0, 0\n" //
+		     "bge CWAYLOOP%=\n" // while(way >= 0);
+		     "sub %1, %1, 1\n" // r0(sets)--;
+		     "cmp %1, 0\n" //
+		     "bge CSETLOOP%=\n" // while(set >= 0);
+		     "dsb\n"
+		     "isb\n"
+			:
+			: "r"(&(scb->dccisw)), "r"(sets), "r"(ways),
+			"n"(SCB_DCCISW_SET_OFFSET), "n"(SCB_DCCISW_WAY_OFFSET)
+			: ASM_R0, ASM_R1, ASM_R2);
+
+	return true;
+}
+
+/// \brief Cleans an arbitrary memory range in the data cache.
+/// \details The range is extended to whole cache lines. Ranges larger than
+///          ::SCB_DCACHE_SET_WAY_THRESHOLD are handled by cleaning the whole cache.
+/// \param [in] addr Start of the memory range.
+/// \param [in] size Size of the memory range in bytes.
+/// \returns Whether the cache clean procedure was executed.
+static inline bool
+Scb_cleanDCacheByRange(const void *const addr, const uint32_t size)
+{
+	if ((size == 0u) || !Scb_isDCacheEnabled())
+		return false;
+	if (size > SCB_DCACHE_SET_WAY_THRESHOLD)
+		return Scb_cleanDCache();
+
+	// cppcheck-suppress misra-c2012-11.4
+	const uint32_t begin = (uint32_t)addr & ~SCB_CACHE_LINE_MASK;
+	// cppcheck-suppress misra-c2012-11.4
+	const uint32_t end = ((uint32_t)addr + size + SCB_CACHE_LINE_MASK)
+			& ~SCB_CACHE_LINE_MASK;
+	// cppcheck-suppress misra-c2012-11.6
+	return Scb_cleanDCacheByAddr((const void *)begin, end - begin);
+}
+
+/// \brief Cleans and invalidates an arbitrary memory range in the data cache.
+/// \details The range is extended to whole cache lines. Ranges larger than
+///          ::SCB_DCACHE_SET_WAY_THRESHOLD are handled by cleaning and invalidating
+///          the whole cache.
+/// \param [in] addr Start of the memory range.
+/// \param [in] size Size of the memory range in bytes.
+/// \returns Whether the cache clean-invalidation procedure was executed.
+static inline bool
+Scb_cleanInvalidateDCacheByRange(const void *const addr, const uint32_t size)
+{
+	if ((size == 0u) || !Scb_isDCacheEnabled())
+		return false;
+	if (size > SCB_DCACHE_SET_WAY_THRESHOLD)
+		return Scb_cleanInvalidateDCache();
+
+	// cppcheck-suppress misra-c2012-11.4
+	const uint32_t begin = (uint32_t)addr & ~SCB_CACHE_LINE_MASK;
+	// cppcheck-suppress misra-c2012-11.4
+	const uint32_t end = ((uint32_t)addr + size + SCB_CACHE_LINE_MASK)
+			& ~SCB_CACHE_LINE_MASK;
+	// cppcheck-suppress misra-c2012-11.6
+	return Scb_cleanInvalidateDCacheByAddr((const void *)begin, end - begin);
+}
+
+/// \brief Invalidates an arbitrary memory range in the data cache, e.g. after it was
+///        written by DMA.
+/// \details Lines only partially covered by the range are cleaned before being invalidated,
+///          to preserve neighbouring data. Ranges larger than ::SCB_DCACHE_SET_WAY_THRESHOLD
+///          are handled by cleaning and invalidating the whole cache, as invalidating it
+///          without a clean would discard unrelated dirty data.
+/// \param [in] addr Start of the memory range.
+/// \param [in] size Size of the memory range in bytes.
+/// \returns Whether the cache invalidation procedure was executed.
+static inline bool
+Scb_invalidateDCacheByRange(const void *const addr, const uint32_t size)
+{
+	if ((size == 0u) || !Scb_isDCacheEnabled())
+		return false;
+	if (size > SCB_DCACHE_SET_WAY_THRESHOLD)
+		return Scb_cleanInvalidateDCache();
+
+	// cppcheck-suppress misra-c2012-11.4
+	uint32_t begin = (uint32_t)addr;
+	const uint32_t end = begin + size;
+
+	if ((begin & SCB_CACHE_LINE_MASK) != 0u) {
+		begin &= ~SCB_CACHE_LINE_MASK;
+		// cppcheck-suppress misra-c2012-11.6
+		(void)Scb_cleanInvalidateDCacheByAddr(
+				(const void *)begin, SCB_CACHE_LINE_SIZE);
+		begin += SCB_CACHE_LINE_SIZE;
+		if (begin >= end)
+			return true;
+	}
+
+	const uint32_t alignedEnd = end & ~SCB_CACHE_LINE_MASK;
+	if (alignedEnd > begin)
+		// cppcheck-suppress misra-c2012-11.6
+		(void)Scb_invalidateDCacheByAddr(
+				(const void *)begin, alignedEnd - begin);
+	if (alignedEnd != end)
+		// cppcheck-suppress misra-c2012-11.6
+		(void)Scb_cleanInvalidateDCacheByAddr(
+				(const void *)alignedEnd, SCB_CACHE_LINE_SIZE);
+
+	return true;
+}
+
+/// \brief Enables the instruction and data tightly coupled memories, with read-modify-write
+///        and retry on ECC error.
+/// \details The memories must first be allocated from the SRAM, using the GPNVM bits.
+static inline void
+Scb_enableTcm(void)
+{
+	// cppcheck-suppress misra-c2012-11.4
+	volatile Scb_Registers *const scb =
+			(volatile Scb_Registers *)SCB_BASE_ADDRESS;
+
+	DATA_SYNC_BARRIER();
+	INSTRUCTION_SYNC_BARRIER();
+	scb->itcmcr = scb->itcmcr | SCB_ITCMCR_EN_MASK | SCB_ITCMCR_RMW_MASK
+			| SCB_ITCMCR_RETEN_MASK;
+	scb->dtcmcr = scb->dtcmcr | SCB_DTCMCR_EN_MASK | SCB_DTCMCR_RMW_MASK
+			| SCB_DTCMCR_RETEN_MASK;
+	DATA_SYNC_BARRIER();
+	INSTRUCTION_SYNC_BARRIER();
+}
+
 /// \brief Enables or disables the MemoryManagement exception.
 /// \param [in] enabled Enable/disable flag.
 static inline void
@@ -568,6 +770,10 @@ Scb_setMemoryManagementExceptionEnabled(const bool enabled)
 } // extern "C"
 #endif
 
+#if defined(BSP_HOST_REGISTERS)
+#pragma GCC diagnostic pop
+#endif
+
 /// @}
 
 #endif // BSP_SCB_H
@@ -101,7 +101,14 @@ typedef struct {
    uint32_t debr1;         ///< 0xE000EFBC Data Error bank Register 1
 } Scb_Registers;
 
+#if defined(BSP_HOST_REGISTERS)
+/// \brief In-memory SCB register model, see HostRegisters/HostRegisters.h.
+extern Scb_Registers HostRegisters_scb;
+
+#define SCB_BASE_ADDRESS                  ((uintptr_t)&HostRegisters_scb)
+#else
 #define SCB_BASE_ADDRESS                  0xE000E008u
+#endif
 #define SCB_DCCMVAU_ADDRESS               0xE000EF64u
 
 #define SCB_ACTLR_DISFOLD_MASK            0x00000004u
@@ -377,6 +384,24 @@ typedef struct {
 #define SCB_DCCISW_WAY_MASK               0xC0000000u
 #define SCB_DCCISW_WAY_OFFSET             30u
 
+#define SCB_ITCMCR_EN_MASK                0x00000001u
+#define SCB_ITCMCR_EN_OFFSET              0u
+#define SCB_ITCMCR_RMW_MASK               0x00000002u
+#define SCB_ITCMCR_RMW_OFFSET             1u
+#define SCB_ITCMCR_RETEN_MASK             0x00000004u
+#define SCB_ITCMCR_RETEN_OFFSET           2u
+#define SCB_ITCMCR_SZ_MASK                0x00000078u
+#define SCB_ITCMCR_SZ_OFFSET              3u
+
+#define SCB_DTCMCR_EN_MASK                0x00000001u
+#define SCB_DTCMCR_EN_OFFSET              0u
+#define SCB_DTCMCR_RMW_MASK               0x00000002u
+#define SCB_DTCMCR_RMW_OFFSET             1u
+#define SCB_DTCMCR_RETEN_MASK             0x00000004u
+#define SCB_DTCMCR_RETEN_OFFSET           2u
+#define SCB_DTCMCR_SZ_MASK                0x00000078u
+#define SCB_DTCMCR_SZ_OFFSET              3u
+
 #define SCB_CACHE_LINE_SIZE               32u
 
 // clang-format on
@@ -0,0 +1,191 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Scheduler.h"
+
+#include <assert.h>
+#include <string.h>
+
+#include <Dwt/Dwt.h>
+#include <Nvic/Nvic.h>
+#include <Scb/Scb.h>
+#include <Utils/Bits.h>
+
+#define SCHEDULER_PENDSV_PRIORITY 0xFFu
+
+typedef struct {
+	Scheduler_TaskConfig config;
+	MpscEventQueue queue;
+	Scheduler_TaskStats stats;
+} Task;
+
+static Task tasks[SCHEDULER_TASK_COUNT_MAX];
+static uint32_t taskCount;
+static uint32_t pendingEvents;
+static uint32_t pendingSignals;
+
+// cppcheck-suppress misra-c2012-11.4
+static volatile Scb_Registers *const scb =
+		(volatile Scb_Registers *)SCB_BASE_ADDRESS;
+
+static void
+requestDispatch(void)
+{
+	scb->icsr = SCB_ICSR_PENDSVSET_MASK;
+}
+
+void
+Scheduler_init(const Scheduler_TaskConfig *const taskConfigs,
+		const uint32_t count)
+{
+	assert(taskConfigs != NULL);
+	assert(count <= SCHEDULER_TASK_COUNT_MAX);
+
+	(void)memset(tasks, 0, sizeof(tasks));
+	for (uint32_t i = 0u; i < count; i++) {
+		assert(taskConfigs[i].function != NULL);
+		tasks[i].config = taskConfigs[i];
+		if (taskConfigs[i].slots != NULL)
+			MpscEventQueue_init(&tasks[i].queue,
+					taskConfigs[i].slots,
+					taskConfigs[i].slotCount);
+	}
+	taskCount = count;
+	__atomic_store_n(&pendingEvents, 0u, __ATOMIC_RELAXED);
+	__atomic_store_n(&pendingSignals, 0u, __ATOMIC_RELAXED);
+
+	Dwt_enableCycleCounter();
+
+	// Only the implemented upper bits of the priority byte are retained.
+	scb->shpr3 = (scb->shpr3 & ~SCB_SHPR3_PRI_14_MASK)
+			| BIT_FIELD_VALUE(SCB_SHPR3_PRI_14,
+					SCHEDULER_PENDSV_PRIORITY);
+	MEMORY_SYNC_BARRIER();
+}
+
+bool
+Scheduler_post(const uint32_t taskId, const uint16_t type,
+		const uint32_t argument)
+{
+	assert(taskId < taskCount);
+	assert(tasks[taskId].config.slots != NULL);
+
+	Task *const task = &tasks[taskId];
+	const MpscEventQueue_Event event = {
+		.source = (uint16_t)taskId,
+		.type = type,
+		.argument = argument,
+	};
+
+	if (!MpscEventQueue_push(&task->queue, &event)) {
+		(void)__atomic_fetch_add(
+				&task->stats.droppedCount, 1u, __ATOMIC_RELAXED);
+		return false;
+	}
+
+	// The ready bit is set after publishing, so the dispatcher clearing it
+	// before pulling never misses the work item.
+	atomicSetBits(&pendingEvents, shiftBitLeft(true, taskId));
+	requestDispatch();
+
+	return true;
+}
+
+void
+Scheduler_signal(const uint32_t taskId)
+{
+	assert(taskId < taskCount);
+
+	atomicSetBits(&pendingSignals, shiftBitLeft(true, taskId));
+	requestDispatch();
+}
+
+static void
+runTask(Task *const task, const MpscEventQueue_Event *const event)
+{
+	const uint32_t startCycles = Dwt_getCycleCount();
+	task->config.function(event, task->config.arg);
+	const uint32_t duration = Dwt_getCycleCount() - startCycles;
+
+	task->stats.runCount++;
+	task->stats.totalDurationCycles += duration;
+	if (duration > task->stats.maxDurationCycles)
+		task->stats.maxDurationCycles = duration;
+}
+
+void
+Scheduler_dispatch(void)
+{
+	for (;;) {
+		const uint32_t ready =
+				__atomic_load_n(&pendingEvents, __ATOMIC_ACQUIRE)
+				| __atomic_load_n(&pendingSignals,
+						__ATOMIC_ACQUIRE);
+		if (ready == 0u)
+			return;
+
+		const uint32_t taskId = countTrailingZeros(ready);
+		const uint32_t taskMask = shiftBitLeft(true, taskId);
+		Task *const task = &tasks[taskId];
+
+		if (atomicTakeBits(&pendingSignals, taskMask) != 0u) {
+			runTask(task, NULL);
+			continue;
+		}
+
+		atomicClearBits(&pendingEvents, taskMask);
+		MpscEventQueue_Event event;
+		if (MpscEventQueue_pull(&task->queue, &event)) {
+			// Further work items may be queued, the task is revisited
+			// after higher priority tasks had a chance to run.
+			atomicSetBits(&pendingEvents, taskMask);
+			runTask(task, &event);
+		}
+	}
+}
+
+void
+Scheduler_getTaskStats(const uint32_t taskId, Scheduler_TaskStats *const stats)
+{
+	assert(taskId < taskCount);
+	assert(stats != NULL);
+
+	const uint32_t primask = Nvic_saveAndDisableIrq();
+	*stats = tasks[taskId].stats;
+	Nvic_restoreIrq(primask);
+}
+
+void
+Scheduler_resetStats(void)
+{
+	const uint32_t primask = Nvic_saveAndDisableIrq();
+	for (uint32_t i = 0u; i < taskCount; i++)
+		(void)memset(&tasks[i].stats, 0, sizeof(Scheduler_TaskStats));
+	Nvic_restoreIrq(primask);
+}
+
+void
+PendSV_Handler(void)
+{
+	Scheduler_dispatch();
+}
@@ -0,0 +1,125 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file Scheduler.h
+/// \addtogroup Bsp
+/// \brief Header containing interface for the priority-based run-to-completion task
+///        scheduler, dispatched from the PendSV exception.
+/// \details Interrupt handlers post work items with ::Scheduler_post or ::Scheduler_signal and
+///          return; the tasks run later in the PendSV handler, which is given the lowest
+///          exception priority, so every interrupt preempts them. Tasks do not preempt each
+///          other: after each work item the ready task with the lowest identifier runs next.
+///          Work items of a task are stored in its own ::MpscEventQueue. The module defines
+///          `PendSV_Handler`, replacing the weak default of the startup code. Task run times
+///          are measured with the DWT cycle counter and include the time spent in the
+///          interrupts preempting the task.
+
+#ifndef BSP_SCHEDULER_H
+#define BSP_SCHEDULER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <Utils/MpscEventQueue.h>
+
+/// @addtogroup Scheduler
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Maximum number of tasks, limited by the width of the ready masks.
+#define SCHEDULER_TASK_COUNT_MAX 32u
+
+/// \brief Task function type.
+/// \param [in] event Work item posted with ::Scheduler_post, or NULL when the task runs because
+///                   of ::Scheduler_signal.
+/// \param [in] arg Task argument given in ::Scheduler_TaskConfig.
+typedef void (*Scheduler_TaskFunction)(
+		const MpscEventQueue_Event *const event, void *const arg);
+
+/// \brief Structure describing a task.
+typedef struct {
+	Scheduler_TaskFunction function; ///< Task function.
+	void *arg; ///< Argument passed to the task function.
+	MpscEventQueue_Slot *slots; ///< Work item queue storage, NULL for signal-only tasks.
+	size_t slotCount; ///< Number of slots, a power of two if slots are given.
+} Scheduler_TaskConfig;
+
+/// \brief Structure holding runtime accounting of a task.
+typedef struct {
+	uint32_t runCount; ///< Number of completed runs.
+	uint32_t droppedCount; ///< Number of work items rejected because of a full queue.
+	uint32_t maxDurationCycles; ///< Longest run duration.
+	uint64_t totalDurationCycles; ///< Sum of run durations.
+} Scheduler_TaskStats;
+
+/// \brief Initialises the scheduler with a set of tasks, starts the cycle counter and sets the
+///        PendSV exception to the lowest priority.
+/// \details Shall be called before any work item is posted. The task index in the array is its
+///          identifier and its priority, lower values take precedence.
+/// \param [in] tasks Array of task descriptors, copied by the scheduler.
+/// \param [in] taskCount Number of tasks, at most ::SCHEDULER_TASK_COUNT_MAX.
+void Scheduler_init(
+		const Scheduler_TaskConfig *const tasks, const uint32_t taskCount);
+
+/// \brief Posts a work item to a task and requests dispatching. Can be called from thread mode
+///        and from interrupt handlers of any priority.
+/// \param [in] taskId Identifier of the target task, which shall have a work item queue.
+/// \param [in] type Task specific work item type.
+/// \param [in] argument Task specific work item argument.
+/// \retval true Work item was queued.
+/// \retval false The task queue is full, the work item was dropped and counted.
+bool Scheduler_post(const uint32_t taskId, const uint16_t type,
+		const uint32_t argument);
+
+/// \brief Marks a task as ready without a work item and requests dispatching. Signals sent
+///        before the task runs are coalesced into a single run. Can be called from thread mode
+///        and from interrupt handlers of any priority.
+/// \param [in] taskId Identifier of the target task.
+void Scheduler_signal(const uint32_t taskId);
+
+/// \brief Runs ready tasks until none is left. Called by the PendSV handler.
+/// \details May be called directly, e.g. from the main loop to process work posted while
+///          interrupts were masked, provided that the PendSV handler cannot interrupt it.
+void Scheduler_dispatch(void);
+
+/// \brief Returns runtime accounting of a task.
+/// \param [in] taskId Identifier of the task.
+/// \param [out] stats Address to store the accounting.
+void Scheduler_getTaskStats(
+		const uint32_t taskId, Scheduler_TaskStats *const stats);
+
+/// \brief Clears runtime accounting of all tasks.
+void Scheduler_resetStats(void);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_SCHEDULER_H
@@ -27,16 +27,22 @@
 #include <stddef.h>
 #include <string.h>
 
-#define SDRAMC_MICROSECONDS_PER_SECODND 1000000u
-#define SDRAMC_CYCLES_PER_ITERATION 6u
+#include <Dwt/Dwt.h>
+#include <Pmc/PmcClockManager.h>
+#include <Scb/Scb.h>
+
 #define SDRAMC_PREINITIALIZATION_PAUSE_DELAY_US 200u
 #define SDRAMC_AUTOREFRESH_PREINITIALIZATION_STEPS 9u
 #define BYTE_ADDRESS_BIT_COUNT 1u
+#define SDRAMC_NANOSECONDS_PER_SECOND 1000000000u
+#define SDRAMC_NANOSECONDS_PER_MICROSECOND 1000u
+#define SDRAMC_DELAY_CYCLES_MAX 15u
 
 void
 Sdramc_init(Sdramc *const sdramc)
 {
 	memset(&(sdramc->configuration), 0, sizeof(Sdramc_Config));
+	memset(&(sdramc->lowPowerStats), 0, sizeof(Sdramc_LowPowerStats));
 	sdramc->registers = (Sdramc_Registers *)SDRAMC_REGISTERS_ADDRESS_BASE;
 	sdramc->matrixRegisters =
 			(Sdramc_MatrixRegisters *)SDRAMC_MATRIX_REGISTER_BASE;
@@ -51,6 +57,10 @@ Sdramc_init(Sdramc *const sdramc)
 void
 Sdramc_startup(Sdramc *const sdramc)
 {
+#if defined(N7S_TARGET_SAMV71Q21)
+	PmcClockManager_acquire(Pmc_PeripheralId_Sdramc);
+#endif
+
 	sdramc->matrixRegisters->ccfg_smcnfcs |=
 			SDRAMC_MATRIX_CCFG_SMCNFCS_SDRAMEN_MASK;
 }
@@ -60,6 +70,10 @@ Sdramc_shutdown(Sdramc *const sdramc)
 {
 	sdramc->matrixRegisters->ccfg_smcnfcs &=
 			~SDRAMC_MATRIX_CCFG_SMCNFCS_SDRAMEN_MASK;
+
+#if defined(N7S_TARGET_SAMV71Q21)
+	PmcClockManager_release(Pmc_PeripheralId_Sdramc);
+#endif
 }
 
 static inline void
@@ -269,10 +283,11 @@ Sdramc_getOcmsConfig(
 static inline void
 delay(uint32_t clockFrequency, uint32_t us)
 {
-	const uint32_t cycles =
-			(clockFrequency * us) / SDRAMC_MICROSECONDS_PER_SECODND;
-	const uint32_t iterations = cycles / SDRAMC_CYCLES_PER_ITERATION;
-	for (uint32_t i = 0; i < iterations; i++)
+	Dwt_enableCycleCounter();
+
+	Dwt_Deadline deadline;
+	Dwt_startDeadline(&deadline, us, clockFrequency);
+	while (!Dwt_hasDeadlineExpired(&deadline))
 		asm volatile("nop");
 }
 
@@ -395,3 +410,149 @@ Sdramc_hasRefreshErrorBeenDetected(const Sdramc *const sdramc)
 {
 	return (sdramc->registers->isr & SDRAMC_ISR_RES_MASK) != 0u;
 }
+
+static inline uint32_t
+nanosecondsToCycles(const uint32_t nanoseconds, const uint32_t frequency)
+{
+	const uint64_t product = (uint64_t)nanoseconds * frequency;
+	return (uint32_t)((product + SDRAMC_NANOSECONDS_PER_SECOND - 1u)
+			/ SDRAMC_NANOSECONDS_PER_SECOND);
+}
+
+static bool
+getDelayCycles(const uint32_t nanoseconds, const uint32_t frequency,
+		uint8_t *const cycles)
+{
+	const uint32_t value = nanosecondsToCycles(nanoseconds, frequency);
+	if (value > SDRAMC_DELAY_CYCLES_MAX)
+		return false;
+
+	*cycles = (uint8_t)value;
+	return true;
+}
+
+static bool
+getCasLatency(const Sdramc_DeviceTimings *const timings,
+		const uint32_t frequency, Sdramc_CasLatency *const casLatency)
+{
+	for (uint32_t i = 0u; i < SDRAMC_CAS_LATENCY_COUNT; i++) {
+		if (frequency <= timings->casLatencyMaxFrequency[i]) {
+			*casLatency = (Sdramc_CasLatency)(
+					(uint32_t)Sdramc_CasLatency_Latency1 + i);
+			return true;
+		}
+	}
+	return false;
+}
+
+bool
+Sdramc_applyDeviceTimings(Sdramc_Config *const config,
+		const Sdramc_DeviceTimings *const timings,
+		const uint32_t masterckFrequency)
+{
+	assert(timings->refreshCommandCount > 0u);
+
+	Sdramc_Config result = *config;
+
+	const uint64_t refreshIntervalCycles =
+			((uint64_t)timings->refreshPeriodUs
+					* SDRAMC_NANOSECONDS_PER_MICROSECOND
+					* masterckFrequency)
+			/ ((uint64_t)timings->refreshCommandCount
+					* SDRAMC_NANOSECONDS_PER_SECOND);
+	if ((refreshIntervalCycles == 0u)
+			|| (refreshIntervalCycles > SDRAMC_TR_COUNT_MASK))
+		return false;
+	result.refreshTimerCount = (uint32_t)refreshIntervalCycles;
+
+	if (!getCasLatency(timings, masterckFrequency, &result.casLatency))
+		return false;
+	if (!getDelayCycles(timings->writeRecoveryTimeNs, masterckFrequency,
+			    &result.writeRecoveryDelay))
+		return false;
+	if (!getDelayCycles(timings->rowCycleTimeNs, masterckFrequency,
+			    &result.rowCycleDelayAndRowRefreshCycle))
+		return false;
+	if (!getDelayCycles(timings->rowPrechargeTimeNs, masterckFrequency,
+			    &result.rowPrechargeDelay))
+		return false;
+	if (!getDelayCycles(timings->rowToColumnDelayNs, masterckFrequency,
+			    &result.rowToColumnDelay))
+		return false;
+	if (!getDelayCycles(timings->activeToPrechargeTimeNs,
+			    masterckFrequency, &result.activeToPrechargeDelay))
+		return false;
+	if (!getDelayCycles(timings->exitSelfRefreshTimeNs, masterckFrequency,
+			    &result.exitSelfRefreshToActiveDelay))
+		return false;
+	if (timings->loadModeRegisterCycles > SDRAMC_DELAY_CYCLES_MAX)
+		return false;
+	result.loadModeRegisterCommandToActiveOrRefreshCommand =
+			timings->loadModeRegisterCycles;
+
+	*config = result;
+	return true;
+}
+
+void
+Sdramc_enterLowPower(
+		Sdramc *const sdramc, const Sdramc_LowPowerConfiguration mode)
+{
+	assert((mode == Sdramc_LowPowerConfiguration_SelfRefresh)
+			|| (mode == Sdramc_LowPowerConfiguration_PowerDown));
+
+	Dwt_enableCycleCounter();
+	(void)Sdramc_hasRefreshErrorBeenDetected(sdramc);
+	// Keeps the wake-up probe line out of the cache, so that its read reaches the SDRAM.
+	// cppcheck-suppress misra-c2012-11.6
+	(void)Scb_cleanInvalidateDCacheByRange(
+			(const void *)SDRAMC_SDRAM_ADRESS_BASE,
+			SCB_CACHE_LINE_SIZE);
+
+	memoryBarrier();
+	sdramc->registers->lpr = (sdramc->registers->lpr
+						 & (~(SDRAMC_LPR_LPCB_MASK
+								 | SDRAMC_LPR_TIMEOUT_MASK)))
+			| (((uint32_t)mode << SDRAMC_LPR_LPCB_OFFSET)
+					& SDRAMC_LPR_LPCB_MASK)
+			| (((uint32_t)Sdramc_LowPowerEnableTimeout_LpLastXfer
+					   << SDRAMC_LPR_TIMEOUT_OFFSET)
+					& SDRAMC_LPR_TIMEOUT_MASK);
+	memoryBarrier();
+
+	sdramc->lowPowerStats.lowPowerEntryCount++;
+}
+
+bool
+Sdramc_exitLowPower(Sdramc *const sdramc)
+{
+	// cppcheck-suppress misra-c2012-11.4
+	volatile const uint16_t *const memory =
+			(volatile const uint16_t *)SDRAMC_SDRAM_ADRESS_BASE;
+
+	sdramc->registers->lpr = getLprValue(sdramc, &sdramc->configuration);
+	memoryBarrier();
+
+	const uint32_t start = Dwt_getCycleCount();
+	(void)*memory;
+	memoryBarrier();
+	const uint32_t latency = Dwt_getCycleCount() - start;
+
+	sdramc->lowPowerStats.lastWakeLatencyCycles = latency;
+	if (latency > sdramc->lowPowerStats.maxWakeLatencyCycles)
+		sdramc->lowPowerStats.maxWakeLatencyCycles = latency;
+
+	if (Sdramc_hasRefreshErrorBeenDetected(sdramc)) {
+		sdramc->lowPowerStats.refreshErrorCount++;
+		return false;
+	}
+
+	return true;
+}
+
+void
+Sdramc_getLowPowerStats(
+		const Sdramc *const sdramc, Sdramc_LowPowerStats *const stats)
+{
+	*stats = sdramc->lowPowerStats;
+}
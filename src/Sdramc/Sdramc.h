@@ -159,6 +159,36 @@ typedef struct {
 	bool isRefreshErrorStatusInterruptEnabled;
 } Sdramc_Config;
 
+/// \brief Number of CAS latency settings described by ::Sdramc_DeviceTimings.
+#define SDRAMC_CAS_LATENCY_COUNT 3u
+
+/// \brief Structure representing SDRAM device timing parameters, as given in its datasheet.
+typedef struct {
+	uint32_t refreshPeriodUs; ///< Refresh period of the whole array (tREF) in [us].
+	uint32_t refreshCommandCount; ///< Number of refresh commands per refresh period.
+	uint32_t writeRecoveryTimeNs; ///< Write recovery time (tWR) in [ns].
+	/// \brief Row cycle time, the larger of tRC and tRFC, in [ns].
+	uint32_t rowCycleTimeNs;
+	uint32_t rowPrechargeTimeNs; ///< Row precharge time (tRP) in [ns].
+	uint32_t rowToColumnDelayNs; ///< Row to column delay (tRCD) in [ns].
+	uint32_t activeToPrechargeTimeNs; ///< Active to precharge time (tRAS) in [ns].
+	uint32_t exitSelfRefreshTimeNs; ///< Exit self-refresh to active time (tXSR) in [ns].
+	/// \brief Load mode register to active or refresh command time (tMRD) in clock cycles.
+	uint8_t loadModeRegisterCycles;
+	/// \brief Maximum clock frequency in [Hz] for CAS latency 1, 2 and 3; 0 if unsupported.
+	uint32_t casLatencyMaxFrequency[SDRAMC_CAS_LATENCY_COUNT];
+} Sdramc_DeviceTimings;
+
+/// \brief Structure representing SDRAM low-power statistics.
+typedef struct {
+	/// \brief Core clock cycles spent on the first access after the last wake-up.
+	uint32_t lastWakeLatencyCycles;
+	/// \brief Largest wake-up latency observed so far, in core clock cycles.
+	uint32_t maxWakeLatencyCycles;
+	uint32_t lowPowerEntryCount; ///< Number of low-power periods entered.
+	uint32_t refreshErrorCount; ///< Number of low-power periods that ended with a Refresh Error.
+} Sdramc_LowPowerStats;
+
 /// \brief Structure representing SDRAMC.
 typedef struct {
 	Sdramc_Registers *registers; ///< Pointer to SDRAMC registers.
@@ -171,6 +201,7 @@ typedef struct {
 	Sdramc_CacheAndBranchPredictorRegisters
 			*cacheAndBranchPredictorRegisters;
 	Sdramc_Config configuration; ///< Copy of the user submitted configuration.
+	Sdramc_LowPowerStats lowPowerStats; ///< Low-power entry and wake-up statistics.
 } Sdramc;
 
 /// \brief Structure representing Off-chip Memory Scramble configuration.
@@ -221,12 +252,53 @@ void Sdramc_getOcmsConfig(
 void Sdramc_performInitializationSequence(
 		Sdramc *const sdramc, uint32_t clockFrequency);
 
+/// \brief Derives the minimal safe timing settings from the SDRAM device parameters.
+/// \details Delays are rounded up to whole clock cycles, the refresh timer count is rounded
+///          down, and the lowest CAS latency supported at the given frequency is selected.
+///          The remaining configuration fields are left intact.
+/// \param [in,out] config SDRAMC configuration to update.
+/// \param [in] timings SDRAM device timing parameters.
+/// \param [in] masterckFrequency SDRAM clock (MCK) frequency in [Hz], e.g. obtained with
+///             ::Pmc_getMasterckFrequency.
+/// \retval true Configuration was updated.
+/// \retval false Timings cannot be met at the given frequency, configuration is unchanged.
+bool Sdramc_applyDeviceTimings(Sdramc_Config *const config,
+		const Sdramc_DeviceTimings *const timings,
+		const uint32_t masterckFrequency);
+
 /// \brief Returns whether Refresh Error has been detected since the last time
 /// its status was read. \param [in] sdramc Pointer to a structure representing
 /// SDRAMC. \retval true Refresh Error has been detected since the last status
 /// read. \retval false Refresh Error has not been detected.
 bool Sdramc_hasRefreshErrorBeenDetected(const Sdramc *const sdramc);
 
+/// \brief Puts the SDRAM into a low-power mode, to be called right before the core sleeps.
+/// \details The low-power command is issued immediately after the last transfer, overriding
+///          the configured low-power settings until ::Sdramc_exitLowPower is called.
+///          Pending Refresh Error status is cleared, so that the status checked on wake-up
+///          covers the low-power period only. Any later SDRAM access, including a cache
+///          line eviction, makes the controller leave the low-power mode on its own.
+/// \param [in,out] sdramc Pointer to a structure representing SDRAMC.
+/// \param [in] mode Low-power mode, either self-refresh or power-down. Deep power-down
+///             is not allowed, as it does not retain the memory content.
+void Sdramc_enterLowPower(
+		Sdramc *const sdramc, const Sdramc_LowPowerConfiguration mode);
+
+/// \brief Restores the SDRAM after a low-power period, to be called right after the core
+///        wakes up.
+/// \details The configured low-power settings are restored and the wake-up latency of the
+///          first SDRAM access is measured with the DWT cycle counter.
+/// \param [in,out] sdramc Pointer to a structure representing SDRAMC.
+/// \retval true SDRAM content was retained.
+/// \retval false Refresh Error has been detected during the low-power period.
+bool Sdramc_exitLowPower(Sdramc *const sdramc);
+
+/// \brief Gets the SDRAM low-power statistics.
+/// \param [in] sdramc Pointer to a structure representing SDRAMC.
+/// \param [out] stats SDRAM low-power statistics.
+void Sdramc_getLowPowerStats(
+		const Sdramc *const sdramc, Sdramc_LowPowerStats *const stats);
+
 #endif // BSP_SDRAMC_H
 
 /** @} */
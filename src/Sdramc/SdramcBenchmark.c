@@ -0,0 +1,134 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SdramcBenchmark.h"
+
+#include <assert.h>
+
+#include <Dwt/Dwt.h>
+#include <Scb/Scb.h>
+
+#define SDRAMC_BENCHMARK_RANDOM_SEED 0x2545F491u
+
+static volatile uint32_t benchmarkSink;
+
+static inline uint32_t
+nextRandom(const uint32_t state)
+{
+	uint32_t value = state;
+	value ^= value << 13u;
+	value ^= value >> 17u;
+	value ^= value << 5u;
+	return value;
+}
+
+static inline uint32_t
+getIndexMask(const uint32_t wordCount)
+{
+	uint32_t mask = 1u;
+	while ((mask << 1u) <= wordCount)
+		mask <<= 1u;
+	return mask - 1u;
+}
+
+static uint32_t
+getBandwidth(const uint32_t bytes, const uint32_t cycles,
+		const uint32_t coreClockFrequency)
+{
+	if (cycles == 0u)
+		return 0u;
+	return (uint32_t)(((uint64_t)bytes * coreClockFrequency) / cycles);
+}
+
+static void
+measure(volatile uint32_t *const memory, const uint32_t wordCount,
+		const uint32_t coreClockFrequency,
+		SdramcBenchmark_Bandwidth *const bandwidth)
+{
+	const uint32_t bytes = wordCount * sizeof(uint32_t);
+	const uint32_t mask = getIndexMask(wordCount);
+	uint32_t sum = 0u;
+	uint32_t random = SDRAMC_BENCHMARK_RANDOM_SEED;
+
+	(void)Scb_cleanInvalidateDCache();
+	uint32_t start = Dwt_getCycleCount();
+	for (uint32_t i = 0u; i < wordCount; i++)
+		memory[i] = i;
+	(void)Scb_cleanDCache();
+	bandwidth->sequentialWrite = getBandwidth(
+			bytes, Dwt_getCycleCount() - start, coreClockFrequency);
+
+	(void)Scb_cleanInvalidateDCache();
+	start = Dwt_getCycleCount();
+	for (uint32_t i = 0u; i < wordCount; i++)
+		sum += memory[i];
+	bandwidth->sequentialRead = getBandwidth(
+			bytes, Dwt_getCycleCount() - start, coreClockFrequency);
+
+	(void)Scb_cleanInvalidateDCache();
+	start = Dwt_getCycleCount();
+	for (uint32_t i = 0u; i < wordCount; i++) {
+		random = nextRandom(random);
+		memory[random & mask] = random;
+	}
+	(void)Scb_cleanDCache();
+	bandwidth->randomWrite = getBandwidth(
+			bytes, Dwt_getCycleCount() - start, coreClockFrequency);
+
+	(void)Scb_cleanInvalidateDCache();
+	start = Dwt_getCycleCount();
+	for (uint32_t i = 0u; i < wordCount; i++) {
+		random = nextRandom(random);
+		sum += memory[random & mask];
+	}
+	bandwidth->randomRead = getBandwidth(
+			bytes, Dwt_getCycleCount() - start, coreClockFrequency);
+
+	benchmarkSink = sum;
+}
+
+void
+SdramcBenchmark_run(void *const memory, const uint32_t size,
+		const uint32_t coreClockFrequency,
+		SdramcBenchmark_Result *const result)
+{
+	// cppcheck-suppress misra-c2012-11.4
+	assert(((uint32_t)memory % sizeof(uint32_t)) == 0u);
+	assert(size >= sizeof(uint32_t));
+
+	// cppcheck-suppress misra-c2012-11.5
+	volatile uint32_t *const words = (volatile uint32_t *)memory;
+	const uint32_t wordCount = size / sizeof(uint32_t);
+	const bool wasDCacheEnabled = Scb_isDCacheEnabled();
+
+	Dwt_enableCycleCounter();
+
+	(void)Scb_disableDCache();
+	measure(words, wordCount, coreClockFrequency, &result->uncached);
+
+	(void)Scb_enableDCache();
+	measure(words, wordCount, coreClockFrequency, &result->cached);
+
+	if (!wasDCacheEnabled)
+		(void)Scb_disableDCache();
+}
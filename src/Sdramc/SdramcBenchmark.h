@@ -0,0 +1,69 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file SdramcBenchmark.h
+/// \addtogroup Bsp
+/// \brief Header for the on-target SDRAM throughput benchmark.
+
+/**
+ * @defgroup SdramcBenchmark SdramcBenchmark
+ * @ingroup Bsp
+ * @{
+ */
+
+#ifndef BSP_SDRAMCBENCHMARK_H
+#define BSP_SDRAMCBENCHMARK_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/// \brief Structure holding measured bandwidths in [B/s].
+typedef struct {
+	uint32_t sequentialRead; ///< Sequential word read bandwidth.
+	uint32_t sequentialWrite; ///< Sequential word write bandwidth.
+	uint32_t randomRead; ///< Random word read bandwidth.
+	uint32_t randomWrite; ///< Random word write bandwidth.
+} SdramcBenchmark_Bandwidth;
+
+/// \brief Structure holding benchmark results.
+typedef struct {
+	SdramcBenchmark_Bandwidth uncached; ///< Bandwidth with the data cache disabled.
+	SdramcBenchmark_Bandwidth cached; ///< Bandwidth with the data cache enabled.
+} SdramcBenchmark_Result;
+
+/// \brief Measures the SDRAM bandwidth, with the data cache disabled and enabled.
+/// \details Execution time is measured with the DWT cycle counter. Cached runs include the
+///          cache maintenance needed to reach the SDRAM, so the area should be much larger
+///          than the data cache. The data cache state is restored afterwards. The contents of
+///          the area are overwritten.
+/// \param [in] memory Word-aligned area of initialized SDRAM to use for the benchmark.
+/// \param [in] size Size of the area in bytes.
+/// \param [in] coreClockFrequency Processor clock frequency in [Hz].
+/// \param [out] result Measured bandwidths.
+void SdramcBenchmark_run(void *const memory, const uint32_t size,
+		const uint32_t coreClockFrequency,
+		SdramcBenchmark_Result *const result);
+
+#endif // BSP_SDRAMCBENCHMARK_H
+
+/** @} */
@@ -28,7 +28,13 @@
 
 #include "startup_samv71q21.h"
 
+#include <stdbool.h>
+
+#include <Eefc/Eefc.h>
+#include <Fpu/Fpu.h>
 #include <Nvic/Nvic.h>
+#include <Nvic/NvicVectorTable.h>
+#include <Scb/Scb.h>
 
 // Gathering coverage from startup procedure is not possible with GCOV
 // (some of its procedures starts later)
@@ -44,6 +50,16 @@ extern uint32_t _szero;
 extern uint32_t _ezero;
 extern uint32_t _sstack;
 extern uint32_t _estack;
+extern uint32_t _sitcm_text;
+extern uint32_t _eitcm_text;
+extern uint32_t _litcm_text;
+extern uint32_t _sdtcm_data;
+extern uint32_t _edtcm_data;
+extern uint32_t _ldtcm_data;
+extern uint32_t _tcm_size;
+
+/* Set when the GPNVM TCM configuration does not match the linker script */
+static bool isTcmConfigMismatched;
 
 /** \cond DOXYGEN_SHOULD_SKIP_THIS */
 int main(void);
@@ -132,8 +148,8 @@ void SDRAMC_Handler       ( void ) __attribute__ ((weak, alias("Dummy_Handler"))
 void RSWDT_Handler        ( void ) __attribute__ ((weak, alias("Dummy_Handler")));
 // clang-format on
 
-/* Exception Table */
-__attribute__((section(".vectors"))) const DeviceVectors exception_table = {
+/* Exception Table, marked as used so that link-time optimization keeps it */
+__attribute__((used, section(".vectors"))) const DeviceVectors exception_table = {
 	// clang-format off
 
   /* Configure Initial Stack Pointer, using linker-generated symbols */
@@ -223,6 +239,41 @@ __attribute__((section(".vectors"))) const DeviceVectors exception_table = {
 	// clang-format on
 };
 
+#if defined(N7S_STARTUP_RAM_VECTOR_TABLE)
+/* VTOR requires alignment to the table size rounded up to a power of two */
+#define RAM_VECTOR_TABLE_ALIGNMENT 512u
+
+_Static_assert(sizeof(Nvic_VectorTable) <= RAM_VECTOR_TABLE_ALIGNMENT,
+		"RAM vector table alignment is smaller than the table");
+
+/* RAM copy of the exception table, handlers are installed in it at runtime */
+static Nvic_VectorTable ramVectorTable
+		__attribute__((section(".ram_vectors"),
+				aligned(RAM_VECTOR_TABLE_ALIGNMENT)));
+
+/**
+ * \brief Copies the exception table into RAM, entries of interrupts missing
+ * from the exception table are set to Dummy_Handler.
+ */
+static void
+copyVectorTable(void)
+{
+	// cppcheck-suppress misra-c2012-11.3
+	const Nvic_InterruptHandler *const source =
+			(const Nvic_InterruptHandler *)&exception_table;
+	// cppcheck-suppress misra-c2012-11.3
+	Nvic_InterruptHandler *const destination =
+			(Nvic_InterruptHandler *)&ramVectorTable;
+	const uint32_t sourceCount =
+			sizeof(DeviceVectors) / sizeof(Nvic_InterruptHandler);
+	const uint32_t count =
+			sizeof(Nvic_VectorTable) / sizeof(Nvic_InterruptHandler);
+
+	for (uint32_t i = 0u; i < count; i++)
+		destination[i] = (i < sourceCount) ? source[i] : Dummy_Handler;
+}
+#endif
+
 extern void (*__preinit_array_start[])(void) __attribute__((weak));
 extern void (*__preinit_array_end[])(void) __attribute__((weak));
 extern void (*__init_array_start[])(void) __attribute__((weak));
@@ -245,6 +296,117 @@ execute_init_array(void)
 		__init_array_start[i]();
 }
 
+#if defined(N7S_TARGET_SAMV71Q21)
+static uint32_t
+getTcmConfig(const uint32_t tcmSize)
+{
+	switch (tcmSize) {
+	case 0x8000u: return 1u;
+	case 0x10000u: return 2u;
+	case 0x20000u: return 3u;
+	default: return 0u;
+	}
+}
+#endif
+
+/**
+ * \brief Enables ITCM and DTCM of the size selected by the linker script.
+ * The allocation is set by GPNVM bits, which are left unchanged unless
+ * N7S_STARTUP_PROGRAM_TCM_GPNVM is defined; the programmed bits take effect
+ * after the next reset, which is left to the application.
+ * \returns true if the GPNVM bits match the linker script TCM size.
+ */
+static bool
+configureTcm(void)
+{
+	const uint32_t tcmSize = (uint32_t)&_tcm_size;
+#if defined(N7S_TARGET_SAMV71Q21)
+	const uint32_t config = getTcmConfig(tcmSize);
+	const uint32_t gpnvm = Eefc_getGpnvmBits();
+
+	if (((gpnvm & EEFC_GPNVM_TCM_CONFIG_MASK)
+			    >> EEFC_GPNVM_TCM_CONFIG_OFFSET)
+			!= config) {
+#if defined(N7S_STARTUP_PROGRAM_TCM_GPNVM)
+		Eefc_setGpnvmBit(EEFC_GPNVM_TCM_CONFIG_OFFSET,
+				(config & 1u) != 0u);
+		Eefc_setGpnvmBit(EEFC_GPNVM_TCM_CONFIG_OFFSET + 1u,
+				(config & 2u) != 0u);
+#endif
+		return false;
+	}
+#else
+	// TCM allocation is not selected by GPNVM bits on this target, so it
+	// cannot be verified; TCM sections are used only when none is requested.
+	if (tcmSize != 0u)
+		return false;
+#endif
+
+	if (tcmSize != 0u)
+		Scb_enableTcm();
+	return true;
+}
+
+bool
+Startup_isTcmConfigMismatched(void)
+{
+	return isTcmConfigMismatched;
+}
+
+#if defined(N7S_STARTUP_ENABLE_FPU)
+/**
+ * \brief Enables the FPU with the stacking mode selected for the build,
+ * so that constructors and main() can use floating point instructions.
+ */
+static void
+enableFpu(void)
+{
+	Fpu fpu;
+	Fpu_init(&fpu);
+	Fpu_startup(&fpu);
+	Fpu_setStackingMode(&fpu, FPU_BUILD_STACKING_MODE);
+}
+#endif
+
+/* Number of words transferred by a single block iteration */
+#define SECTION_BLOCK_WORDS 8
+
+static void
+copySection(const uint32_t *pSrc, uint32_t *pDest, const uint32_t *const pEnd)
+{
+	while ((pEnd - pDest) >= SECTION_BLOCK_WORDS) {
+		asm volatile("ldmia %[src]!, {r0-r3}\n"
+			     "stmia %[dest]!, {r0-r3}\n"
+			     "ldmia %[src]!, {r0-r3}\n"
+			     "stmia %[dest]!, {r0-r3}\n"
+				: [src] "+r"(pSrc), [dest] "+r"(pDest)
+				:
+				: ASM_R0, ASM_R1, ASM_R2, ASM_R3, "memory");
+	}
+	for (; pDest < pEnd; pDest++, pSrc++) {
+		*pDest = *pSrc;
+	}
+}
+
+static void
+zeroSection(uint32_t *pDest, const uint32_t *const pEnd)
+{
+	while ((pEnd - pDest) >= SECTION_BLOCK_WORDS) {
+		asm volatile("mov r0, #0\n"
+			     "mov r1, #0\n"
+			     "mov r2, #0\n"
+			     "mov r3, #0\n"
+			     "stmia %[dest]!, {r0-r3}\n"
+			     "stmia %[dest]!, {r0-r3}\n"
+				: [dest] "+r"(pDest)
+				:
+				: ASM_R0, ASM_R1, ASM_R2, ASM_R3, "memory");
+	}
+	for (; pDest < pEnd; pDest++) {
+		*pDest = 0;
+	}
+}
+
 /**
  * \brief This is the code that gets called on processor reset.
  * To initialize the device, and call the main() routine.
@@ -252,24 +414,41 @@ execute_init_array(void)
 void
 Reset_Handler(void)
 {
+	/* Enable the tightly coupled memories */
+	const bool isTcmConfigValid = configureTcm();
+
+	/* Enable the caches before touching the data segments */
+	(void)Scb_enableICache();
+#if defined(N7S_STARTUP_ENABLE_DCACHE)
+	(void)Scb_enableDCache();
+#endif
+
 	/* Initialize the relocate segment */
-	uint32_t *pSrc = &_etext;
-	uint32_t *pDest = &_srelocate;
+	if (&_etext != &_srelocate)
+		copySection(&_etext, &_srelocate, &_erelocate);
 
-	if (pSrc != pDest) {
-		for (; pDest < &_erelocate; pDest++, pSrc++) {
-			*pDest = *pSrc;
-		}
+	/* Initialize the tightly coupled memories, if they are allocated */
+	if (isTcmConfigValid) {
+		copySection(&_litcm_text, &_sitcm_text, &_eitcm_text);
+		copySection(&_ldtcm_data, &_sdtcm_data, &_edtcm_data);
 	}
 
-	/* Clear the zero segment */
-	for (pDest = &_szero; pDest < &_ezero; pDest++) {
-		*pDest = 0;
-	}
+	/* Clear the zero segment, .noinit is placed after it and left intact */
+	zeroSection(&_szero, &_ezero);
+	isTcmConfigMismatched = !isTcmConfigValid;
 
 	/* Set the vector table base address */
-	pSrc = (uint32_t *)&_sfixed;
-	Nvic_relocateVectorTable(pSrc);
+#if defined(N7S_STARTUP_RAM_VECTOR_TABLE)
+	copyVectorTable();
+	Nvic_relocateVectorTable(&ramVectorTable);
+#else
+	Nvic_relocateVectorTable(&_sfixed);
+#endif
+
+#if defined(N7S_STARTUP_ENABLE_FPU)
+	/* Enable the FPU before the constructors run */
+	enableFpu();
+#endif
 
 	/* Initialize ctors */
 	execute_init_array();
@@ -26,10 +26,20 @@
 #ifndef BSP_STARTUP_H
 #define BSP_STARTUP_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include <Nvic/Nvic.h>
 
+/* Places a variable in the .noinit section, which is not cleared by Reset_Handler */
+#define STARTUP_NOINIT __attribute__((section(".noinit")))
+
+/*
+ * Returns true when the GPNVM TCM configuration found at boot did not match
+ * the TCM size of the linker script; the TCMs were then left disabled.
+ */
+bool Startup_isTcmConfigMismatched(void);
+
 typedef struct {
 	/* Stack pointer */
 	void *pvStack;
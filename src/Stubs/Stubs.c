@@ -32,6 +32,10 @@
 
 #if defined(USE_UART_IO)
 #include <Uart/Uart.h>
+#if defined(STUBS_BUFFERED_OUTPUT)
+#include <Nvic/Nvic.h>
+#include <Utils/SpscByteFifo.h>
+#endif
 #elif defined(USE_SDRAM_IO)
 #include <Sdramc/Sdramc.h>
 #endif
@@ -42,10 +46,15 @@
 
 #ifdef ENABLE_COVERAGE
 extern void __gcov_flush(void);
+extern void __gcov_reset(void);
 #endif
 
 #define WRITE_STRING_CONSTANT(s) _write(GCOV_DUMMY_FD + 1, (s), sizeof(s) - 1u)
 
+#if defined(STUBS_BUFFERED_OUTPUT) && !defined(USE_UART_IO)
+#error "Buffered output is supported only with USE_UART_IO"
+#endif
+
 extern int _eheap;
 extern int _sheap;
 
@@ -144,6 +153,13 @@ writeByte(const uint8_t data)
 
 static Uart Stubs_uart;
 
+#if defined(STUBS_BUFFERED_OUTPUT)
+static uint8_t outputBufferMemory[STUBS_OUTPUT_BUFFER_SIZE];
+static SpscByteFifo outputBuffer;
+static bool isOutputBuffered;
+static volatile uint32_t droppedByteCount;
+#endif
+
 static void
 configurePioPins(Pio *const pio, Pio_Control const peripheral,
 		uint32_t const pinMask)
@@ -160,6 +176,21 @@ configurePioPins(Pio *const pio, Pio_Control const peripheral,
 	Pio_setPortConfig(pio, &pioConf);
 }
 
+#if defined(STUBS_BUFFERED_OUTPUT)
+static Nvic_Irq
+getUartIrq(void)
+{
+	switch (LOW_LEVEL_IO_UART_ID) {
+	case Uart_Id_0: return Nvic_Irq_Uart0;
+	case Uart_Id_1: return Nvic_Irq_Uart1;
+	case Uart_Id_2: return Nvic_Irq_Uart2;
+	case Uart_Id_3: return Nvic_Irq_Uart3;
+	case Uart_Id_4: return Nvic_Irq_Uart4;
+	default: assert(false); return Nvic_Irq_Uart0;
+	}
+}
+#endif
+
 static inline void
 configureUart(void)
 {
@@ -220,6 +251,15 @@ Stubs_startup(void)
 	default: assert(false);
 	}
 	configureUart();
+
+#if defined(STUBS_BUFFERED_OUTPUT)
+	SpscByteFifo_init(&outputBuffer, outputBufferMemory,
+			sizeof(outputBufferMemory));
+	droppedByteCount = 0u;
+	isOutputBuffered = true;
+	Uart_writeAsyncSpsc(&Stubs_uart, &outputBuffer);
+	Nvic_enableInterrupt(getUartIrq());
+#endif
 }
 
 static inline void
@@ -228,6 +268,50 @@ writeByte(const uint8_t data)
 	Uart_write(&Stubs_uart, data, 10000000, NULL);
 }
 
+#if defined(STUBS_BUFFERED_OUTPUT)
+static void
+writeBytes(const uint8_t *const data, const uint32_t count)
+{
+	if (!isOutputBuffered) {
+		for (uint32_t i = 0; i < count; i++)
+			writeByte(data[i]);
+		return;
+	}
+
+	uint32_t pushed = (uint32_t)SpscByteFifo_pushBytes(
+			&outputBuffer, data, count);
+#if defined(STUBS_OUTPUT_WAIT_WHEN_FULL)
+	// With interrupts masked the queue is never drained, so waiting would
+	// never end.
+	while ((pushed < count) && !Nvic_isIrqDisabled()) {
+		Uart_writeAsyncSpsc(&Stubs_uart, &outputBuffer);
+		pushed += (uint32_t)SpscByteFifo_pushBytes(
+				&outputBuffer, &data[pushed], count - pushed);
+	}
+#endif
+	droppedByteCount += count - pushed;
+}
+
+static inline void
+startTransmission(void)
+{
+	if (isOutputBuffered)
+		Uart_writeAsyncSpsc(&Stubs_uart, &outputBuffer);
+}
+
+static void
+flushOutput(void)
+{
+	// Stop the interrupt driven transmission, so that the queue can be drained here.
+	Uart_writeAsyncSpsc(&Stubs_uart, NULL);
+	isOutputBuffered = false;
+
+	uint8_t data = 0u;
+	while (SpscByteFifo_pull(&outputBuffer, &data))
+		writeByte(data);
+}
+#endif
+
 static inline void
 waitForTransmitterReady(void)
 {
@@ -239,6 +323,10 @@ waitForTransmitterReady(void)
 void
 Stubs_shutdown(void)
 {
+#if defined(STUBS_BUFFERED_OUTPUT)
+	flushOutput();
+	Nvic_disableInterrupt(getUartIrq());
+#endif
 	Uart_shutdown(&Stubs_uart);
 
 	switch (LOW_LEVEL_IO_UART_ID) {
@@ -251,6 +339,36 @@ Stubs_shutdown(void)
 	}
 }
 
+#if defined(ENABLE_COVERAGE) && defined(STUBS_COVERAGE_BAUDRATE)
+#define HAS_COVERAGE_BAUDRATE
+
+static void
+setCoverageBaudRate(void)
+{
+	while (!Uart_isTxEmpty(&Stubs_uart))
+		;
+
+	Uart_Config conf;
+	Uart_getConfig(&Stubs_uart, &conf);
+	conf.baudRate = STUBS_COVERAGE_BAUDRATE;
+	Uart_setConfig(&Stubs_uart, &conf);
+}
+#endif
+
+#if defined(STUBS_BUFFERED_OUTPUT)
+void
+Stubs_handleInterrupt(void)
+{
+	Uart_handleInterrupt(&Stubs_uart);
+}
+
+uint32_t
+Stubs_getDroppedByteCount(void)
+{
+	return droppedByteCount;
+}
+#endif
+
 #elif defined(USE_SDRAM_IO)
 
 extern uint8_t sdramMemory_begin;
@@ -261,96 +379,49 @@ static volatile uint32_t stdoutArraySize;
 
 static Sdramc Stubs_sdramc;
 
-static inline void
-assignPin(Pio *const pio, const uint32_t pin, const Pio_Control control)
-{
-	Pio_Pin_Config config;
-	memset(&config, 0, sizeof(Pio_Pin_Config));
-	config.control = control;
-	config.pull = Pio_Pull_Up;
-	Pio_setPinsConfig(pio, pin, &config);
-}
+#define SDRAM_PIN_CONFIG(peripheral) \
+	{ \
+		.control = (peripheral), .pull = Pio_Pull_Up, \
+	}
 
-static inline void
-configurePortA(void)
-{
-	Pio portA;
-	Pio_init(Pio_Port_A, &portA);
-	Pmc_enablePeripheralClk(Pmc_PeripheralId_PioA);
-	assignPin(&portA, PIO_PIN_20, Pio_Control_PeripheralC); // Connected
-	assignPin(&portA, PIO_PIN_15, Pio_Control_PeripheralA); // Connected
-	assignPin(&portA, PIO_PIN_16, Pio_Control_PeripheralA); // Connected
-}
+static const Pio_Pins_Config_Entry sdramPins[] = {
+	{ .port = Pio_Port_A,
+			.pins = PIO_PIN_15 | PIO_PIN_16,
+			.config = SDRAM_PIN_CONFIG(Pio_Control_PeripheralA) },
+	{ .port = Pio_Port_A,
+			.pins = PIO_PIN_20,
+			.config = SDRAM_PIN_CONFIG(Pio_Control_PeripheralC) },
+	{ .port = Pio_Port_C,
+			.pins = PIO_PIN_0 | PIO_PIN_1 | PIO_PIN_2 | PIO_PIN_3
+					| PIO_PIN_4 | PIO_PIN_5 | PIO_PIN_6
+					| PIO_PIN_7 | PIO_PIN_15 | PIO_PIN_18
+					| PIO_PIN_20 | PIO_PIN_21 | PIO_PIN_22
+					| PIO_PIN_23 | PIO_PIN_24 | PIO_PIN_25
+					| PIO_PIN_26 | PIO_PIN_27 | PIO_PIN_28
+					| PIO_PIN_29,
+			.config = SDRAM_PIN_CONFIG(Pio_Control_PeripheralA) },
+	// PD13 is shared with PC13.
+	{ .port = Pio_Port_D,
+			.pins = PIO_PIN_13 | PIO_PIN_14 | PIO_PIN_15 | PIO_PIN_16
+					| PIO_PIN_17 | PIO_PIN_23 | PIO_PIN_29,
+			.config = SDRAM_PIN_CONFIG(Pio_Control_PeripheralC) },
+	{ .port = Pio_Port_E,
+			.pins = PIO_PIN_0 | PIO_PIN_1 | PIO_PIN_2 | PIO_PIN_3
+					| PIO_PIN_4 | PIO_PIN_5,
+			.config = SDRAM_PIN_CONFIG(Pio_Control_PeripheralA) },
+};
 
 static inline void
-configurePortC(void)
+configurePio(void)
 {
-	Pio portC;
-	Pio_init(Pio_Port_C, &portC);
+	Pmc_enablePeripheralClk(Pmc_PeripheralId_PioA);
 	Pmc_enablePeripheralClk(Pmc_PeripheralId_PioC);
-	assignPin(&portC, PIO_PIN_18, Pio_Control_PeripheralA); // Connected
-	assignPin(&portC, PIO_PIN_20, Pio_Control_PeripheralA); // Connected
-	assignPin(&portC, PIO_PIN_21, Pio_Control_PeripheralA); // Connected
-	assignPin(&portC, PIO_PIN_22, Pio_Control_PeripheralA); // Connected
-	assignPin(&portC, PIO_PIN_23, Pio_Control_PeripheralA); // Connected
-	assignPin(&portC, PIO_PIN_24, Pio_Control_PeripheralA); // Connected
-	assignPin(&portC, PIO_PIN_25, Pio_Control_PeripheralA); // Connected
-	assignPin(&portC, PIO_PIN_26, Pio_Control_PeripheralA); // Connected
-	assignPin(&portC, PIO_PIN_27, Pio_Control_PeripheralA); // Connected
-	assignPin(&portC, PIO_PIN_28, Pio_Control_PeripheralA); // Connected
-	assignPin(&portC, PIO_PIN_29, Pio_Control_PeripheralA); // Connected
-
-	assignPin(&portC, PIO_PIN_0, Pio_Control_PeripheralA); // Connected
-	assignPin(&portC, PIO_PIN_1, Pio_Control_PeripheralA); // Connected
-	assignPin(&portC, PIO_PIN_2, Pio_Control_PeripheralA); // Connected
-	assignPin(&portC, PIO_PIN_3, Pio_Control_PeripheralA); // Connected
-	assignPin(&portC, PIO_PIN_4, Pio_Control_PeripheralA); // Connected
-	assignPin(&portC, PIO_PIN_5, Pio_Control_PeripheralA); // Connected
-	assignPin(&portC, PIO_PIN_6, Pio_Control_PeripheralA); // Connected
-	assignPin(&portC, PIO_PIN_7, Pio_Control_PeripheralA); // Connected
-
-	assignPin(&portC, PIO_PIN_15, Pio_Control_PeripheralA); // Connected
-}
-
-static inline void
-configurePortD(void)
-{
-	Pio portD;
-	Pio_init(Pio_Port_D, &portD);
 	Pmc_enablePeripheralClk(Pmc_PeripheralId_PioD);
-	assignPin(&portD, PIO_PIN_17, Pio_Control_PeripheralC); // Connected
-
-	assignPin(&portD, PIO_PIN_15, Pio_Control_PeripheralC); // Connected
-	assignPin(&portD, PIO_PIN_16, Pio_Control_PeripheralC); // Connected
-
-	assignPin(&portD, PIO_PIN_13,
-			Pio_Control_PeripheralC); // Connected Shared PC13
-	assignPin(&portD, PIO_PIN_23, Pio_Control_PeripheralC); // Connected
-	assignPin(&portD, PIO_PIN_14, Pio_Control_PeripheralC); // Connected
-	assignPin(&portD, PIO_PIN_29, Pio_Control_PeripheralC); // Connected
-}
-
-static inline void
-configurePortE(void)
-{
-	Pio portE;
-	Pio_init(Pio_Port_E, &portE);
 	Pmc_enablePeripheralClk(Pmc_PeripheralId_PioE);
-	assignPin(&portE, PIO_PIN_0, Pio_Control_PeripheralA); // Connected
-	assignPin(&portE, PIO_PIN_1, Pio_Control_PeripheralA); // Connected
-	assignPin(&portE, PIO_PIN_2, Pio_Control_PeripheralA); // Connected
-	assignPin(&portE, PIO_PIN_3, Pio_Control_PeripheralA); // Connected
-	assignPin(&portE, PIO_PIN_4, Pio_Control_PeripheralA); // Connected
-	assignPin(&portE, PIO_PIN_5, Pio_Control_PeripheralA); // Connected
-}
 
-static inline void
-configurePio(void)
-{
-	configurePortA();
-	configurePortC();
-	configurePortD();
-	configurePortE();
+	(void)Pio_setPinsConfigTable(sdramPins,
+			(uint32_t)(sizeof(sdramPins) / sizeof(sdramPins[0])),
+			NULL);
 }
 
 static inline void
@@ -441,6 +512,27 @@ waitForTransmitterReady(void)
 #error "Usage of stdio would result in a crash, as low level IO interface was not selected with proper #define"
 #endif
 
+#if !defined(STUBS_BUFFERED_OUTPUT)
+static inline void
+writeBytes(const uint8_t *const data, const uint32_t count)
+{
+	for (uint32_t i = 0; i < count; i++)
+		writeByte(data[i]);
+}
+
+static inline void
+startTransmission(void)
+{
+	waitForTransmitterReady();
+}
+
+static inline void
+flushOutput(void)
+{
+	waitForTransmitterReady();
+}
+#endif
+
 int _fstat(const int file, struct stat *const st);
 int
 _fstat(const int file, struct stat *const st)
@@ -450,13 +542,23 @@ _fstat(const int file, struct stat *const st)
 	return -1;
 }
 
+static unsigned char *heap = (unsigned char *)&_sheap;
+static unsigned char *heapEnd = (unsigned char *)&_eheap;
+
+void
+Stubs_setHeapRegion(void *const begin, void *const end)
+{
+	assert(begin < end);
+
+	heap = (unsigned char *)begin;
+	heapEnd = (unsigned char *)end;
+}
+
 void *_sbrk(const intptr_t incr);
 void *
 _sbrk(const intptr_t incr)
 {
-	static unsigned char *heap = (unsigned char *)&_sheap;
-
-	if ((heap + incr) >= (unsigned char *)&_eheap)
+	if ((heap + incr) >= heapEnd)
 		return (void *)-1;
 
 	unsigned char *const prev_heap = heap;
@@ -480,35 +582,110 @@ _getpid(void)
 	return -1;
 }
 
-static inline uint8_t
-nibbleToHex(const uint8_t value)
+static const uint8_t hexDigits[16] = { '0', '1', '2', '3', '4', '5', '6', '7',
+	'8', '9', 'A', 'B', 'C', 'D', 'E', 'F' };
+
+static inline void
+encodeByteAsHex(const uint8_t data, uint8_t *const hex)
+{
+	hex[0] = hexDigits[(data >> 4u) & 0x0Fu];
+	hex[1] = hexDigits[data & 0x0Fu];
+}
+
+static void
+writeBytesAsHexString(const uint8_t *const data, const uint32_t count)
+{
+	// Data is encoded a word at a time, so that the output is written in larger blocks.
+	uint8_t hex[2u * sizeof(uint32_t)];
+	for (uint32_t i = 0; i < count; i += sizeof(uint32_t)) {
+		const uint32_t remaining = count - i;
+		const uint32_t length = (remaining < sizeof(uint32_t))
+				? remaining
+				: sizeof(uint32_t);
+		for (uint32_t j = 0; j < length; j++)
+			encodeByteAsHex(data[i + j], &hex[2u * j]);
+		writeBytes(hex, 2u * length);
+	}
+}
+
+static inline void
+writeIntAsHexString(const uint32_t data)
+{
+	uint8_t hex[2u * sizeof(uint32_t)];
+	encodeByteAsHex((uint8_t)((data >> 24u) & 0xFFu), &hex[0]);
+	encodeByteAsHex((uint8_t)((data >> 16u) & 0xFFu), &hex[2]);
+	encodeByteAsHex((uint8_t)((data >> 8u) & 0xFFu), &hex[4]);
+	encodeByteAsHex((uint8_t)(data & 0xFFu), &hex[6]);
+	writeBytes(hex, sizeof(hex));
+}
+
+#if defined(STUBS_COVERAGE_BASE64)
+static const uint8_t base64Digits[64] = { 'A', 'B', 'C', 'D', 'E', 'F', 'G',
+	'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P', 'Q', 'R', 'S', 'T', 'U',
+	'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f', 'g', 'h', 'i',
+	'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v', 'w',
+	'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+',
+	'/' };
+
+static uint8_t base64Pending[3];
+static uint32_t base64PendingCount;
+
+static void
+writeBase64Group(const uint8_t *const group, const uint32_t length)
+{
+	const uint32_t value = ((uint32_t)group[0] << 16u)
+			| ((uint32_t)group[1] << 8u) | (uint32_t)group[2];
+	uint8_t encoded[4];
+	encoded[0] = base64Digits[(value >> 18u) & 0x3Fu];
+	encoded[1] = base64Digits[(value >> 12u) & 0x3Fu];
+	encoded[2] = (length > 1u) ? base64Digits[(value >> 6u) & 0x3Fu] : '=';
+	encoded[3] = (length > 2u) ? base64Digits[value & 0x3Fu] : '=';
+	writeBytes(encoded, sizeof(encoded));
+}
+
+static void
+writeBytesAsBase64(const uint8_t *const data, const uint32_t count)
 {
-	switch (value) {
-	case 15: return 'F';
-	case 14: return 'E';
-	case 13: return 'D';
-	case 12: return 'C';
-	case 11: return 'B';
-	case 10: return 'A';
-	default: return (uint8_t)(value + '0');
+	// gcov writes a file in many small blocks, groups are carried over between them.
+	for (uint32_t i = 0; i < count; i++) {
+		base64Pending[base64PendingCount] = data[i];
+		base64PendingCount++;
+		if (base64PendingCount == sizeof(base64Pending)) {
+			writeBase64Group(base64Pending, base64PendingCount);
+			base64PendingCount = 0u;
+		}
 	}
 }
 
+static void
+finishCoverageData(void)
+{
+	if (base64PendingCount != 0u) {
+		(void)memset(&base64Pending[base64PendingCount], 0,
+				sizeof(base64Pending) - base64PendingCount);
+		writeBase64Group(base64Pending, base64PendingCount);
+		base64PendingCount = 0u;
+	}
+	startTransmission();
+}
+
+static inline void
+writeCoverageData(const uint8_t *const data, const uint32_t count)
+{
+	writeBytesAsBase64(data, count);
+}
+#else
 static inline void
-writeByteAsHexString(const uint8_t data)
+finishCoverageData(void)
 {
-	writeByte(nibbleToHex((data >> 4u) & 0x0Fu));
-	writeByte(nibbleToHex(data & 0x0Fu));
 }
 
 static inline void
-writeIntAsHexString(const uint32_t data)
+writeCoverageData(const uint8_t *const data, const uint32_t count)
 {
-	writeByteAsHexString((uint8_t)((data >> 24u) & 0xFFu));
-	writeByteAsHexString((uint8_t)((data >> 16u) & 0xFFu));
-	writeByteAsHexString((uint8_t)((data >> 8u) & 0xFFu));
-	writeByteAsHexString((uint8_t)(data & 0xFFu));
+	writeBytesAsHexString(data, count);
 }
+#endif
 
 int _write(const int fd, const void *const buffer, const unsigned int count);
 int
@@ -516,14 +693,12 @@ _write(const int fd, const void *const buffer, const unsigned int count)
 {
 	const uint8_t *data = (const uint8_t *)buffer;
 
-	for (uint32_t i = 0; i < count; i++) {
-		if (fd == GCOV_DUMMY_FD)
-			writeByteAsHexString(data[i]);
-		else
-			writeByte(data[i]);
-	}
+	if (fd == GCOV_DUMMY_FD)
+		writeCoverageData(data, count);
+	else
+		writeBytes(data, count);
 
-	waitForTransmitterReady();
+	startTransmission();
 
 	return (int)count;
 }
@@ -551,7 +726,8 @@ int _close(const int file);
 int
 _close(const int file)
 {
-	(void)file;
+	if (file == GCOV_DUMMY_FD)
+		finishCoverageData();
 	return 0;
 }
 
@@ -579,15 +755,24 @@ void _exit(const int status);
 void
 _exit(const int status)
 {
+	flushOutput();
+
 	WRITE_STRING_CONSTANT("\n>> EXIT STATUS: ");
 	writeIntAsHexString((uint32_t)status);
 	WRITE_STRING_CONSTANT("\n");
 
 #ifdef ENABLE_COVERAGE
+#if defined(HAS_COVERAGE_BAUDRATE)
+	WRITE_STRING_CONSTANT("\n>> COVERAGE BAUDRATE: ");
+	writeIntAsHexString((uint32_t)STUBS_COVERAGE_BAUDRATE);
+	WRITE_STRING_CONSTANT("\n");
+	setCoverageBaudRate();
+#endif
 	WRITE_STRING_CONSTANT("\n>> COVERAGE RESULT - BEGIN <<");
 	__gcov_flush();
 	WRITE_STRING_CONSTANT("\n>> COVERAGE RESULT - END <<\n");
 #endif
+	flushOutput();
 
 	asm volatile("BKPT #0");
 	for (;;)
@@ -597,5 +782,24 @@ _exit(const int status)
 void
 Stubs_writeByte(const uint8_t byte)
 {
+#if defined(STUBS_BUFFERED_OUTPUT)
+	writeBytes(&byte, 1u);
+	startTransmission();
+#else
 	writeByte(byte);
+#endif
+}
+
+void
+Stubs_flush(void)
+{
+	flushOutput();
 }
+
+#ifdef ENABLE_COVERAGE
+void
+Stubs_resetCoverage(void)
+{
+	__gcov_reset();
+}
+#endif
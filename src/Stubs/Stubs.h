@@ -34,14 +34,56 @@
 #define LOW_LEVEL_IO_BAUDRATE 115200
 #endif
 
+#ifndef STUBS_OUTPUT_BUFFER_SIZE
+/// \brief Size of the console output buffer used when STUBS_BUFFERED_OUTPUT is defined,
+///        must be a power of two.
+#define STUBS_OUTPUT_BUFFER_SIZE 1024u
+#endif
+
 /// \brief Performs a hardware setup procedure of Stubs module.
 void Stubs_startup(void);
 
 /// \brief Performs a hardware shutdown procedure of Stubs module.
 void Stubs_shutdown(void);
 
+/// \brief Sets the memory region used as the heap by _sbrk, e.g. SDRAM between the
+///        sdramFree_begin and sdramFree_end linker symbols once it is initialized.
+/// \details Should be called before the first heap allocation; the region given by the
+///          _sheap and _eheap linker symbols is used by default.
+/// \param begin Beginning of the heap region.
+/// \param end End of the heap region.
+void Stubs_setHeapRegion(void *const begin, void *const end);
+
 /// \brief Writes provided byte to substituted standard output.
 /// \param byte Byte to be written.
 void Stubs_writeByte(uint8_t byte);
 
+/// \brief Transmits all buffered output synchronously.
+/// \details With STUBS_BUFFERED_OUTPUT, the interrupt driven transmission is stopped and
+///          all further output is written synchronously. Called by _exit, and intended to be
+///          called from fault handlers, as it does not rely on interrupts.
+void Stubs_flush(void);
+
+#ifdef ENABLE_COVERAGE
+/// \brief Zeroes all coverage counters, so that the dump done by _exit contains only the
+///        counters accumulated since, e.g. to collect coverage of a single test run.
+/// \details The dump is hex encoded by default. With STUBS_COVERAGE_BASE64 it is base64
+///          encoded, requiring a third less data. With STUBS_COVERAGE_BAUDRATE and USE_UART_IO,
+///          the baud rate is announced and switched to the given value before the dump.
+void Stubs_resetCoverage(void);
+#endif
+
+#if defined(STUBS_BUFFERED_OUTPUT)
+/// \brief Handles the console Uart interrupt, shall be called from the Uart interrupt handler.
+/// \details With STUBS_BUFFERED_OUTPUT and USE_UART_IO, _write only queues the output, which is
+///          transmitted by this handler. When the queue is full, excess bytes are dropped,
+///          unless STUBS_OUTPUT_WAIT_WHEN_FULL is defined, in which case the caller waits,
+///          provided interrupts are not masked through PRIMASK.
+void Stubs_handleInterrupt(void);
+
+/// \brief Returns the number of output bytes dropped due to the buffer being full.
+/// \returns Number of dropped bytes.
+uint32_t Stubs_getDroppedByteCount(void);
+#endif
+
 #endif // STUBS_H
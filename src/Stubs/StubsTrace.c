@@ -0,0 +1,196 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "StubsTrace.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <Dwt/Dwt.h>
+#include <Dwt/ItmRegisters.h>
+
+#include "Stubs.h"
+
+#define EVENT_HEADER_WORD_COUNT 2u
+#define EVENT_SYNC_OFFSET 24u
+#define EVENT_ARGUMENT_COUNT_OFFSET 16u
+#define EVENT_ARGUMENT_COUNT_MASK 0xFFu
+
+#define TRACE_BUFFER_WORD_COUNT (STUBS_TRACE_BUFFER_SIZE / sizeof(uint32_t))
+#define TRACE_BUFFER_INDEX_MASK (TRACE_BUFFER_WORD_COUNT - 1u)
+
+_Static_assert((TRACE_BUFFER_WORD_COUNT & TRACE_BUFFER_INDEX_MASK) == 0u,
+		"STUBS_TRACE_BUFFER_SIZE shall be a power of two");
+_Static_assert(TRACE_BUFFER_WORD_COUNT
+				>= (EVENT_HEADER_WORD_COUNT
+						+ STUBS_TRACE_MAX_ARGUMENT_COUNT),
+		"STUBS_TRACE_BUFFER_SIZE shall hold the longest event");
+
+// Free words hold 0, an event becomes visible to the drain when its header
+// is written, after the rest of the event.
+static uint32_t traceBuffer[TRACE_BUFFER_WORD_COUNT];
+static uint32_t head; // Free-running reservation index, shared by the emitters.
+static uint32_t tail; // Free-running remove index, modified by the drain only.
+static uint32_t drainedBytes; // Bytes of the event at tail already written.
+static StubsTrace_Sink traceSink;
+static uint32_t droppedEventCount;
+
+static void
+enableItm(void)
+{
+	// cppcheck-suppress misra-c2012-11.4
+	volatile Itm_Registers *const itm =
+			(volatile Itm_Registers *)ITM_REGISTERS_ADDRESS_BASE;
+
+	itm->lar = ITM_LAR_KEY;
+	itm->tcr = itm->tcr | ITM_TCR_ITMENA_MASK
+			| (1u << ITM_TCR_TRACEBUSID_OFFSET);
+	itm->ter = itm->ter | (1u << STUBS_TRACE_ITM_PORT);
+}
+
+static void
+writeItm(const uint8_t data)
+{
+	// cppcheck-suppress misra-c2012-11.4
+	volatile Itm_Registers *const itm =
+			(volatile Itm_Registers *)ITM_REGISTERS_ADDRESS_BASE;
+
+	while ((itm->stim[STUBS_TRACE_ITM_PORT] & ITM_STIM_FIFOREADY_MASK) == 0u)
+		;
+	// cppcheck-suppress misra-c2012-11.3
+	*(volatile uint8_t *)&itm->stim[STUBS_TRACE_ITM_PORT] = data;
+}
+
+void
+StubsTrace_init(const StubsTrace_Sink sink)
+{
+	for (uint32_t i = 0u; i < TRACE_BUFFER_WORD_COUNT; i++)
+		__atomic_store_n(&traceBuffer[i], 0u, __ATOMIC_RELAXED);
+	drainedBytes = 0u;
+	traceSink = sink;
+	__atomic_store_n(&droppedEventCount, 0u, __ATOMIC_RELAXED);
+	__atomic_store_n(&tail, 0u, __ATOMIC_RELAXED);
+	__atomic_store_n(&head, 0u, __ATOMIC_RELEASE);
+
+	Dwt_enableCycleCounter();
+	if (sink == StubsTrace_Sink_Itm)
+		enableItm();
+}
+
+void
+StubsTrace_emit(const uint16_t id, const uint32_t argumentCount,
+		const uint32_t *const arguments)
+{
+	assert(argumentCount <= STUBS_TRACE_MAX_ARGUMENT_COUNT);
+	assert((argumentCount == 0u) || (arguments != NULL));
+
+	const uint32_t size = EVENT_HEADER_WORD_COUNT + argumentCount;
+	const uint32_t cycles = Dwt_getCycleCount();
+
+	// Space is reserved with a compare-and-swap, retried only when another
+	// emitter preempted the reservation.
+	uint32_t reserved = __atomic_load_n(&head, __ATOMIC_RELAXED);
+	do {
+		const uint32_t used = reserved
+				- __atomic_load_n(&tail, __ATOMIC_ACQUIRE);
+		if (used > (TRACE_BUFFER_WORD_COUNT - size)) {
+			(void)__atomic_fetch_add(
+					&droppedEventCount, 1u, __ATOMIC_RELAXED);
+			return;
+		}
+	} while (!__atomic_compare_exchange_n(&head, &reserved, reserved + size,
+			true, __ATOMIC_RELAXED, __ATOMIC_RELAXED));
+
+	traceBuffer[(reserved + 1u) & TRACE_BUFFER_INDEX_MASK] = cycles;
+	for (uint32_t i = 0u; i < argumentCount; i++)
+		traceBuffer[(reserved + EVENT_HEADER_WORD_COUNT + i)
+				& TRACE_BUFFER_INDEX_MASK] = arguments[i];
+
+	const uint32_t header =
+			((uint32_t)STUBS_TRACE_EVENT_SYNC << EVENT_SYNC_OFFSET)
+			| (argumentCount << EVENT_ARGUMENT_COUNT_OFFSET)
+			| (uint32_t)id;
+	__atomic_store_n(&traceBuffer[reserved & TRACE_BUFFER_INDEX_MASK],
+			header, __ATOMIC_RELEASE);
+}
+
+static void
+writeSink(const uint8_t data)
+{
+	if (traceSink == StubsTrace_Sink_Itm)
+		writeItm(data);
+	else
+		Stubs_writeByte(data);
+}
+
+uint32_t
+StubsTrace_drain(const uint32_t maxBytes)
+{
+	uint32_t written = 0u;
+
+	while (written < maxBytes) {
+		const uint32_t first = __atomic_load_n(&tail, __ATOMIC_RELAXED);
+		const uint32_t header = __atomic_load_n(
+				&traceBuffer[first & TRACE_BUFFER_INDEX_MASK],
+				__ATOMIC_ACQUIRE);
+		// An event reserved and not yet published by a preempted emitter
+		// stops the drain.
+		if ((header >> EVENT_SYNC_OFFSET) != STUBS_TRACE_EVENT_SYNC)
+			break;
+
+		const uint32_t size = EVENT_HEADER_WORD_COUNT
+				+ ((header >> EVENT_ARGUMENT_COUNT_OFFSET)
+						& EVENT_ARGUMENT_COUNT_MASK);
+		const uint32_t byteCount = size * (uint32_t)sizeof(uint32_t);
+		while ((written < maxBytes) && (drainedBytes < byteCount)) {
+			const uint32_t index =
+					first + (drainedBytes / sizeof(uint32_t));
+			const uint32_t word =
+					traceBuffer[index & TRACE_BUFFER_INDEX_MASK];
+			writeSink((uint8_t)(word
+					>> (8u * (drainedBytes % sizeof(uint32_t)))));
+			drainedBytes++;
+			written++;
+		}
+		if (drainedBytes < byteCount)
+			break;
+
+		// Released words are cleared, so that a stale argument is never
+		// taken for the header of a later event.
+		for (uint32_t i = 0u; i < size; i++)
+			__atomic_store_n(&traceBuffer[(first + i)
+							 & TRACE_BUFFER_INDEX_MASK],
+					0u, __ATOMIC_RELAXED);
+		drainedBytes = 0u;
+		__atomic_store_n(&tail, first + size, __ATOMIC_RELEASE);
+	}
+
+	return written;
+}
+
+uint32_t
+StubsTrace_getDroppedEventCount(void)
+{
+	return __atomic_load_n(&droppedEventCount, __ATOMIC_RELAXED);
+}
@@ -0,0 +1,125 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file StubsTrace.h
+/// \addtogroup Bsp
+/// \brief Binary trace channel with deferred, host side formatting.
+/// \details Each event is queued as a sequence of little endian words: a header
+///          (STUBS_TRACE_EVENT_SYNC in bits 24-31, argument count in bits 16-23, event ID in
+///          bits 0-15), the DWT cycle counter value at emission, followed by the raw arguments.
+///          Event IDs are assigned by the application, the host tool maps them back to
+///          format strings. Queued events are written out by ::StubsTrace_drain, either
+///          through ::Stubs_writeByte or to an ITM stimulus port (SWO).
+///          The queue is lock-free: emitters reserve space with a compare-and-swap, as in
+///          ::MpscEventQueue_push, and publish an event by writing its header last. An emitter
+///          preempted between reserving and publishing only delays the drain. Events are
+///          queued in order of reservation, so cycle counter values of events emitted from
+///          nested contexts may be out of order.
+
+#ifndef STUBS_TRACE_H
+#define STUBS_TRACE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifndef STUBS_TRACE_BUFFER_SIZE
+/// \brief Size of the trace event queue in bytes, must be a power of two, holding
+///        at least an event with STUBS_TRACE_MAX_ARGUMENT_COUNT arguments.
+#define STUBS_TRACE_BUFFER_SIZE 2048u
+#endif
+
+/// \brief Maximum number of arguments of a single event.
+#define STUBS_TRACE_MAX_ARGUMENT_COUNT 4u
+
+/// \brief Synchronization marker placed in each event header.
+#define STUBS_TRACE_EVENT_SYNC 0xA5u
+
+/// \brief ITM stimulus port used by the ITM sink.
+#define STUBS_TRACE_ITM_PORT 1u
+
+/// \brief Trace output sinks.
+typedef enum {
+	StubsTrace_Sink_Stubs = 0, ///< Output written with ::Stubs_writeByte.
+	StubsTrace_Sink_Itm = 1, ///< Output written to ITM stimulus port STUBS_TRACE_ITM_PORT.
+} StubsTrace_Sink;
+
+/// \brief Initializes the trace channel and starts the DWT cycle counter.
+/// \details For the ITM sink, the ITM and its stimulus port are enabled. The TPIU (SWO baud
+///          rate and protocol) is expected to be configured by the debug probe.
+/// \param [in] sink Output sink.
+void StubsTrace_init(const StubsTrace_Sink sink);
+
+/// \brief Queues a trace event. Can be called from any context, including interrupts,
+///        without masking them.
+/// \details The event is dropped as a whole if the queue does not have enough free space.
+/// \param [in] id Event ID.
+/// \param [in] argumentCount Number of arguments, up to STUBS_TRACE_MAX_ARGUMENT_COUNT.
+/// \param [in] arguments Raw argument values.
+void StubsTrace_emit(const uint16_t id, const uint32_t argumentCount,
+		const uint32_t *const arguments);
+
+/// \brief Writes queued events to the sink. Shall be called from a single context only,
+///        e.g. a background loop.
+/// \param [in] maxBytes Maximum number of bytes to write.
+/// \returns Number of bytes written.
+uint32_t StubsTrace_drain(const uint32_t maxBytes);
+
+/// \brief Returns the number of events dropped due to the queue being full.
+/// \returns Number of dropped events.
+uint32_t StubsTrace_getDroppedEventCount(void);
+
+/// \brief Emits a trace event without arguments.
+#define STUBS_TRACE0(id) StubsTrace_emit((id), 0u, NULL)
+
+/// \brief Emits a trace event with a single argument.
+#define STUBS_TRACE1(id, a) \
+	do { \
+		const uint32_t stubsTraceArgs[] = { (uint32_t)(a) }; \
+		StubsTrace_emit((id), 1u, stubsTraceArgs); \
+	} while (0)
+
+/// \brief Emits a trace event with two arguments.
+#define STUBS_TRACE2(id, a, b) \
+	do { \
+		const uint32_t stubsTraceArgs[] = { (uint32_t)(a), \
+			(uint32_t)(b) }; \
+		StubsTrace_emit((id), 2u, stubsTraceArgs); \
+	} while (0)
+
+/// \brief Emits a trace event with three arguments.
+#define STUBS_TRACE3(id, a, b, c) \
+	do { \
+		const uint32_t stubsTraceArgs[] = { (uint32_t)(a), \
+			(uint32_t)(b), (uint32_t)(c) }; \
+		StubsTrace_emit((id), 3u, stubsTraceArgs); \
+	} while (0)
+
+/// \brief Emits a trace event with four arguments.
+#define STUBS_TRACE4(id, a, b, c, d) \
+	do { \
+		const uint32_t stubsTraceArgs[] = { (uint32_t)(a), \
+			(uint32_t)(b), (uint32_t)(c), (uint32_t)(d) }; \
+		StubsTrace_emit((id), 4u, stubsTraceArgs); \
+	} while (0)
+
+#endif // STUBS_TRACE_H
@@ -0,0 +1,233 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SystickTimebase.h"
+
+#include <assert.h>
+#include <stddef.h>
+
+#include <Nvic/Nvic.h>
+#include <Utils/Bits.h>
+
+static uint64_t
+readTicks(SystickTimebase *const timebase)
+{
+	// COUNTFLAG is cleared by the read, so a wrap is accounted exactly once,
+	// either here or in the interrupt handler, whichever reads first.
+	uint32_t current = Systick_getCurrentValue(timebase->systick);
+	if (Systick_hasCountedToZero(timebase->systick)) {
+		timebase->periodStart += (uint64_t)timebase->periodReload + 1u;
+		current = Systick_getCurrentValue(timebase->systick);
+	}
+
+	return timebase->periodStart
+			+ (uint64_t)(timebase->periodReload - current);
+}
+
+static void
+restartCounter(SystickTimebase *const timebase, const uint32_t periodTicks,
+		const uint64_t now)
+{
+	// In the tickless mode the ticks elapsed since the period was computed
+	// are carried into the reload, keeping the interrupt at the expiry;
+	// periodic mode keeps the constant period. Only the register writes
+	// below remain unaccounted.
+	const uint64_t start = readTicks(timebase);
+	const uint64_t elapsed = start - now;
+	uint32_t span = periodTicks;
+	if (timebase->isTickless) {
+		span = SYSTICK_TIMEBASE_MIN_PERIOD_TICKS;
+		if (elapsed < (uint64_t)(periodTicks
+						- SYSTICK_TIMEBASE_MIN_PERIOD_TICKS))
+			span = periodTicks - (uint32_t)elapsed;
+	}
+
+	timebase->periodReload = span - 1u;
+	timebase->systick->registers->rvr = BIT_FIELD_VALUE(
+			SYSTICK_RVR_RELOAD, timebase->periodReload);
+	Systick_clearCurrentValue(timebase->systick);
+
+	// The cleared counter holds 0 for a single tick before reloading.
+	while (Systick_getCurrentValue(timebase->systick) == 0u)
+		asm volatile("nop" ::: "memory");
+
+	timebase->periodStart = start + 1u;
+}
+
+static void
+programNextInterrupt(SystickTimebase *const timebase)
+{
+	const uint64_t now = readTicks(timebase);
+	uint64_t span = timebase->periodTicks;
+
+	if (timebase->timers != NULL) {
+		const uint64_t expiry = timebase->timers->expiry;
+		const uint64_t remaining = (expiry > now) ? (expiry - now) : 0u;
+		if (remaining < span)
+			span = remaining;
+	}
+	if (span < SYSTICK_TIMEBASE_MIN_PERIOD_TICKS)
+		span = SYSTICK_TIMEBASE_MIN_PERIOD_TICKS;
+
+	restartCounter(timebase, (uint32_t)span, now);
+}
+
+static void
+insertTimer(SystickTimebase *const timebase, SystickTimebase_Timer *const timer)
+{
+	SystickTimebase_Timer **link = &timebase->timers;
+	while ((*link != NULL) && ((*link)->expiry <= timer->expiry))
+		link = &(*link)->next;
+
+	timer->next = *link;
+	timer->isActive = true;
+	*link = timer;
+}
+
+static void
+removeTimer(SystickTimebase *const timebase, SystickTimebase_Timer *const timer)
+{
+	SystickTimebase_Timer **link = &timebase->timers;
+	while ((*link != NULL) && (*link != timer))
+		link = &(*link)->next;
+
+	if (*link != NULL)
+		*link = timer->next;
+
+	timer->next = NULL;
+	timer->isActive = false;
+}
+
+void
+SystickTimebase_init(SystickTimebase *const timebase, Systick *const systick,
+		const SystickTimebase_Config *const config)
+{
+	assert(timebase != NULL);
+	assert(systick != NULL);
+	assert(config->periodTicks >= SYSTICK_TIMEBASE_MIN_PERIOD_TICKS);
+	assert(config->periodTicks <= SYSTICK_TIMEBASE_MAX_PERIOD_TICKS);
+
+	timebase->systick = systick;
+	timebase->periodTicks = config->periodTicks;
+	timebase->isTickless = config->isTickless;
+	timebase->timers = NULL;
+
+	const Systick_Config systickConfig = {
+		.clockSource = config->clockSource,
+		.isInterruptEnabled = true,
+		.isEnabled = true,
+		.reloadValue = config->periodTicks - 1u,
+	};
+
+	const uint32_t primask = Nvic_saveAndDisableIrq();
+	Systick_setConfig(systick, &systickConfig);
+	timebase->periodStart = 0u;
+	timebase->periodReload = systickConfig.reloadValue;
+	restartCounter(timebase, config->periodTicks, readTicks(timebase));
+	Nvic_restoreIrq(primask);
+}
+
+void
+SystickTimebase_handleInterrupt(SystickTimebase *const timebase)
+{
+	uint32_t primask = Nvic_saveAndDisableIrq();
+	uint64_t now = readTicks(timebase);
+
+	while ((timebase->timers != NULL) && (timebase->timers->expiry <= now)) {
+		SystickTimebase_Timer *const timer = timebase->timers;
+		removeTimer(timebase, timer);
+		if (timer->period != 0u) {
+			timer->expiry += timer->period;
+			insertTimer(timebase, timer);
+		}
+
+		Nvic_restoreIrq(primask);
+		timer->callback(timer->arg);
+		primask = Nvic_saveAndDisableIrq();
+		now = readTicks(timebase);
+	}
+
+	if (timebase->isTickless)
+		programNextInterrupt(timebase);
+
+	Nvic_restoreIrq(primask);
+}
+
+uint64_t
+SystickTimebase_getTicks(SystickTimebase *const timebase)
+{
+	const uint32_t primask = Nvic_saveAndDisableIrq();
+	const uint64_t ticks = readTicks(timebase);
+	Nvic_restoreIrq(primask);
+
+	return ticks;
+}
+
+void
+SystickTimebase_startTimer(SystickTimebase *const timebase,
+		SystickTimebase_Timer *const timer, const uint64_t delayTicks,
+		const uint64_t periodTicks,
+		const SystickTimebaseCallback callback, void *const arg)
+{
+	assert(timer != NULL);
+	assert(callback != NULL);
+
+	const uint32_t primask = Nvic_saveAndDisableIrq();
+	if (timer->isActive)
+		removeTimer(timebase, timer);
+
+	timer->expiry = readTicks(timebase) + delayTicks;
+	timer->period = periodTicks;
+	timer->callback = callback;
+	timer->arg = arg;
+	insertTimer(timebase, timer);
+
+	// A new nearest expiry may fall before the programmed interrupt.
+	if (timebase->isTickless && (timebase->timers == timer))
+		programNextInterrupt(timebase);
+
+	Nvic_restoreIrq(primask);
+}
+
+void
+SystickTimebase_stopTimer(SystickTimebase *const timebase,
+		SystickTimebase_Timer *const timer)
+{
+	const uint32_t primask = Nvic_saveAndDisableIrq();
+	if (timer->isActive)
+		removeTimer(timebase, timer);
+	Nvic_restoreIrq(primask);
+}
+
+bool
+SystickTimebase_getNextExpiry(
+		SystickTimebase *const timebase, uint64_t *const expiry)
+{
+	const uint32_t primask = Nvic_saveAndDisableIrq();
+	const bool isActive = timebase->timers != NULL;
+	if (isActive)
+		*expiry = timebase->timers->expiry;
+	Nvic_restoreIrq(primask);
+
+	return isActive;
+}
@@ -0,0 +1,149 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file SystickTimebase.h
+/// \addtogroup Bsp
+/// \brief SysTick based 64-bit timebase and software timer service.
+/// \details The service extends the 24-bit SysTick down-counter into a
+///          monotonic 64-bit tick count and dispatches software timers from
+///          the SysTick interrupt. In the periodic mode the counter wraps
+///          with a constant period. In the tickless mode the reload value is
+///          reprogrammed on every interrupt to the nearest timer expiry
+///          (limited by the configured maximum period), so the core is not
+///          woken up by ticks that have nothing to dispatch.
+
+#ifndef BSP_SYSTICKTIMEBASE_H
+#define BSP_SYSTICKTIMEBASE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "Systick.h"
+
+/// @addtogroup SystickTimebase
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Maximum number of ticks in a single counter period.
+#define SYSTICK_TIMEBASE_MAX_PERIOD_TICKS (SYSTICK_RVR_RELOAD_MASK + 1u)
+
+/// \brief Minimum number of ticks in a single counter period.
+/// \details Shorter periods would allow the counter to wrap during a tick
+///          count read, which the read sequence can not detect.
+#define SYSTICK_TIMEBASE_MIN_PERIOD_TICKS 64u
+
+/// \brief Software timer callback.
+/// \param [in] arg Argument passed to the callback.
+typedef void (*SystickTimebaseCallback)(void *arg);
+
+/// \brief Software timer descriptor.
+typedef struct SystickTimebase_Timer {
+	uint64_t expiry; ///< Tick count at which the timer expires.
+	uint64_t period; ///< Timer period in ticks, 0 for a one-shot timer.
+	SystickTimebaseCallback callback; ///< Expiry callback.
+	void *arg; ///< Expiry callback argument.
+	bool isActive; ///< Is the timer queued.
+	struct SystickTimebase_Timer *next; ///< Next queued timer.
+} SystickTimebase_Timer;
+
+/// \brief Timebase service configuration.
+typedef struct {
+	Systick_ClockSource clockSource; ///< SysTick clock source.
+	/// \brief Counter period in ticks in the periodic mode, maximum counter
+	///        period in ticks in the tickless mode.
+	uint32_t periodTicks;
+	bool isTickless; ///< Is the tickless mode used.
+} SystickTimebase_Config;
+
+/// \brief Timebase service descriptor.
+typedef struct {
+	Systick *systick; ///< SysTick providing the time base.
+	volatile uint64_t periodStart; ///< Tick count at the current period start.
+	volatile uint32_t periodReload; ///< Reload value of the current period.
+	uint32_t periodTicks; ///< Configured (maximum) period in ticks.
+	bool isTickless; ///< Is the tickless mode used.
+	SystickTimebase_Timer *timers; ///< Queued timers, sorted by expiry.
+} SystickTimebase;
+
+/// \brief Initializes the timebase service and starts SysTick.
+/// \details The SysTick interrupt is enabled;
+///          ::SystickTimebase_handleInterrupt shall be called from the SysTick
+///          interrupt handler.
+/// \param [out] timebase Timebase service descriptor.
+/// \param [in] systick Initialized SysTick descriptor.
+/// \param [in] config Timebase service configuration.
+void SystickTimebase_init(SystickTimebase *const timebase,
+		Systick *const systick, const SystickTimebase_Config *const config);
+
+/// \brief Handles the SysTick interrupt, dispatching expired timers.
+/// \details Callbacks are called with interrupts enabled and may start or
+///          stop timers. In the tickless mode the next interrupt is programmed
+///          at the nearest timer expiry; each reprogramming may lose the few
+///          ticks elapsed between the counter read and the reload.
+/// \param [in,out] timebase Timebase service descriptor.
+void SystickTimebase_handleInterrupt(SystickTimebase *const timebase);
+
+/// \brief Returns the current monotonic tick count.
+/// \details The read is race-free against the counter wrapping and may be
+///          called from any context, including interrupts masking SysTick.
+/// \param [in,out] timebase Timebase service descriptor.
+/// \returns Number of ticks elapsed since the service initialization.
+uint64_t SystickTimebase_getTicks(SystickTimebase *const timebase);
+
+/// \brief Starts a software timer, restarting it if already active.
+/// \param [in,out] timebase Timebase service descriptor.
+/// \param [in,out] timer Timer descriptor, shall remain valid while active.
+/// \param [in] delayTicks Number of ticks to the first expiry.
+/// \param [in] periodTicks Timer period in ticks, 0 for a one-shot timer.
+/// \param [in] callback Expiry callback.
+/// \param [in] arg Expiry callback argument.
+void SystickTimebase_startTimer(SystickTimebase *const timebase,
+		SystickTimebase_Timer *const timer, const uint64_t delayTicks,
+		const uint64_t periodTicks,
+		const SystickTimebaseCallback callback, void *const arg);
+
+/// \brief Stops a software timer.
+/// \param [in,out] timebase Timebase service descriptor.
+/// \param [in,out] timer Timer descriptor.
+void SystickTimebase_stopTimer(SystickTimebase *const timebase,
+		SystickTimebase_Timer *const timer);
+
+/// \brief Returns the nearest timer expiry.
+/// \param [in,out] timebase Timebase service descriptor.
+/// \param [out] expiry Tick count of the nearest timer expiry.
+/// \retval true A timer is active and the expiry was returned.
+/// \retval false No timer is active.
+bool SystickTimebase_getNextExpiry(
+		SystickTimebase *const timebase, uint64_t *const expiry);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_SYSTICKTIMEBASE_H
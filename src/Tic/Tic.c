@@ -509,3 +509,284 @@ Tic_getRcValue(const Tic *const tic, const Tic_Channel channel)
 	return (tic->regs->channelRegs[channel].rc & TIC_RC_RC_MASK)
 			>> TIC_RC_RC_OFFSET;
 }
+
+#define PWM_CLOCK_COUNT 3u
+
+static const Tic_ClockSelection pwmClockSelections[PWM_CLOCK_COUNT] = {
+	Tic_ClockSelection_MckBy8,
+	Tic_ClockSelection_MckBy32,
+	Tic_ClockSelection_MckBy128,
+};
+
+static const uint32_t pwmClockDividers[PWM_CLOCK_COUNT] = { 8u, 32u, 128u };
+
+// Number of consecutive equal counter reads after which the counter is
+// considered stopped; more than the core cycles of the slowest PWM clock tick.
+#define PWM_STOPPED_COUNTER_READS 512u
+
+static uint32_t
+pwmCompareValue(const uint32_t rc, const uint32_t dutyPermille)
+{
+	const uint64_t periodTicks = (uint64_t)rc + 1u;
+	return (uint32_t)(((periodTicks * dutyPermille)
+					  + (TIC_PWM_DUTY_PERMILLE_MAX / 2u))
+			/ TIC_PWM_DUTY_PERMILLE_MAX);
+}
+
+static Tic_TioEffect
+pwmPeriodStartEffect(const uint32_t dutyPermille)
+{
+	// With a zero compare value the output would still be set for the single
+	// tick the counter holds the RC value.
+	return (dutyPermille == 0u) ? Tic_TioEffect_Clear : Tic_TioEffect_Set;
+}
+
+static void
+writePwmCompare(volatile uint32_t *const compare,
+		const volatile uint32_t *const counter, const uint32_t value)
+{
+	const uint32_t previous = *compare;
+	if (value < previous) {
+		// A compare value moved below the counter before the previous one
+		// is reached would be skipped in the current period. The wait ends
+		// when the counter does not advance, as it does not run while its
+		// clock is disabled or its start is deferred.
+		uint32_t count = *counter;
+		uint32_t unchangedReads = 0u;
+		while (((value <= TIC_PWM_UPDATE_MARGIN_TICKS)
+				       || (count >= (value
+							      - TIC_PWM_UPDATE_MARGIN_TICKS)))
+				&& (count < previous)
+				&& (unchangedReads < PWM_STOPPED_COUNTER_READS)) {
+			const uint32_t next = *counter;
+			unchangedReads = (next == count) ? (unchangedReads + 1u)
+							 : 0u;
+			count = next;
+		}
+	}
+	*compare = value;
+}
+
+bool
+Tic_startPwm(Tic *const tic, const Tic_Channel channel,
+		const Tic_PwmConfig *const config)
+{
+	assert((channel < Tic_Channel_Count) && "Invalid TIC channel");
+	assert(config->frequency != 0u);
+	assert(config->tioaDutyPermille <= TIC_PWM_DUTY_PERMILLE_MAX);
+	assert(config->tiobDutyPermille <= TIC_PWM_DUTY_PERMILLE_MAX);
+
+	for (uint32_t i = 0u; i < PWM_CLOCK_COUNT; i++) {
+		const uint32_t clock = config->peripheralClockFrequency
+				/ pwmClockDividers[i];
+		const uint64_t periodTicks =
+				((uint64_t)clock + (config->frequency / 2u))
+				/ config->frequency;
+		if (periodTicks > TIC_COUNTER_MAX_VALUE)
+			continue;
+		if (periodTicks < 2u)
+			return false;
+
+		Tic_ChannelConfig channelConfig;
+		(void)memset(&channelConfig, 0, sizeof(Tic_ChannelConfig));
+		channelConfig.isEnabled = true;
+		channelConfig.clockSource = pwmClockSelections[i];
+		channelConfig.channelMode = Tic_Mode_Waveform;
+		channelConfig.rc = (uint32_t)periodTicks - 1u;
+
+		Tic_WaveformModeConfig *const waveConfig =
+				&channelConfig.modeConfig.waveformModeConfig;
+		waveConfig->waveformMode = Tic_WaveformMode_Up_Rc;
+		// TIOB is an output only when it is not the external event source.
+		waveConfig->externalEventSource = Tic_ExternalEventSelection_Xc0;
+		waveConfig->raCompareEffectOnTioa = Tic_TioEffect_Clear;
+		waveConfig->rcCompareEffectOnTioa =
+				pwmPeriodStartEffect(config->tioaDutyPermille);
+		waveConfig->triggerEffectOnTioa = waveConfig->rcCompareEffectOnTioa;
+		waveConfig->rbCompareEffectOnTiob = Tic_TioEffect_Clear;
+		waveConfig->rcCompareEffectOnTiob =
+				pwmPeriodStartEffect(config->tiobDutyPermille);
+		waveConfig->triggerEffectOnTiob = waveConfig->rcCompareEffectOnTiob;
+		waveConfig->ra = pwmCompareValue(
+				channelConfig.rc, config->tioaDutyPermille);
+		waveConfig->rb = pwmCompareValue(
+				channelConfig.rc, config->tiobDutyPermille);
+
+		Tic_setChannelConfig(tic, channel, &channelConfig);
+		if (!config->isStartDeferred)
+			Tic_triggerChannel(tic, channel);
+
+		return true;
+	}
+
+	return false;
+}
+
+void
+Tic_setPwmDuty(Tic *const tic, const Tic_Channel channel,
+		const Tic_PwmOutput output, const uint32_t dutyPermille)
+{
+	assert((channel < Tic_Channel_Count) && "Invalid TIC channel");
+	assert(dutyPermille <= TIC_PWM_DUTY_PERMILLE_MAX);
+
+	volatile Tic_ChannelRegisters *const regs =
+			&tic->regs->channelRegs[channel];
+	const uint32_t value = pwmCompareValue(regs->rc, dutyPermille);
+	const uint32_t effect = (uint32_t)pwmPeriodStartEffect(dutyPermille);
+	uint32_t cmr = regs->cmr;
+
+	if (output == Tic_PwmOutput_Tioa) {
+		cmr &= ~(TIC_CMR_WVF_ACPC_MASK | TIC_CMR_WVF_ASWTRG_MASK);
+		cmr |= BIT_FIELD_VALUE(TIC_CMR_WVF_ACPC, effect)
+				| BIT_FIELD_VALUE(TIC_CMR_WVF_ASWTRG, effect);
+		writePwmCompare(&regs->ra, &regs->cv, value);
+	} else {
+		cmr &= ~(TIC_CMR_WVF_BCPC_MASK | TIC_CMR_WVF_BSWTRG_MASK);
+		cmr |= BIT_FIELD_VALUE(TIC_CMR_WVF_BCPC, effect)
+				| BIT_FIELD_VALUE(TIC_CMR_WVF_BSWTRG, effect);
+		writePwmCompare(&regs->rb, &regs->cv, value);
+	}
+
+	if (cmr != regs->cmr)
+		regs->cmr = cmr;
+}
+
+static void
+setQdecCountingChannel(Tic *const tic, const Tic_Channel channel,
+		const bool isResetOnIndex, const bool isLoadedByTimeBase)
+{
+	Tic_ChannelConfig channelConfig;
+	(void)memset(&channelConfig, 0, sizeof(Tic_ChannelConfig));
+	channelConfig.isEnabled = true;
+	// The decoder output is internally connected to XC0.
+	channelConfig.clockSource = Tic_ClockSelection_Xc0;
+	channelConfig.channelMode = Tic_Mode_Capture;
+
+	Tic_CaptureModeConfig *const captureConfig =
+			&channelConfig.modeConfig.captureModeConfig;
+	if (isResetOnIndex) {
+		captureConfig->externalTriggerEdge = Tic_EdgeSelection_Rising;
+		captureConfig->triggerSource = Tic_SignalTriggerSelection_Tioa;
+	}
+	if (isLoadedByTimeBase)
+		captureConfig->raLoadingEdgeSelection = Tic_EdgeSelection_Rising;
+
+	Tic_setChannelConfig(tic, channel, &channelConfig);
+}
+
+static void
+setQdecTimeBaseChannel(Tic *const tic, const Tic_QdecConfig *const config)
+{
+	assert(config->speedTimeBaseTicks >= 2u);
+	assert(config->speedTimeBaseTicks <= TIC_COUNTER_MAX_VALUE);
+
+	Tic_ChannelConfig channelConfig;
+	(void)memset(&channelConfig, 0, sizeof(Tic_ChannelConfig));
+	channelConfig.isEnabled = true;
+	channelConfig.clockSource = config->speedTimeBaseClock;
+	channelConfig.channelMode = Tic_Mode_Waveform;
+	channelConfig.rc = config->speedTimeBaseTicks - 1u;
+
+	// TIOA2 rises once per time base period, loading RA0 with the edge count.
+	Tic_WaveformModeConfig *const waveConfig =
+			&channelConfig.modeConfig.waveformModeConfig;
+	waveConfig->waveformMode = Tic_WaveformMode_Up_Rc;
+	waveConfig->raCompareEffectOnTioa = Tic_TioEffect_Set;
+	waveConfig->rcCompareEffectOnTioa = Tic_TioEffect_Clear;
+	waveConfig->ra = config->speedTimeBaseTicks / 2u;
+
+	Tic_setChannelConfig(tic, Tic_Channel_2, &channelConfig);
+}
+
+void
+Tic_setQdecConfig(Tic *const tic, const Tic_QdecConfig *const config)
+{
+	const bool isSpeedMode = config->mode == Tic_QdecMode_Speed;
+
+	Tic_disableQdec(tic);
+
+	setQdecCountingChannel(tic, Tic_Channel_0, true, isSpeedMode);
+	if (isSpeedMode)
+		setQdecTimeBaseChannel(tic, config);
+	else
+		setQdecCountingChannel(tic, Tic_Channel_1, false, false);
+
+	uint32_t bmr = tic->regs->bmr;
+	bmr &= TIC_BMR_TC0XC0S_MASK | TIC_BMR_TC1XC1S_MASK
+			| TIC_BMR_TC2XC2S_MASK;
+	bmr |= BIT_VALUE(TIC_BMR_QDEN, true)
+			| BIT_VALUE(TIC_BMR_POSEN, !isSpeedMode)
+			| BIT_VALUE(TIC_BMR_SPEEDEN, isSpeedMode)
+			| BIT_VALUE(TIC_BMR_QDTRANS,
+					config->isDirectionDetectionDisabled)
+			| BIT_VALUE(TIC_BMR_EDGPHA, config->isPhaseAEdgeOnly)
+			| BIT_VALUE(TIC_BMR_INVA, config->isPhaseAInverted)
+			| BIT_VALUE(TIC_BMR_INVB, config->isPhaseBInverted)
+			| BIT_VALUE(TIC_BMR_INVIDX, config->isIndexInverted)
+			| BIT_VALUE(TIC_BMR_SWAP, config->arePhasesSwapped)
+			| BIT_VALUE(TIC_BMR_IDXPHB, config->isIndexOnPhaseB)
+			| BIT_VALUE(TIC_BMR_AUTOC,
+					config->isAutoCorrectionEnabled)
+			| BIT_FIELD_VALUE(TIC_BMR_MAXFILT, config->filter)
+			| BIT_FIELD_VALUE(
+					TIC_BMR_MAXCMP, config->maxMissingPulses);
+	tic->regs->bmr = bmr;
+
+	tic->regs->qier = BIT_VALUE(TIC_QIER_IDX, config->isIndexIrqEnabled)
+			| BIT_VALUE(TIC_QIER_DIRCHG,
+					config->isDirectionChangeIrqEnabled)
+			| BIT_VALUE(TIC_QIER_QERR, config->isErrorIrqEnabled)
+			| BIT_VALUE(TIC_QIER_MPE, config->isErrorIrqEnabled);
+
+	// Clear the events left by a previous configuration.
+	(void)tic->regs->qisr;
+
+	Tic_syncAllChannels(tic);
+}
+
+void
+Tic_disableQdec(Tic *const tic)
+{
+	const uint32_t bmr = tic->regs->bmr;
+
+	tic->regs->qidr = TIC_QIDR_IDX_MASK | TIC_QIDR_DIRCHG_MASK
+			| TIC_QIDR_QERR_MASK | TIC_QIDR_MPE_MASK;
+	tic->regs->bmr = bmr
+			& ~(TIC_BMR_QDEN_MASK | TIC_BMR_POSEN_MASK
+					| TIC_BMR_SPEEDEN_MASK);
+
+	if ((bmr & TIC_BMR_QDEN_MASK) != 0u) {
+		Tic_disableChannel(tic, Tic_Channel_0);
+		if ((bmr & TIC_BMR_SPEEDEN_MASK) != 0u)
+			Tic_disableChannel(tic, Tic_Channel_2);
+		else
+			Tic_disableChannel(tic, Tic_Channel_1);
+	}
+}
+
+void
+Tic_getQdecState(const Tic *const tic, Tic_QdecState *const state)
+{
+	uint32_t revolutions;
+	uint32_t position;
+
+	// An index between the reads resets the position, so retry until the
+	// revolution counter is stable.
+	do {
+		revolutions = tic->regs->channelRegs[Tic_Channel_1].cv;
+		position = tic->regs->channelRegs[Tic_Channel_0].cv;
+	} while (revolutions != tic->regs->channelRegs[Tic_Channel_1].cv);
+
+	const uint32_t qisr = tic->regs->qisr;
+
+	state->position = position;
+	state->revolutions = revolutions;
+	state->speed = Tic_getRaValue(tic, Tic_Channel_0);
+	state->direction = ((qisr & TIC_QISR_DIR_MASK) != 0u)
+			? Tic_QdecDirection_Reverse
+			: Tic_QdecDirection_Forward;
+	state->hasIndexOccurred = (qisr & TIC_QISR_IDX_MASK) != 0u;
+	state->hasDirectionChanged = (qisr & TIC_QISR_DIRCHG_MASK) != 0u;
+	state->hasErrorOccurred = (qisr & TIC_QISR_QERR_MASK) != 0u;
+	state->hasMissingPulseErrorOccurred = (qisr & TIC_QISR_MPE_MASK) != 0u;
+}
@@ -41,6 +41,20 @@
 extern "C" {
 #endif
 
+#if defined(N7S_TARGET_SAMV71Q21)
+/// \brief Maximum value of a channel counter.
+#define TIC_COUNTER_MAX_VALUE 0x0000FFFFu
+#elif defined(N7S_TARGET_SAMRH71F20) || defined(N7S_TARGET_SAMRH707F18)
+/// \brief Maximum value of a channel counter.
+#define TIC_COUNTER_MAX_VALUE 0xFFFFFFFFu
+#endif
+
+/// \brief Number of permille in a full PWM duty cycle.
+#define TIC_PWM_DUTY_PERMILLE_MAX 1000u
+
+/// \brief Number of ticks the counter may advance during a PWM duty update.
+#define TIC_PWM_UPDATE_MARGIN_TICKS 2u
+
 /// \brief Enumeration listing Tic instances.
 typedef enum {
 	Tic_Id_0 = 0, ///< TIC instance 0.
@@ -285,6 +299,66 @@ typedef struct {
 	bool isTiobAsserted; ///< Is TIOB asserted.
 } Tic_ChannelStatus;
 
+/// \brief Enumeration listing PWM outputs of a channel.
+typedef enum {
+	Tic_PwmOutput_Tioa = 0, ///< TIOA output, duty cycle held in RA.
+	Tic_PwmOutput_Tiob = 1, ///< TIOB output, duty cycle held in RB.
+} Tic_PwmOutput;
+
+/// \brief Structure describing PWM configuration.
+typedef struct {
+	uint32_t peripheralClockFrequency; ///< Tic peripheral clock frequency in Hz.
+	uint32_t frequency; ///< PWM frequency in Hz.
+	uint32_t tioaDutyPermille; ///< TIOA duty cycle in permille.
+	uint32_t tiobDutyPermille; ///< TIOB duty cycle in permille.
+	bool isStartDeferred; ///< Is the start deferred to ::Tic_syncAllChannels.
+} Tic_PwmConfig;
+
+/// \brief Enumeration listing quadrature decoder modes.
+typedef enum {
+	Tic_QdecMode_Position = 0, ///< Position and revolution counting.
+	Tic_QdecMode_Speed = 1, ///< Edge counting over a time base.
+} Tic_QdecMode;
+
+/// \brief Enumeration listing quadrature decoder rotation directions.
+typedef enum {
+	Tic_QdecDirection_Forward = 0, ///< Position counter counts up.
+	Tic_QdecDirection_Reverse = 1, ///< Position counter counts down.
+} Tic_QdecDirection;
+
+/// \brief Structure describing quadrature decoder configuration.
+/// \details PHA and PHB are read from TIOA0 and TIOB0, the index from TIOB1.
+typedef struct {
+	Tic_QdecMode mode; ///< Decoder mode.
+	bool isPhaseAEdgeOnly; ///< Are only PHA edges counted.
+	bool isPhaseAInverted; ///< Is PHA inverted.
+	bool isPhaseBInverted; ///< Is PHB inverted.
+	bool isIndexInverted; ///< Is index inverted.
+	bool arePhasesSwapped; ///< Are PHA and PHB swapped.
+	bool isIndexOnPhaseB; ///< Is the index taken from TIOB0 instead of TIOB1.
+	bool isDirectionDetectionDisabled; ///< Is the decoder transparent.
+	bool isAutoCorrectionEnabled; ///< Is missing pulse auto-correction enabled.
+	uint8_t filter; ///< Glitch filter length in peripheral clock periods.
+	uint8_t maxMissingPulses; ///< Missing pulses before a contamination error.
+	Tic_ClockSelection speedTimeBaseClock; ///< Speed mode time base clock.
+	uint32_t speedTimeBaseTicks; ///< Speed mode time base period in ticks.
+	bool isIndexIrqEnabled; ///< Is index interrupt enabled.
+	bool isDirectionChangeIrqEnabled; ///< Is direction change interrupt enabled.
+	bool isErrorIrqEnabled; ///< Is quadrature error interrupt enabled.
+} Tic_QdecConfig;
+
+/// \brief Structure describing quadrature decoder state.
+typedef struct {
+	uint32_t position; ///< Position counter, edges since the last index.
+	uint32_t revolutions; ///< Revolution counter, index pulses.
+	uint32_t speed; ///< Edges counted in the last speed time base period.
+	Tic_QdecDirection direction; ///< Current rotation direction.
+	bool hasIndexOccurred; ///< Has index occurred.
+	bool hasDirectionChanged; ///< Has direction changed.
+	bool hasErrorOccurred; ///< Has quadrature error occurred.
+	bool hasMissingPulseErrorOccurred; ///< Has missing pulse error occurred.
+} Tic_QdecState;
+
 /// \brief Structure describing Tic.
 typedef struct {
 	/// \brief Tic instance ID.
@@ -416,6 +490,53 @@ uint32_t Tic_getRbValue(const Tic *const tic, const Tic_Channel channel);
 /// \returns The current RC value.
 uint32_t Tic_getRcValue(const Tic *const tic, const Tic_Channel channel);
 
+/// \brief Configures and starts a channel as a PWM generator.
+/// \details The channel runs in the ::Tic_WaveformMode_Up_Rc mode with both
+///          TIOA and TIOB driven high at the period start and low after the
+///          duty cycle. The MCK based prescaler giving the best resolution for
+///          the requested frequency is selected. When the start is deferred,
+///          multiple channels can be started synchronously with
+///          ::Tic_syncAllChannels.
+/// \param [in] tic Pointer to Tic instance.
+/// \param [in] channel Channel to be configured.
+/// \param [in] config PWM configuration.
+/// \retval true The PWM was configured.
+/// \retval false The frequency can not be generated from the peripheral clock.
+bool Tic_startPwm(Tic *const tic, const Tic_Channel channel,
+		const Tic_PwmConfig *const config);
+
+/// \brief Updates the duty cycle of a running PWM output.
+/// \details The update takes effect without a glitch, i.e. no period is
+///          generated with a compare skipped. When the duty cycle decreases,
+///          the call may wait for up to one PWM period. A stopped counter
+///          (disabled channel or deferred start) is detected and not waited for.
+/// \param [in] tic Pointer to Tic instance.
+/// \param [in] channel Channel to be updated.
+/// \param [in] output PWM output to be updated.
+/// \param [in] dutyPermille Duty cycle in permille.
+void Tic_setPwmDuty(Tic *const tic, const Tic_Channel channel,
+		const Tic_PwmOutput output, const uint32_t dutyPermille);
+
+/// \brief Configures and starts the quadrature decoder.
+/// \details Channels 0 and 1 are clocked by the decoder; in the speed mode
+///          channel 2 generates the time base. All channels are restarted
+///          synchronously.
+/// \param [in] tic Pointer to Tic instance.
+/// \param [in] config Quadrature decoder configuration.
+void Tic_setQdecConfig(Tic *const tic, const Tic_QdecConfig *const config);
+
+/// \brief Stops the quadrature decoder.
+/// \param [in] tic Pointer to Tic instance.
+void Tic_disableQdec(Tic *const tic);
+
+/// \brief Reads the quadrature decoder state.
+/// \details The position and revolution counters are read consistently,
+///          i.e. the position belongs to the returned revolution. Reading
+///          clears the reported event flags.
+/// \param [in] tic Pointer to Tic instance.
+/// \param [out] state Quadrature decoder state.
+void Tic_getQdecState(const Tic *const tic, Tic_QdecState *const state);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
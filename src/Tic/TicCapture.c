@@ -0,0 +1,259 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TicCapture.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <Nvic/Nvic.h>
+
+/// \brief Number of ticks in a full counter range.
+#define COUNTER_RANGE ((uint64_t)TIC_COUNTER_MAX_VALUE + 1u)
+
+static void
+setCaptureIrqs(TicCapture *const capture, const bool isEnabled)
+{
+	Tic_ChannelIrqConfig irqConfig;
+	(void)memset(&irqConfig, 0, sizeof(Tic_ChannelIrqConfig));
+	irqConfig.isCounterOverflowIrqEnabled = isEnabled;
+	irqConfig.isLoadOverrunIrqEnabled = isEnabled;
+	irqConfig.isRaLoadingIrqEnabled = isEnabled;
+	irqConfig.isRbLoadingIrqEnabled = isEnabled;
+
+	Tic_setChannelIrqConfig(capture->tic, capture->channel, &irqConfig);
+}
+
+static void
+resetPeriod(TicCapture *const capture)
+{
+	capture->overflowCount = 0u;
+	capture->lowTicks = 0u;
+}
+
+void
+TicCapture_init(
+		TicCapture *const capture, const TicCapture_Config *const config)
+{
+	assert(capture != NULL);
+	assert(config->tic != NULL);
+	assert((config->channel < Tic_Channel_Count) && "Invalid TIC channel");
+
+	capture->tic = config->tic;
+	capture->channel = config->channel;
+	capture->counterFrequency = config->counterFrequency;
+	capture->lostSampleCount = 0u;
+	resetPeriod(capture);
+	TicCapture_SampleFifo_init(&capture->samples);
+
+	Tic_ChannelConfig channelConfig;
+	(void)memset(&channelConfig, 0, sizeof(Tic_ChannelConfig));
+	channelConfig.isEnabled = false;
+	channelConfig.clockSource = config->clockSource;
+	channelConfig.channelMode = Tic_Mode_Capture;
+
+	Tic_CaptureModeConfig *const captureConfig =
+			&channelConfig.modeConfig.captureModeConfig;
+	captureConfig->externalTriggerEdge = Tic_EdgeSelection_Falling;
+	captureConfig->triggerSource = Tic_SignalTriggerSelection_Tioa;
+	captureConfig->raLoadingEdgeSelection = Tic_EdgeSelection_Rising;
+	captureConfig->rbLoadingEdgeSelection = Tic_EdgeSelection_Falling;
+	captureConfig->loadingEdgeSubsampling = Tic_EdgeSubsampling_One;
+
+	Tic_setChannelConfig(config->tic, config->channel, &channelConfig);
+}
+
+void
+TicCapture_start(TicCapture *const capture)
+{
+	resetPeriod(capture);
+	TicCapture_SampleFifo_clear(&capture->samples);
+
+	// Clear the status left by a previous measurement.
+	Tic_ChannelStatus status;
+	Tic_getChannelStatus(capture->tic, capture->channel, &status);
+
+	setCaptureIrqs(capture, true);
+	Tic_enableChannel(capture->tic, capture->channel);
+}
+
+void
+TicCapture_stop(TicCapture *const capture)
+{
+	Tic_disableChannel(capture->tic, capture->channel);
+	setCaptureIrqs(capture, false);
+}
+
+void
+TicCapture_handleInterrupt(TicCapture *const capture)
+{
+	Tic_ChannelStatus status;
+	Tic_getChannelStatus(capture->tic, capture->channel, &status);
+
+	uint32_t overflows = capture->overflowCount;
+	bool isOverflowPending = status.hasCounterOverflowed;
+
+	if (status.hasLoadOverrunOccurred)
+		capture->lostSampleCount++;
+
+	if (status.hasRaLoadOccurred) {
+		const uint32_t ra = Tic_getRaValue(capture->tic, capture->channel);
+		// RA is not loaded on the reset edge, so a small capture means that
+		// the reported overflow occurred before the rising edge.
+		if (isOverflowPending && ((uint64_t)ra < (COUNTER_RANGE / 2u))) {
+			overflows++;
+			isOverflowPending = false;
+		}
+		capture->lowTicks = ((uint64_t)overflows * COUNTER_RANGE) + ra;
+	}
+
+	if (status.hasRbLoadOccurred) {
+		const uint32_t rb = Tic_getRbValue(capture->tic, capture->channel);
+		// The counter is reset together with the RB load, so an overflow
+		// after the load would require a whole counter range of latency.
+		if (isOverflowPending) {
+			overflows++;
+			isOverflowPending = false;
+		}
+
+		const uint64_t period = ((uint64_t)overflows * COUNTER_RANGE) + rb;
+		const TicCapture_Sample sample = {
+			.periodTicks = period,
+			.pulseTicks = (period > capture->lowTicks)
+					? (period - capture->lowTicks)
+					: 0u,
+		};
+		if (!TicCapture_SampleFifo_push(&capture->samples, &sample))
+			capture->lostSampleCount++;
+
+		resetPeriod(capture);
+		overflows = 0u;
+	}
+
+	if (isOverflowPending)
+		overflows++;
+	capture->overflowCount = overflows;
+}
+
+bool
+TicCapture_read(TicCapture *const capture, TicCapture_Sample *const sample)
+{
+	const uint32_t primask = Nvic_saveAndDisableIrq();
+	const bool isPulled =
+			TicCapture_SampleFifo_pull(&capture->samples, sample);
+	Nvic_restoreIrq(primask);
+
+	return isPulled;
+}
+
+void
+TicCapture_startDma(TicCapture *const capture,
+		const TicCapture_DmaConfig *const config)
+{
+	assert((capture->channel == Tic_Channel_0)
+			&& "Only channel 0 has a DMA request");
+	assert(config->xdmac != NULL);
+	assert(config->descriptors != NULL);
+	assert(config->buffer != NULL);
+	assert(config->segmentCount > 0u);
+
+	setCaptureIrqs(capture, false);
+
+	const Xdmac_ChannelConfig channelConfig = {
+		.transferType = Xdmac_TransferType_PeripheralSync,
+		.direction = Xdmac_SyncDirection_PeripheralToMemory,
+		.peripheralId = (Xdmac_PeripheralId)((uint32_t)
+						Xdmac_PeripheralId_Tc0Rx
+				+ (uint32_t)capture->tic->ticId),
+		.burstSize = Xdmac_BurstSize_1,
+		.chunkSize = Xdmac_ChunkSize_1,
+		.dataWidth = Xdmac_DataWidth_Word,
+		.sourceInterface = Xdmac_Interface_1,
+		.destinationInterface = Xdmac_Interface_0,
+		.sourceAddressingMode = Xdmac_AddressingMode_Fixed,
+		.destinationAddressingMode = Xdmac_AddressingMode_Incremented,
+	};
+	Xdmac_setChannelConfig(config->xdmac, config->channel, &channelConfig);
+
+	// RAB returns the next unread capture register, alternating RA and RB.
+	const uint32_t segmentWords =
+			config->segmentLength * TIC_CAPTURE_DMA_WORDS_PER_SAMPLE;
+	uint32_t *segment = config->buffer;
+	for (uint32_t i = 0u; i < config->segmentCount; i++) {
+		Xdmac_initDescriptor(&config->descriptors[i],
+				(const void *)&capture->tic->regs
+						->channelRegs[capture->channel]
+						.rab,
+				segment, segmentWords);
+		segment = &segment[segmentWords];
+	}
+	for (uint32_t i = 0u; i < config->segmentCount; i++) {
+		Xdmac_linkDescriptors(&config->descriptors[i],
+				&config->descriptors[(i + 1u)
+						% config->segmentCount]);
+	}
+
+	Xdmac_startLinkedListTransfer(
+			config->xdmac, config->channel, config->descriptors);
+	Tic_enableChannel(capture->tic, capture->channel);
+}
+
+uint32_t
+TicCapture_getDmaOffset(const TicCapture_DmaConfig *const config)
+{
+	// cppcheck-suppress misra-c2012-11.4
+	return Xdmac_getDestinationAddress(config->xdmac, config->channel)
+			- (uint32_t)config->buffer;
+}
+
+void
+TicCapture_decodeDmaSample(
+		const uint32_t *const captures, TicCapture_Sample *const sample)
+{
+	const uint32_t ra = captures[0];
+	const uint32_t rb = captures[1];
+
+	sample->periodTicks = rb;
+	sample->pulseTicks = (rb > ra) ? (uint64_t)(rb - ra) : 0u;
+}
+
+uint64_t
+TicCapture_getFrequencyMillihertz(const TicCapture *const capture,
+		const TicCapture_Sample *const sample)
+{
+	if (sample->periodTicks == 0u)
+		return 0u;
+
+	return ((uint64_t)capture->counterFrequency * 1000u)
+			/ sample->periodTicks;
+}
+
+uint32_t
+TicCapture_getDutyPermille(const TicCapture_Sample *const sample)
+{
+	if (sample->periodTicks == 0u)
+		return 0u;
+
+	return (uint32_t)((sample->pulseTicks * 1000u) / sample->periodTicks);
+}
@@ -0,0 +1,174 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file TicCapture.h
+/// \addtogroup Bsp
+/// \brief Tic capture mode period and pulse width measurement service.
+/// \details The channel is run in the capture mode with the counter reset on
+///          the falling edge of TIOA, RA loaded on the rising edge and RB on
+///          the following falling edge, so RA holds the low time and RB the
+///          period of the signal. In the interrupt mode captures are extended
+///          with counted counter overflows and queued as samples; in the DMA
+///          mode raw RA/RB pairs are streamed into a circular buffer.
+
+#ifndef BSP_TICCAPTURE_H
+#define BSP_TICCAPTURE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <Utils/TypedFifo.h>
+#include <Xdmac/Xdmac.h>
+
+#include "Tic.h"
+
+/// @addtogroup TicCapture
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef TIC_CAPTURE_FIFO_CAPACITY
+/// \brief Number of samples queued in the interrupt mode, a power of two.
+#define TIC_CAPTURE_FIFO_CAPACITY 16u
+#endif
+
+/// \brief Number of words captured per period in the DMA mode.
+#define TIC_CAPTURE_DMA_WORDS_PER_SAMPLE 2u
+
+/// \brief Single period measurement.
+typedef struct {
+	uint64_t periodTicks; ///< Signal period in counter ticks.
+	uint64_t pulseTicks; ///< High pulse width in counter ticks.
+} TicCapture_Sample;
+
+/// \brief Queue of measured samples.
+TYPED_FIFO_DEFINE(TicCapture_SampleFifo, TicCapture_Sample,
+		TIC_CAPTURE_FIFO_CAPACITY)
+
+/// \brief Capture service configuration.
+typedef struct {
+	Tic *tic; ///< Tic instance measuring the signal.
+	Tic_Channel channel; ///< Tic channel measuring the signal on its TIOA.
+	Tic_ClockSelection clockSource; ///< Counter clock source.
+	uint32_t counterFrequency; ///< Counter clock frequency in Hz.
+} TicCapture_Config;
+
+/// \brief DMA mode configuration.
+typedef struct {
+	Xdmac *xdmac; ///< Xdmac instance.
+	uint8_t channel; ///< Xdmac channel.
+	Xdmac_LinkedListDescriptor *descriptors; ///< Descriptors, one per segment.
+	uint32_t segmentCount; ///< Number of buffer segments.
+	uint32_t segmentLength; ///< Number of samples per segment.
+	/// \brief Circular buffer of segmentCount * segmentLength RA/RB pairs.
+	uint32_t *buffer;
+} TicCapture_DmaConfig;
+
+/// \brief Capture service descriptor.
+typedef struct {
+	Tic *tic; ///< Tic instance measuring the signal.
+	Tic_Channel channel; ///< Tic channel measuring the signal.
+	uint32_t counterFrequency; ///< Counter clock frequency in Hz.
+	uint32_t overflowCount; ///< Counter overflows in the current period.
+	uint64_t lowTicks; ///< Extended low time of the current period.
+	uint32_t lostSampleCount; ///< Samples lost to a full queue or overrun.
+	TicCapture_SampleFifo samples; ///< Measured samples.
+} TicCapture;
+
+/// \brief Initializes the capture service and configures the Tic channel.
+/// \details The channel clock is enabled, but the counter is started by the
+///          first falling edge of the signal, so no partial period is
+///          measured.
+/// \param [out] capture Capture service descriptor.
+/// \param [in] config Capture service configuration.
+void TicCapture_init(
+		TicCapture *const capture, const TicCapture_Config *const config);
+
+/// \brief Starts the measurement in the interrupt mode.
+/// \details ::TicCapture_handleInterrupt shall be called from the Tic channel
+///          interrupt handler.
+/// \param [in,out] capture Capture service descriptor.
+void TicCapture_start(TicCapture *const capture);
+
+/// \brief Stops the measurement.
+/// \param [in,out] capture Capture service descriptor.
+void TicCapture_stop(TicCapture *const capture);
+
+/// \brief Handles the Tic channel interrupt, queueing measured samples.
+/// \details Counter overflows extend the captures beyond the counter range.
+///          An overflow reported together with a capture is attributed by
+///          the captured value, which is exact as long as the interrupt is
+///          served within half of the counter range. The interrupt shall be
+///          served within the shorter of the signal high and low times, so a
+///          RA of the next period is not taken for the current one.
+/// \param [in,out] capture Capture service descriptor.
+void TicCapture_handleInterrupt(TicCapture *const capture);
+
+/// \brief Pulls the oldest measured sample.
+/// \param [in,out] capture Capture service descriptor.
+/// \param [out] sample Measured sample.
+/// \retval true A sample was pulled.
+/// \retval false No sample is queued.
+bool TicCapture_read(TicCapture *const capture, TicCapture_Sample *const sample);
+
+/// \brief Starts the measurement in the DMA mode.
+/// \details Only channel 0 of a Tic instance has a DMA request. The captures
+///          are not extended, so the period shall fit in the counter range.
+/// \param [in,out] capture Capture service descriptor.
+/// \param [in] config DMA mode configuration.
+void TicCapture_startDma(TicCapture *const capture,
+		const TicCapture_DmaConfig *const config);
+
+/// \brief Returns the byte offset in the buffer the DMA will write next.
+/// \param [in] config DMA mode configuration.
+/// \returns Offset of the next written word in bytes.
+uint32_t TicCapture_getDmaOffset(const TicCapture_DmaConfig *const config);
+
+/// \brief Converts a RA/RB pair captured by the DMA into a sample.
+/// \param [in] captures RA/RB pair.
+/// \param [out] sample Measured sample.
+void TicCapture_decodeDmaSample(
+		const uint32_t *const captures, TicCapture_Sample *const sample);
+
+/// \brief Returns the signal frequency of a sample.
+/// \param [in] capture Capture service descriptor.
+/// \param [in] sample Measured sample.
+/// \returns Signal frequency in millihertz, 0 for an empty sample.
+uint64_t TicCapture_getFrequencyMillihertz(const TicCapture *const capture,
+		const TicCapture_Sample *const sample);
+
+/// \brief Returns the duty cycle of a sample.
+/// \param [in] sample Measured sample.
+/// \returns High pulse duty cycle in permille, 0 for an empty sample.
+uint32_t TicCapture_getDutyPermille(const TicCapture_Sample *const sample);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_TICCAPTURE_H
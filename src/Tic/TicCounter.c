@@ -0,0 +1,134 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "TicCounter.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <Utils/Bits.h>
+
+/// \brief Number of ticks in a full channel range.
+#define STAGE_RANGE ((uint64_t)TIC_COUNTER_MAX_VALUE + 1u)
+
+/// \brief Channel value at which the next channel is clocked.
+#define STAGE_CARRY_VALUE ((uint32_t)(STAGE_RANGE / 2u))
+
+/// \brief Number of ticks after the carry in which the next channel may
+///        still not be incremented, due to the external clock resynchronization.
+#define STAGE_CARRY_SETTLE_TICKS 2u
+
+static void
+setStageConfig(Tic *const tic, const Tic_Channel channel,
+		const Tic_ClockSelection clockSource)
+{
+	Tic_ChannelConfig channelConfig;
+	(void)memset(&channelConfig, 0, sizeof(Tic_ChannelConfig));
+	channelConfig.isEnabled = true;
+	channelConfig.clockSource = clockSource;
+	channelConfig.channelMode = Tic_Mode_Waveform;
+	channelConfig.rc = 0u;
+
+	// TIOA rises at half of the range and falls at the wrap, so the next
+	// channel counts the wraps shifted by half of the range.
+	Tic_WaveformModeConfig *const waveConfig =
+			&channelConfig.modeConfig.waveformModeConfig;
+	waveConfig->waveformMode = Tic_WaveformMode_Up;
+	waveConfig->raCompareEffectOnTioa = Tic_TioEffect_Set;
+	waveConfig->rcCompareEffectOnTioa = Tic_TioEffect_Clear;
+	waveConfig->ra = STAGE_CARRY_VALUE;
+
+	Tic_setChannelConfig(tic, channel, &channelConfig);
+}
+
+void
+TicCounter_init(TicCounter *const counter, Tic *const tic,
+		const Tic_ClockSelection clockSource)
+{
+	assert(counter != NULL);
+	assert(tic != NULL);
+
+	counter->tic = tic;
+
+	uint32_t bmr = tic->regs->bmr;
+	bmr &= ~(TIC_BMR_TC1XC1S_MASK | TIC_BMR_TC2XC2S_MASK);
+	bmr |= BIT_FIELD_VALUE(TIC_BMR_TC1XC1S,
+			Tic_ExternalClock1SignalSelection_Tioa0);
+#if TIC_COUNTER_STAGE_COUNT > 2u
+	bmr |= BIT_FIELD_VALUE(TIC_BMR_TC2XC2S,
+			Tic_ExternalClock2SignalSelection_Tioa1);
+#endif
+	tic->regs->bmr = bmr;
+
+	setStageConfig(tic, Tic_Channel_0, clockSource);
+	setStageConfig(tic, Tic_Channel_1, Tic_ClockSelection_Xc1);
+#if TIC_COUNTER_STAGE_COUNT > 2u
+	setStageConfig(tic, Tic_Channel_2, Tic_ClockSelection_Xc2);
+#endif
+
+	Tic_syncAllChannels(tic);
+}
+
+static bool
+readStages(const Tic *const tic, uint32_t *const values)
+{
+	for (uint32_t i = TIC_COUNTER_STAGE_COUNT; i > 0u; i--)
+		values[i - 1u] = tic->regs->channelRegs[i - 1u].cv;
+
+	// Each stage shall be stable while the lower stages are read and not
+	// be just after its carry, so the carry is visible in the upper stage.
+	for (uint32_t i = 0u; i < TIC_COUNTER_STAGE_COUNT; i++) {
+		if ((i > 0u) && (tic->regs->channelRegs[i].cv != values[i]))
+			return false;
+		if ((i + 1u < TIC_COUNTER_STAGE_COUNT)
+				&& (values[i] >= STAGE_CARRY_VALUE)
+				&& ((values[i] - STAGE_CARRY_VALUE)
+						< STAGE_CARRY_SETTLE_TICKS))
+			return false;
+	}
+
+	return true;
+}
+
+uint64_t
+TicCounter_read(const TicCounter *const counter)
+{
+	uint32_t values[TIC_COUNTER_STAGE_COUNT];
+	while (!readStages(counter->tic, values))
+		asm volatile("nop" ::: "memory");
+
+	// The upper stage counts carries, which happen at half of the range of
+	// the lower one, so it is ahead by one in the upper half.
+	uint64_t value = values[TIC_COUNTER_STAGE_COUNT - 1u];
+	for (uint32_t i = TIC_COUNTER_STAGE_COUNT - 1u; i > 0u; i--) {
+		const uint32_t lower = values[i - 1u];
+		const uint64_t wraps = ((lower >= STAGE_CARRY_VALUE) && (value > 0u))
+				? (value - 1u)
+				: value;
+		value = (wraps * STAGE_RANGE) + lower;
+	}
+
+	return value;
+}
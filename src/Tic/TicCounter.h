@@ -0,0 +1,83 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file TicCounter.h
+/// \addtogroup Bsp
+/// \brief Free-running 64-bit counter built from chained Tic channels.
+/// \details Each channel runs free in the waveform mode and raises its TIOA
+///          at half of its range, which clocks the next channel through the
+///          XC1/XC2 connections. On SAMV71, with 16-bit channels, all three
+///          channels of the instance are chained into a 48-bit counter; on
+///          SAMRH71 channels 0 and 1 form a 64-bit counter. The counter is
+///          extended in hardware, so no interrupt is needed.
+
+#ifndef BSP_TICCOUNTER_H
+#define BSP_TICCOUNTER_H
+
+#include <stdint.h>
+
+#include "Tic.h"
+
+/// @addtogroup TicCounter
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if defined(N7S_TARGET_SAMV71Q21)
+/// \brief Number of chained channels.
+#define TIC_COUNTER_STAGE_COUNT 3u
+#elif defined(N7S_TARGET_SAMRH71F20) || defined(N7S_TARGET_SAMRH707F18)
+/// \brief Number of chained channels.
+#define TIC_COUNTER_STAGE_COUNT 2u
+#endif
+
+/// \brief Chained counter descriptor.
+typedef struct {
+	Tic *tic; ///< Tic instance providing the chained channels.
+} TicCounter;
+
+/// \brief Initializes and starts the chained counter.
+/// \param [out] counter Chained counter descriptor.
+/// \param [in] tic Tic instance, whose channels are all taken by the counter
+///             on SAMV71 and channels 0 and 1 on SAMRH71.
+/// \param [in] clockSource Clock source of the lowest channel; it shall be
+///             at most half of the peripheral clock.
+void TicCounter_init(TicCounter *const counter, Tic *const tic,
+		const Tic_ClockSelection clockSource);
+
+/// \brief Returns the current counter value.
+/// \details The channels are read until a consistent snapshot is obtained.
+/// \param [in] counter Chained counter descriptor.
+/// \returns Number of ticks of the clock source since the initialization.
+uint64_t TicCounter_read(const TicCounter *const counter);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_TICCOUNTER_H
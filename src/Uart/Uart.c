@@ -26,8 +26,42 @@
 #include <assert.h>
 #include <string.h>
 
+#include <Pmc/PmcClockManager.h>
+
 #define UART_BAUDRATE_BASE_SCALER 16u
 
+/// \brief Maximum number of RX/TX servicing rounds performed by a single interrupt.
+#if defined(BSP_HOST_REGISTERS)
+// Register models advance only between the handler calls.
+#define UART_INTERRUPT_BATCH_SIZE 1u
+#else
+#define UART_INTERRUPT_BATCH_SIZE 32u
+#endif
+
+/// \brief Iteration limit for waiting until a stopped Xdmac channel is disabled.
+#define UART_DMA_STOP_TIMEOUT_LIMIT 10000u
+
+/// \brief Iteration limit for waiting until an Xdmac channel FIFO is flushed.
+#define UART_DMA_FLUSH_TIMEOUT_LIMIT 10000u
+
+#if defined(UART_ENABLE_STATISTICS)
+#define UART_STATISTICS_ADD(uart, counter, value) \
+	((uart)->statistics.counter += (uint32_t)(value))
+#define UART_STATISTICS_MAX(uart, counter, value) \
+	((uart)->statistics.counter = \
+			maxUInt32((uart)->statistics.counter, (uint32_t)(value)))
+#else
+#define UART_STATISTICS_ADD(uart, counter, value) ((void)0)
+#define UART_STATISTICS_MAX(uart, counter, value) ((void)0)
+#endif
+
+static inline void
+transmitByte(Uart *const uart, const uint8_t data)
+{
+	uart->reg->thr = data;
+	UART_STATISTICS_ADD(uart, txBytes, 1u);
+}
+
 static inline void
 enableTxIrq(Uart *const uart)
 {
@@ -52,9 +86,29 @@ disableRxIrq(Uart *const uart)
 	uart->reg->idr = UART_IDR_RXRDY_MASK;
 }
 
+#if defined(N7S_TARGET_SAMV71Q21)
+static Pmc_PeripheralId
+peripheralId(const Uart_Id id)
+{
+	switch (id) {
+	case Uart_Id_0: return Pmc_PeripheralId_Uart0;
+	case Uart_Id_1: return Pmc_PeripheralId_Uart1;
+	case Uart_Id_2: return Pmc_PeripheralId_Uart2;
+	case Uart_Id_3: return Pmc_PeripheralId_Uart3;
+	case Uart_Id_4: return Pmc_PeripheralId_Uart4;
+	}
+	assert(0 && "Incorrect UART id");
+	return Pmc_PeripheralId_Uart0;
+}
+#endif
+
 void
 Uart_startup(Uart *const uart)
 {
+#if defined(N7S_TARGET_SAMV71Q21)
+	PmcClockManager_acquire(peripheralId(uart->id));
+#endif
+
 	// Disable all interrupt sources.
 	uart->reg->idr = (UART_IDR_RXRDY_MASK | UART_IDR_TXRDY_MASK
 			| UART_IDR_OVRE_MASK | UART_IDR_FRAME_MASK
@@ -64,7 +118,13 @@ Uart_startup(Uart *const uart)
 void
 Uart_shutdown(Uart *const uart)
 {
-	(void)uart;
+	uart->reg->idr = (UART_IDR_RXRDY_MASK | UART_IDR_TXRDY_MASK
+			| UART_IDR_OVRE_MASK | UART_IDR_FRAME_MASK
+			| UART_IDR_PARE_MASK | UART_IDR_TXEMPTY_MASK);
+
+#if defined(N7S_TARGET_SAMV71Q21)
+	PmcClockManager_release(peripheralId(uart->id));
+#endif
 }
 
 static uint32_t
@@ -143,6 +203,14 @@ Uart_getConfig(const Uart *const uart, Uart_Config *const config)
 			((mr & UART_MR_BSRCCK_MASK) >> UART_MR_BSRCCK_OFFSET);
 }
 
+void
+Uart_setBaudRateClkFreq(Uart *const uart, const uint32_t frequency)
+{
+	uart->config.baudRateClkFreq = frequency;
+	uart->reg->brgr = (frequency
+			/ (UART_BAUDRATE_BASE_SCALER * uart->config.baudRate));
+}
+
 bool
 Uart_write(Uart *const uart, const uint8_t data, uint32_t const timeoutLimit,
 		int *const errCode)
@@ -154,11 +222,30 @@ Uart_write(Uart *const uart, const uint8_t data, uint32_t const timeoutLimit,
 	if (timeout == 0u)
 		return returnError(errCode, Uart_ErrorCodes_Timeout);
 
-	uart->reg->thr = data;
+	transmitByte(uart, data);
 
 	return true;
 }
 
+bool
+Uart_writeWithDeadline(Uart *const uart, const uint8_t data,
+		const Dwt_Deadline *const deadline, int *const errCode)
+{
+	if (!Dwt_waitForRegister(&uart->reg->sr, UART_SR_TXRDY_MASK, deadline))
+		return returnError(errCode, Uart_ErrorCodes_Timeout);
+
+	transmitByte(uart, data);
+
+	return true;
+}
+
+static inline void
+receiveByte(Uart *const uart, uint8_t *const data)
+{
+	*data = (uint8_t)uart->reg->rhr;
+	UART_STATISTICS_ADD(uart, rxBytes, 1u);
+}
+
 bool
 Uart_read(Uart *const uart, uint8_t *const data, uint32_t timeoutLimit,
 		int *const errCode)
@@ -170,23 +257,112 @@ Uart_read(Uart *const uart, uint8_t *const data, uint32_t timeoutLimit,
 	if (timeout == 0u)
 		return returnError(errCode, Uart_ErrorCodes_Timeout);
 
-	*data = (uint8_t)uart->reg->rhr;
+	receiveByte(uart, data);
+
+	return true;
+}
+
+bool
+Uart_readWithDeadline(Uart *const uart, uint8_t *const data,
+		const Dwt_Deadline *const deadline, int *const errCode)
+{
+	if (!Dwt_waitForRegister(&uart->reg->sr, UART_SR_RXRDY_MASK, deadline))
+		return returnError(errCode, Uart_ErrorCodes_Timeout);
+
+	receiveByte(uart, data);
 
 	return true;
 }
 
+static inline void
+reportDmaError(const Uart *const uart)
+{
+	if (uart->errorHandler.callback == NULL)
+		return;
+
+	const Uart_ErrorFlags errorFlags = { false, false, false, false, true };
+	uart->errorHandler.callback(errorFlags, uart->errorHandler.arg);
+}
+
+static inline bool
+stopDmaChannel(const Uart *const uart, const uint8_t channel)
+{
+	if (Xdmac_stopTransfer(uart->dmaConfig.xdmac, channel,
+			    UART_DMA_STOP_TIMEOUT_LIMIT))
+		return true;
+
+	reportDmaError(uart);
+	return false;
+}
+
+static inline void
+stopTxDma(Uart *const uart)
+{
+	if (!uart->isTxDmaEnabled)
+		return;
+
+	Xdmac_disableChannelIrq(uart->dmaConfig.xdmac, uart->dmaConfig.txChannel);
+	if (uart->txDmaLength != 0u)
+		(void)stopDmaChannel(uart, uart->dmaConfig.txChannel);
+	uart->txDmaLength = 0;
+	uart->isTxDmaEnabled = false;
+}
+
+static inline void
+syncRxDma(Uart *const uart)
+{
+	if (uart->rxDmaLength == 0u)
+		return;
+
+	// Bytes held in the channel FIFO are already accounted for in the remaining length.
+	// Without a flush they are synchronized at the end of the block.
+	if (!Xdmac_flushChannel(uart->dmaConfig.xdmac, uart->dmaConfig.rxChannel,
+			    UART_DMA_FLUSH_TIMEOUT_LIMIT))
+		return;
+
+	const uint32_t received = uart->rxDmaLength
+			- Xdmac_getRemainingLength(uart->dmaConfig.xdmac,
+					uart->dmaConfig.rxChannel);
+	uint8_t *data = NULL;
+	(void)ByteFifo_getWritableSpan(uart->rxFifo, &data);
+	Xdmac_invalidateDCache(data, received - uart->rxDmaCommitted);
+	ByteFifo_commitWrite(uart->rxFifo, received - uart->rxDmaCommitted);
+	uart->rxByteCount += received - uart->rxDmaCommitted;
+	UART_STATISTICS_ADD(uart, rxBytes, received - uart->rxDmaCommitted);
+	UART_STATISTICS_MAX(uart, rxFifoHighWaterMark,
+			ByteFifo_getCount(uart->rxFifo));
+	uart->rxDmaCommitted = received;
+}
+
+static inline void
+stopRxDma(Uart *const uart)
+{
+	if (!uart->isRxDmaEnabled)
+		return;
+
+	Xdmac_disableChannelIrq(uart->dmaConfig.xdmac, uart->dmaConfig.rxChannel);
+	// Keep bytes received before the channel was stopped.
+	if ((uart->rxDmaLength != 0u)
+			&& stopDmaChannel(uart, uart->dmaConfig.rxChannel))
+		syncRxDma(uart);
+	uart->rxDmaLength = 0;
+	uart->isRxDmaEnabled = false;
+}
+
 void
 Uart_writeAsync(Uart *const uart, ByteFifo *const fifo,
 		const Uart_TxHandler handler)
 {
 	disableTxIrq(uart);
+	stopTxDma(uart);
 
+	uart->txSpscFifo = NULL;
 	uart->txFifo = fifo;
 	uart->txHandler = handler;
 
 	uint8_t data;
 	if ((uart->txFifo != NULL) && ByteFifo_pull(uart->txFifo, &data)) {
-		uart->reg->thr = data;
+		transmitByte(uart, data);
 		enableTxIrq(uart);
 	}
 }
@@ -196,7 +372,9 @@ Uart_readAsync(Uart *const uart, ByteFifo *const fifo,
 		const Uart_RxHandler handler)
 {
 	disableRxIrq(uart);
+	stopRxDma(uart);
 
+	uart->rxSpscFifo = NULL;
 	uart->rxFifo = fifo;
 	uart->rxHandler = handler;
 
@@ -204,12 +382,333 @@ Uart_readAsync(Uart *const uart, ByteFifo *const fifo,
 		enableRxIrq(uart);
 }
 
+void
+Uart_writeAsyncSpsc(Uart *const uart, SpscByteFifo *const fifo)
+{
+	if (uart->txSpscFifo != fifo) {
+		disableTxIrq(uart);
+		stopTxDma(uart);
+		uart->txFifo = NULL;
+		uart->txSpscFifo = fifo;
+	}
+
+	// The interrupt handler takes care of the first byte, as TXEMPTY is raised immediately
+	// when the transmitter is idle.
+	if ((uart->txSpscFifo != NULL) && !SpscByteFifo_isEmpty(uart->txSpscFifo))
+		enableTxIrq(uart);
+}
+
+void
+Uart_readAsyncSpsc(Uart *const uart, SpscByteFifo *const fifo,
+		const Uart_RxHandler handler)
+{
+	disableRxIrq(uart);
+	stopRxDma(uart);
+
+	uart->rxFifo = NULL;
+	uart->rxSpscFifo = fifo;
+	uart->rxHandler = handler;
+
+	if (uart->rxSpscFifo != NULL)
+		enableRxIrq(uart);
+}
+
+static inline Xdmac_PeripheralId
+txPeripheralId(const Uart_Id id)
+{
+	return (Xdmac_PeripheralId)((uint32_t)Xdmac_PeripheralId_Uart0Tx
+			+ (2u * (uint32_t)id));
+}
+
+static inline Xdmac_PeripheralId
+rxPeripheralId(const Uart_Id id)
+{
+	return (Xdmac_PeripheralId)((uint32_t)Xdmac_PeripheralId_Uart0Rx
+			+ (2u * (uint32_t)id));
+}
+
+static void handleTxDmaEvent(Xdmac_ChannelStatus status, void *arg);
+static void handleRxDmaEvent(Xdmac_ChannelStatus status, void *arg);
+
+static inline bool
+hasDmaTransferFailed(const Xdmac_ChannelStatus *const status)
+{
+	return status->hasReadBusErrorOccurred || status->hasWriteBusErrorOccurred
+			|| status->hasRequestOverflowOccurred;
+}
+
+static inline uint32_t
+getDmaTransferredLength(const Uart *const uart, const uint8_t channel,
+		const uint32_t length, const bool hasFailed)
+{
+	if (!hasFailed)
+		return length;
+
+	// The erroneous block is abandoned, only data moved before the error is valid.
+	return length - Xdmac_getRemainingLength(uart->dmaConfig.xdmac, channel);
+}
+
+void
+Uart_setDmaConfig(Uart *const uart, const Uart_DmaConfig *const config)
+{
+	assert(config->xdmac != NULL);
+
+	uart->dmaConfig = *config;
+
+	Xdmac_ChannelConfig channelConfig = {
+		.transferType = Xdmac_TransferType_PeripheralSync,
+		.direction = Xdmac_SyncDirection_MemoryToPeripheral,
+		.peripheralId = txPeripheralId(uart->id),
+		.burstSize = Xdmac_BurstSize_1,
+		.chunkSize = Xdmac_ChunkSize_1,
+		.dataWidth = Xdmac_DataWidth_Byte,
+		.sourceInterface = Xdmac_Interface_0,
+		.destinationInterface = Xdmac_Interface_1,
+		.sourceAddressingMode = Xdmac_AddressingMode_Incremented,
+		.destinationAddressingMode = Xdmac_AddressingMode_Fixed,
+	};
+	Xdmac_setChannelConfig(config->xdmac, config->txChannel, &channelConfig);
+
+	channelConfig.direction = Xdmac_SyncDirection_PeripheralToMemory;
+	channelConfig.peripheralId = rxPeripheralId(uart->id);
+	channelConfig.sourceInterface = Xdmac_Interface_1;
+	channelConfig.destinationInterface = Xdmac_Interface_0;
+	channelConfig.sourceAddressingMode = Xdmac_AddressingMode_Fixed;
+	channelConfig.destinationAddressingMode =
+			Xdmac_AddressingMode_Incremented;
+	Xdmac_setChannelConfig(config->xdmac, config->rxChannel, &channelConfig);
+
+	const Xdmac_ChannelHandler txHandler = {
+		.callback = handleTxDmaEvent,
+		.arg = uart,
+	};
+	Xdmac_setChannelHandler(config->xdmac, config->txChannel, txHandler);
+	Xdmac_disableChannelIrq(config->xdmac, config->txChannel);
+
+	const Xdmac_ChannelHandler rxHandler = {
+		.callback = handleRxDmaEvent,
+		.arg = uart,
+	};
+	Xdmac_setChannelHandler(config->xdmac, config->rxChannel, rxHandler);
+	Xdmac_disableChannelIrq(config->xdmac, config->rxChannel);
+}
+
+static inline bool
+startTxDma(Uart *const uart)
+{
+	const uint8_t *span = NULL;
+	const size_t spanSize = ByteFifo_getReadableSpan(uart->txFifo, &span);
+	if (spanSize == 0u)
+		return false;
+
+	uart->txDmaLength = minUInt32(
+			(uint32_t)spanSize, XDMAC_MAX_MICROBLOCK_LENGTH);
+	// cppcheck-suppress misra-c2012-11.8
+	Xdmac_startTransfer(uart->dmaConfig.xdmac, uart->dmaConfig.txChannel,
+			span, (void *)&uart->reg->thr, uart->txDmaLength);
+	return true;
+}
+
+static void
+handleTxDmaEvent(Xdmac_ChannelStatus status, void *arg)
+{
+	Uart *const uart = (Uart *)arg;
+
+	if ((uart->txFifo == NULL) || (uart->txDmaLength == 0u))
+		return;
+
+	const bool hasFailed = hasDmaTransferFailed(&status);
+	if (hasFailed && !stopDmaChannel(uart, uart->dmaConfig.txChannel)) {
+		// The channel cannot be re-armed, transmission stays suspended.
+		uart->txDmaLength = 0;
+		return;
+	}
+
+	const uint32_t sent = getDmaTransferredLength(uart,
+			uart->dmaConfig.txChannel, uart->txDmaLength, hasFailed);
+	ByteFifo_commitRead(uart->txFifo, sent);
+	UART_STATISTICS_ADD(uart, txBytes, sent);
+	uart->txDmaLength = 0;
+
+	if (hasFailed)
+		reportDmaError(uart);
+
+	while (!startTxDma(uart)) {
+		if (uart->txHandler.callback != NULL)
+			uart->txFifo = uart->txHandler.callback(
+					uart->txHandler.arg);
+		else
+			uart->txFifo = NULL;
+
+		if (uart->txFifo == NULL)
+			return;
+	}
+}
+
+void
+Uart_writeAsyncDma(Uart *const uart, ByteFifo *const fifo,
+		const Uart_TxHandler handler)
+{
+	assert(uart->dmaConfig.xdmac != NULL);
+
+	disableTxIrq(uart);
+	stopTxDma(uart);
+
+	uart->txSpscFifo = NULL;
+	uart->txFifo = fifo;
+	uart->txHandler = handler;
+	uart->isTxDmaEnabled = true;
+
+	if (uart->txFifo != NULL)
+		(void)startTxDma(uart);
+
+	Xdmac_enableChannelIrq(uart->dmaConfig.xdmac, uart->dmaConfig.txChannel);
+}
+
+static inline void
+startRxDma(Uart *const uart)
+{
+	uart->rxDmaLength = 0;
+	uart->rxDmaCommitted = 0;
+
+	uint8_t *span = NULL;
+	const size_t spanSize = ByteFifo_getWritableSpan(uart->rxFifo, &span);
+	// With the queue full reception is resumed by Uart_readRxFifo.
+	if (spanSize == 0u)
+		return;
+
+	uint32_t length = minUInt32(
+			(uint32_t)spanSize, XDMAC_MAX_MICROBLOCK_LENGTH);
+	// End the block when the queue reaches the target length, so that
+	// the length callback is not delayed.
+	const uint32_t count = (uint32_t)ByteFifo_getCount(uart->rxFifo);
+	if ((uart->rxHandler.lengthCallback != NULL)
+			&& (count < uart->rxHandler.targetLength))
+		length = minUInt32(length, uart->rxHandler.targetLength - count);
+
+	uart->rxDmaLength = length;
+	// cppcheck-suppress misra-c2012-11.8
+	Xdmac_startTransfer(uart->dmaConfig.xdmac, uart->dmaConfig.rxChannel,
+			(const void *)&uart->reg->rhr, span, length);
+}
+
+static void
+handleRxDmaEvent(Xdmac_ChannelStatus status, void *arg)
+{
+	Uart *const uart = (Uart *)arg;
+
+	if ((uart->rxFifo == NULL) || (uart->rxDmaLength == 0u))
+		return;
+
+	const bool hasFailed = hasDmaTransferFailed(&status);
+	if (hasFailed && !stopDmaChannel(uart, uart->dmaConfig.rxChannel)) {
+		// The channel cannot be re-armed, reception stays suspended.
+		uart->rxDmaLength = 0;
+		return;
+	}
+
+	uint8_t *data = NULL;
+	(void)ByteFifo_getWritableSpan(uart->rxFifo, &data);
+	const uint32_t transferred = getDmaTransferredLength(uart,
+			uart->dmaConfig.rxChannel, uart->rxDmaLength, hasFailed);
+	const uint32_t received = transferred - uart->rxDmaCommitted;
+	Xdmac_invalidateDCache(data, received);
+	ByteFifo_commitWrite(uart->rxFifo, received);
+	uart->rxByteCount += received;
+	UART_STATISTICS_ADD(uart, rxBytes, received);
+	UART_STATISTICS_MAX(uart, rxFifoHighWaterMark,
+			ByteFifo_getCount(uart->rxFifo));
+
+	// Re-arm the channel first, the Uart holds a single received byte only.
+	startRxDma(uart);
+
+	if (hasFailed)
+		reportDmaError(uart);
+
+	if ((uart->rxHandler.characterCallback != NULL)
+			&& (memchr(data, uart->rxHandler.targetCharacter, received)
+					!= NULL))
+		uart->rxHandler.characterCallback(uart->rxHandler.characterArg);
+	if ((uart->rxHandler.lengthCallback != NULL)
+			&& (ByteFifo_getCount(uart->rxFifo)
+					>= uart->rxHandler.targetLength))
+		uart->rxHandler.lengthCallback(uart->rxHandler.lengthArg);
+}
+
+void
+Uart_readAsyncDma(Uart *const uart, ByteFifo *const fifo,
+		const Uart_RxHandler handler)
+{
+	assert(uart->dmaConfig.xdmac != NULL);
+
+	disableRxIrq(uart);
+	stopRxDma(uart);
+
+	uart->rxSpscFifo = NULL;
+	uart->rxFifo = fifo;
+	uart->rxHandler = handler;
+	uart->isRxDmaEnabled = true;
+
+	if (uart->rxFifo == NULL)
+		return;
+
+	startRxDma(uart);
+	Xdmac_enableChannelIrq(uart->dmaConfig.xdmac, uart->dmaConfig.rxChannel);
+}
+
+static inline void
+readRxDmaFifo(Uart *const uart, ByteFifo *const fifo)
+{
+	Xdmac_disableChannelIrq(uart->dmaConfig.xdmac, uart->dmaConfig.rxChannel);
+
+	syncRxDma(uart);
+	for (uint32_t segment = 0; segment < 2u; ++segment) {
+		const uint8_t *span = NULL;
+		const size_t spanSize =
+				ByteFifo_getReadableSpan(uart->rxFifo, &span);
+		const size_t pushed = ByteFifo_pushBytes(fifo, span, spanSize);
+		ByteFifo_commitRead(uart->rxFifo, pushed);
+		if (pushed < spanSize)
+			break;
+	}
+
+	if (uart->rxDmaLength == 0u)
+		startRxDma(uart);
+
+	Xdmac_enableChannelIrq(uart->dmaConfig.xdmac, uart->dmaConfig.rxChannel);
+}
+
+static inline void
+readRxSpscFifo(Uart *const uart, ByteFifo *const fifo)
+{
+	// Only the consumer side of the lock-free queue is touched, no need for masking.
+	uint8_t *span = NULL;
+	for (uint32_t segment = 0; segment < 2u; ++segment) {
+		const size_t spanSize = ByteFifo_getWritableSpan(fifo, &span);
+		const size_t pulled = SpscByteFifo_pullBytes(
+				uart->rxSpscFifo, span, spanSize);
+		ByteFifo_commitWrite(fifo, pulled);
+		if (pulled < spanSize)
+			break;
+	}
+}
+
 void
 Uart_readRxFifo(Uart *const uart, ByteFifo *const fifo)
 {
+	if (uart->rxSpscFifo != NULL) {
+		readRxSpscFifo(uart, fifo);
+		return;
+	}
+
 	if (uart->rxFifo == NULL)
 		return;
 
+	if (uart->isRxDmaEnabled) {
+		readRxDmaFifo(uart, fifo);
+		return;
+	}
+
 	while (!ByteFifo_isFull(fifo)) {
 		disableRxIrq(uart);
 
@@ -223,6 +722,68 @@ Uart_readRxFifo(Uart *const uart, ByteFifo *const fifo)
 	}
 }
 
+void
+Uart_setIdleDetectionConfig(
+		Uart *const uart, const Uart_IdleDetectionConfig *const config)
+{
+	assert(config->tic != NULL);
+	assert(config->period > 0u);
+
+	uart->idleConfig = *config;
+	uart->idleRxByteCount = uart->rxByteCount;
+	uart->isRxFramePending = false;
+
+	Tic_ChannelConfig channelConfig;
+	(void)memset(&channelConfig, 0, sizeof(Tic_ChannelConfig));
+	channelConfig.isEnabled = true;
+	channelConfig.clockSource = config->clockSource;
+	channelConfig.channelMode = Tic_Mode_Waveform;
+	channelConfig.modeConfig.waveformModeConfig.waveformMode =
+			Tic_WaveformMode_Up_Rc;
+	channelConfig.irqConfig.isRcCompareIrqEnabled = true;
+	channelConfig.rc = config->period;
+
+	Tic_setChannelConfig(config->tic, config->channel, &channelConfig);
+	Tic_triggerChannel(config->tic, config->channel);
+}
+
+static inline uint32_t
+getRxProgress(const Uart *const uart)
+{
+	// Bytes of the DMA block in progress are not queued yet, but still count as activity.
+	// No flush is needed, as the data itself is read only after syncRxDma.
+	if (uart->isRxDmaEnabled && (uart->rxDmaLength != 0u))
+		return uart->rxByteCount + uart->rxDmaLength
+				- Xdmac_getRemainingLength(uart->dmaConfig.xdmac,
+						uart->dmaConfig.rxChannel)
+				- uart->rxDmaCommitted;
+	return uart->rxByteCount;
+}
+
+void
+Uart_handleIdleTimerInterrupt(Uart *const uart)
+{
+	Tic_ChannelStatus status;
+	Tic_getChannelStatus(
+			uart->idleConfig.tic, uart->idleConfig.channel, &status);
+	if (!status.hasRcCompareOccurred)
+		return;
+
+	const uint32_t progress = getRxProgress(uart);
+	if (progress != uart->idleRxByteCount) {
+		uart->idleRxByteCount = progress;
+		uart->isRxFramePending = true;
+		return;
+	}
+
+	if (!uart->isRxFramePending)
+		return;
+
+	uart->isRxFramePending = false;
+	if (uart->rxHandler.idleCallback != NULL)
+		uart->rxHandler.idleCallback(uart->rxHandler.idleArg);
+}
+
 void
 Uart_registerErrorHandler(Uart *const uart, const Uart_ErrorHandler handler)
 {
@@ -239,6 +800,20 @@ Uart_registerErrorHandler(Uart *const uart, const Uart_ErrorHandler handler)
 uint32_t
 Uart_getTxFifoCount(Uart *const uart)
 {
+	if (uart->txSpscFifo != NULL)
+		return (uint32_t)SpscByteFifo_getCount(uart->txSpscFifo);
+
+	if (uart->isTxDmaEnabled) {
+		Xdmac_disableChannelIrq(
+				uart->dmaConfig.xdmac, uart->dmaConfig.txChannel);
+		const uint32_t count = (uart->txFifo == NULL)
+				? 0u
+				: (uint32_t)ByteFifo_getCount(uart->txFifo);
+		Xdmac_enableChannelIrq(
+				uart->dmaConfig.xdmac, uart->dmaConfig.txChannel);
+		return count;
+	}
+
 	disableTxIrq(uart);
 
 	uint32_t count;
@@ -255,6 +830,21 @@ Uart_getTxFifoCount(Uart *const uart)
 uint32_t
 Uart_getRxFifoCount(Uart *const uart)
 {
+	if (uart->rxSpscFifo != NULL)
+		return (uint32_t)SpscByteFifo_getCount(uart->rxSpscFifo);
+
+	if (uart->isRxDmaEnabled) {
+		if (uart->rxFifo == NULL)
+			return 0;
+		Xdmac_disableChannelIrq(
+				uart->dmaConfig.xdmac, uart->dmaConfig.rxChannel);
+		syncRxDma(uart);
+		const uint32_t count = (uint32_t)ByteFifo_getCount(uart->rxFifo);
+		Xdmac_enableChannelIrq(
+				uart->dmaConfig.xdmac, uart->dmaConfig.rxChannel);
+		return count;
+	}
+
 	disableRxIrq(uart);
 
 	uint32_t count;
@@ -273,34 +863,74 @@ handleRxInterrupt(Uart *const uart, int* const errCode)
 {
 	uint8_t data = (uint8_t)uart->reg->rhr;
 
-	if (uart->rxFifo == NULL) {
+	if (uart->rxSpscFifo != NULL) {
+		if (!SpscByteFifo_push(uart->rxSpscFifo, data)) {
+			UART_STATISTICS_ADD(uart, rxFifoFullDrops, 1u);
+			return returnError(errCode, Uart_ErrorCodes_Rx_Fifo_Full);
+		}
+	} else if (uart->rxFifo != NULL) {
+		if(!ByteFifo_push(uart->rxFifo, data)) {
+			UART_STATISTICS_ADD(uart, rxFifoFullDrops, 1u);
+			return returnError(errCode, Uart_ErrorCodes_Rx_Fifo_Full);
+		}
+	} else {
 		disableRxIrq(uart);
 		return true;
 	}
-
-	if(!ByteFifo_push(uart->rxFifo, data)) {
-		return returnError(errCode, Uart_ErrorCodes_Rx_Fifo_Full);
-	}
+	++uart->rxByteCount;
+	UART_STATISTICS_ADD(uart, rxBytes, 1u);
 
 	if ((uart->rxHandler.characterCallback != NULL)
 			&& (data == uart->rxHandler.targetCharacter))
 		uart->rxHandler.characterCallback(uart->rxHandler.characterArg);
+
+	return true;
+}
+
+static inline void
+handleRxLength(Uart *const uart)
+{
+	size_t count = 0;
+	if (uart->rxSpscFifo != NULL)
+		count = SpscByteFifo_getCount(uart->rxSpscFifo);
+	else if (uart->rxFifo != NULL)
+		count = ByteFifo_getCount(uart->rxFifo);
+	else
+		return;
+
+	UART_STATISTICS_MAX(uart, rxFifoHighWaterMark, count);
+
 	if ((uart->rxHandler.lengthCallback != NULL)
-			&& (ByteFifo_getCount(uart->rxFifo)
-					>= uart->rxHandler.targetLength))
+			&& (count >= uart->rxHandler.targetLength))
 		uart->rxHandler.lengthCallback(uart->rxHandler.lengthArg);
+}
 
-	return true;
+static inline void
+handleTxSpscInterrupt(Uart *const uart)
+{
+	uint8_t data = 0;
+	if (SpscByteFifo_pull(uart->txSpscFifo, &data)) {
+		transmitByte(uart, data);
+		return;
+	}
+
+	disableTxIrq(uart);
+	// The producer might have pushed data and resumed transmission just before the interrupt
+	// was disabled - re-check to avoid stalling the queue.
+	if (!SpscByteFifo_isEmpty(uart->txSpscFifo))
+		enableTxIrq(uart);
 }
 
 static inline void
 handleTxInterrupt(Uart *const uart)
 {
 	uint8_t data = 0;
-	if (uart->txFifo == NULL) {
+	if (uart->txSpscFifo != NULL) {
+		handleTxSpscInterrupt(uart);
+	} else if (uart->txFifo == NULL) {
 		disableTxIrq(uart);
 	} else if (ByteFifo_pull(uart->txFifo, &data)) {
-		uart->reg->thr = data;
+		transmitByte(uart, data);
 	} else {
 		do {
 			if (uart->txHandler.callback != NULL)
@@ -315,7 +945,7 @@ handleTxInterrupt(Uart *const uart)
 			}
 		} while (!ByteFifo_pull(uart->txFifo, &data));
 
-		uart->reg->thr = data;
+		transmitByte(uart, data);
 	}
 }
 
@@ -323,25 +953,48 @@ static inline bool
 Uart_hasAnyErrorOccured(Uart_ErrorFlags* const errFlags)
 {
 	return (errFlags->hasFramingErrorOccurred || errFlags->hasOverrunOccurred || errFlags->hasParityErrorOccurred
-            || errFlags->hasRxFifoFullErrorOccurred);
+            || errFlags->hasRxFifoFullErrorOccurred || errFlags->hasDmaErrorOccurred);
 }
 
 void
 Uart_handleInterrupt(Uart *const uart)
 {
 	int errorCode = 0;
-	Uart_ErrorFlags errorFlags = { false, false, false, false };
+	Uart_ErrorFlags errorFlags = { false, false, false, false, false };
 
-	uint32_t status = uart->reg->sr & uart->reg->imr;
+	const uint32_t sr = uart->reg->sr;
+	uint32_t status = sr & uart->reg->imr;
 	uart->reg->cr = UART_CR_RSTSTA_MASK;
-	if ((status & UART_SR_RXRDY_MASK) != 0u)
-	{
-		handleRxInterrupt(uart, &errorCode);
-		if(errorCode  == Uart_ErrorCodes_Rx_Fifo_Full)
-			errorFlags.hasRxFifoFullErrorOccurred = true;
+
+	UART_STATISTICS_ADD(uart, interrupts, 1u);
+	UART_STATISTICS_ADD(uart, overruns, (sr & UART_SR_OVRE_MASK) != 0u);
+	UART_STATISTICS_ADD(uart, framingErrors, (sr & UART_SR_FRAME_MASK) != 0u);
+	UART_STATISTICS_ADD(uart, parityErrors, (sr & UART_SR_PARE_MASK) != 0u);
+
+	// Service data which becomes ready while the handler runs, instead of taking another
+	// interrupt. Transmission keeps both the holding and the shift register busy.
+	bool hasReceived = false;
+	for (uint32_t round = 0; round < UART_INTERRUPT_BATCH_SIZE; ++round) {
+		const uint32_t roundSr = uart->reg->sr;
+		const uint32_t imr = uart->reg->imr;
+		const bool isRxReady =
+				((roundSr & imr & UART_SR_RXRDY_MASK) != 0u);
+		const bool isTxReady = ((imr & UART_IMR_TXEMPTY_MASK) != 0u)
+				&& ((roundSr & UART_SR_TXRDY_MASK) != 0u);
+		if (!isRxReady && !isTxReady)
+			break;
+
+		if (isRxReady) {
+			handleRxInterrupt(uart, &errorCode);
+			if(errorCode  == Uart_ErrorCodes_Rx_Fifo_Full)
+				errorFlags.hasRxFifoFullErrorOccurred = true;
+			hasReceived = true;
+		}
+		if (isTxReady)
+			handleTxInterrupt(uart);
 	}
-	if ((status & UART_SR_TXEMPTY_MASK) != 0u)
-		handleTxInterrupt(uart);
+	if (hasReceived)
+		handleRxLength(uart);
 
 	if (uart->errorHandler.callback == NULL)
 		return;
@@ -351,21 +1004,6 @@ Uart_handleInterrupt(Uart *const uart)
    		uart->errorHandler.callback(errorFlags, uart->errorHandler.arg);
 }
 
-inline bool
-Uart_isTxEmpty(const Uart *const uart)
-{
-	return ((uart->reg->sr & UART_SR_TXEMPTY_MASK) != 0u)
-			&& ((uart->reg->sr & UART_SR_TXRDY_MASK) != 0u);
-}
-
-inline bool
-Uart_isDataAvailable(const Uart *const uart)
-{
-	if ((uart->reg->sr & UART_SR_RXRDY_MASK) == 0u)
-		return false;
-	return true;
-}
-
 void
 Uart_getLinkErrors(uint32_t statusRegister, Uart_ErrorFlags *const errFlags)
 {
@@ -384,3 +1022,17 @@ Uart_getStatusRegister(const Uart *const uart)
 	uart->reg->cr = UART_CR_RSTSTA_MASK;
 	return status;
 }
+
+#if defined(UART_ENABLE_STATISTICS)
+void
+Uart_getStatistics(const Uart *const uart, Uart_Statistics *const statistics)
+{
+	*statistics = uart->statistics;
+}
+
+void
+Uart_resetStatistics(Uart *const uart)
+{
+	(void)memset(&uart->statistics, 0, sizeof(Uart_Statistics));
+}
+#endif
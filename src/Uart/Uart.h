@@ -33,8 +33,13 @@
 #define BSP_UART_H
 
 #include <Utils/ByteFifo.h>
+#include <Utils/SpscByteFifo.h>
 #include <Utils/Utils.h>
 
+#include <Dwt/Dwt.h>
+#include <Tic/Tic.h>
+#include <Xdmac/Xdmac.h>
+
 #include "UartRegisters.h"
 
 /// \brief Uart device identifiers.
@@ -90,6 +95,9 @@ typedef void (*UartRxEndLengthCallback)(void *arg);
 /// byte matches
 ///        a target specified in the handler descriptor.
 typedef void (*UartRxEndCharacterCallback)(void *arg);
+/// \brief A function serving as a callback called once the line stays idle after
+///        a reception, see ::Uart_setIdleDetectionConfig.
+typedef void (*UartRxIdleCallback)(void *arg);
 
 /// \brief A descriptor of a byte reception event handler.
 typedef struct {
@@ -108,6 +116,11 @@ typedef struct {
 	/// \brief Target length of reception queue, upon reaching of which
 	/// length callback is called.
 	uint32_t targetLength;
+	/// \brief Callback called when no byte was received for the idle detection
+	/// period after a reception.
+	UartRxIdleCallback idleCallback;
+	/// \brief Argument for the idle callback.
+	void *idleArg;
 } Uart_RxHandler;
 
 /// \brief Uart error flags.
@@ -116,6 +129,7 @@ typedef struct {
 	bool hasFramingErrorOccurred; // Framing error detected.
 	bool hasParityErrorOccurred; // Parity error detected.
 	bool hasRxFifoFullErrorOccurred; // Rx FIFO full error detected.
+	bool hasDmaErrorOccurred; // Xdmac transfer error detected in DMA mode.
 } Uart_ErrorFlags;
 
 /// \brief A function serving as a callback called upon detection of an error by
@@ -135,6 +149,36 @@ typedef enum
     Uart_ErrorCodes_Rx_Fifo_Full = 2, ///< Rx fifo was full during new byte reception
 } Uart_ErrorCodes;
 
+/// \brief Uart DMA mode configuration descriptor.
+typedef struct {
+	Xdmac *xdmac; ///< Xdmac device performing the transfers.
+	uint8_t txChannel; ///< Xdmac channel used for transmission.
+	uint8_t rxChannel; ///< Xdmac channel used for reception.
+} Uart_DmaConfig;
+
+/// \brief Uart idle line detection configuration descriptor.
+typedef struct {
+	Tic *tic; ///< Timer instance sampling reception progress.
+	Tic_Channel channel; ///< Timer channel sampling reception progress.
+	Tic_ClockSelection clockSource; ///< Timer channel clock source.
+	uint32_t period; ///< Sampling period, in timer clock ticks.
+} Uart_IdleDetectionConfig;
+
+#if defined(UART_ENABLE_STATISTICS)
+/// \brief Uart throughput and error statistics, available when UART_ENABLE_STATISTICS is
+///        defined.
+typedef struct {
+	uint32_t txBytes; ///< Number of transmitted bytes.
+	uint32_t rxBytes; ///< Number of received bytes.
+	uint32_t interrupts; ///< Number of serviced Uart interrupts.
+	uint32_t rxFifoFullDrops; ///< Number of bytes dropped due to reception queue full.
+	uint32_t overruns; ///< Number of detected hardware overruns.
+	uint32_t framingErrors; ///< Number of detected framing errors.
+	uint32_t parityErrors; ///< Number of detected parity errors.
+	uint32_t rxFifoHighWaterMark; ///< Highest observed reception queue occupancy.
+} Uart_Statistics;
+#endif
+
 /// \brief Uart device descriptor.
 typedef struct {
 	Uart_Id id; ///< Device identifier.
@@ -143,9 +187,24 @@ typedef struct {
 	Uart_ErrorHandler errorHandler; ///< Error handler descriptor.
 	ByteFifo *txFifo; ///< Pointer to a transmission byte queue.
 	ByteFifo *rxFifo; ///< Pointer to a reception byte queue.
+	SpscByteFifo *txSpscFifo; ///< Pointer to a lock-free transmission byte queue.
+	SpscByteFifo *rxSpscFifo; ///< Pointer to a lock-free reception byte queue.
 	volatile Uart_Registers
 			*reg; ///< Pointer to memory-mapped device registers.
 	Uart_Config config; ///< Configuration descriptor.
+	Uart_DmaConfig dmaConfig; ///< DMA mode configuration descriptor.
+	bool isTxDmaEnabled; ///< Flag indicating whether transmission is DMA driven.
+	bool isRxDmaEnabled; ///< Flag indicating whether reception is DMA driven.
+	uint32_t txDmaLength; ///< Length of the DMA transmission in progress.
+	uint32_t rxDmaLength; ///< Length of the DMA reception in progress.
+	uint32_t rxDmaCommitted; ///< Bytes of the DMA reception in progress already queued.
+	uint32_t rxByteCount; ///< Total number of received bytes placed in reception queues.
+	Uart_IdleDetectionConfig idleConfig; ///< Idle line detection configuration descriptor.
+	uint32_t idleRxByteCount; ///< Reception progress observed at the last idle timer period.
+	bool isRxFramePending; ///< Flag indicating reception since the last idle notification.
+#if defined(UART_ENABLE_STATISTICS)
+	Uart_Statistics statistics; ///< Throughput and error statistics.
+#endif
 } Uart;
 
 /// \brief Performs a hardware startup procedure of an Uart device.
@@ -171,11 +230,21 @@ void Uart_setConfig(Uart *const uart, const Uart_Config *const config);
 /// \param [out] config A configuration descriptor.
 void Uart_getConfig(const Uart *const uart, Uart_Config *const config);
 
+/// \brief Updates the baud rate clock frequency and recomputes the baud rate divider,
+///        e.g. from a ::Pmc_changeMasterck listener.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] frequency New baud rate clock source frequency.
+void Uart_setBaudRateClkFreq(Uart *const uart, const uint32_t frequency);
+
 /// \brief Checks whenever RX has pending data.
 /// \param [in] uart Uart device descriptor.
 /// \retval true Data is available for reading.
 /// \retval false Data is not available for reading.
-bool Uart_isDataAvailable(const Uart *const uart);
+static inline bool
+Uart_isDataAvailable(const Uart *const uart)
+{
+	return (uart->reg->sr & UART_SR_RXRDY_MASK) != 0u;
+}
 
 /// \brief Synchronously sends a byte over Uart.
 /// \param [in] uart Uart device descriptor.
@@ -197,6 +266,27 @@ bool Uart_write(Uart *const uart, const uint8_t data, uint32_t timeoutLimit,
 bool Uart_read(Uart *const uart, uint8_t *const data, uint32_t timeoutLimit,
 		int *const errCode);
 
+/// \brief Synchronously sends a byte over Uart, waiting for the transmitter until a deadline.
+/// \details A single deadline can bound a whole sequence of calls, e.g. a complete message.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] data Byte to send.
+/// \param [in] deadline Deadline, started with ::Dwt_startDeadline.
+/// \param [out] errCode An error code generated during the operation.
+/// \retval true Sending was successful.
+/// \retval false Sending timed out.
+bool Uart_writeWithDeadline(Uart *const uart, const uint8_t data,
+		const Dwt_Deadline *const deadline, int *const errCode);
+
+/// \brief Synchronously receives a byte over Uart, waiting for data until a deadline.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] data Received byte pointer.
+/// \param [in] deadline Deadline, started with ::Dwt_startDeadline.
+/// \param [out] errCode An error code generated during the operation.
+/// \retval true Reception was successful.
+/// \retval false Reception timed out.
+bool Uart_readWithDeadline(Uart *const uart, uint8_t *const data,
+		const Dwt_Deadline *const deadline, int *const errCode);
+
 /// \brief Asynchronously sends a series of bytes over Uart.
 /// \param [in] uart Uart device descriptor.
 /// \param [in] fifo Pointer to the output byte queue.
@@ -211,11 +301,84 @@ void Uart_writeAsync(Uart *const uart, ByteFifo *const fifo,
 void Uart_readAsync(Uart *const uart, ByteFifo *const fifo,
 		const Uart_RxHandler handler);
 
+/// \brief Asynchronously sends bytes over Uart from a lock-free queue.
+/// \details The queue can be filled by the caller at any time, without masking interrupts.
+///          After pushing new data the function shall be called again to resume transmission,
+///          if the queue was drained in the meantime. The end-of-transmission handler is not
+///          used in this mode.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] fifo Pointer to the output lock-free byte queue.
+void Uart_writeAsyncSpsc(Uart *const uart, SpscByteFifo *const fifo);
+
+/// \brief Asynchronously receives a series of bytes over Uart into a lock-free queue.
+/// \details The queue can be drained by the caller (e.g. using ::Uart_readRxFifo) at any time,
+///          without masking interrupts.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] fifo Pointer to the input lock-free byte queue.
+/// \param [in] handler Descriptor of the reception handler.
+void Uart_readAsyncSpsc(Uart *const uart, SpscByteFifo *const fifo,
+		const Uart_RxHandler handler);
+
+/// \brief Configures Xdmac channels used by the DMA driven transfer mode.
+/// \details Both channels are configured for byte transfers synchronized with the Uart and
+///          their handlers are registered, the Xdmac interrupt shall be routed to
+///          ::Xdmac_handleInterrupt. Transfers shall not be in progress.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] config DMA mode configuration descriptor.
+void Uart_setDmaConfig(Uart *const uart, const Uart_DmaConfig *const config);
+
+/// \brief Asynchronously sends a series of bytes over Uart using DMA.
+/// \details Contiguous parts of the queue are transferred by DMA, so no interrupt is taken per
+///          byte. The end-of-transmission handler is called once the queue is drained, as in
+///          ::Uart_writeAsync. Requires prior call to ::Uart_setDmaConfig.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] fifo Pointer to the output byte queue.
+/// \param [in] handler Descriptor of the transmission handler.
+void Uart_writeAsyncDma(Uart *const uart, ByteFifo *const fifo,
+		const Uart_TxHandler handler);
+
+/// \brief Asynchronously receives a series of bytes over Uart using DMA.
+/// \details Bytes are written by DMA directly into the free space of the queue. The reception
+///          handler is serviced on DMA block completion: blocks are shortened so that
+///          the length callback is called once the queue reaches the target length, while
+///          the character callback is matched against bytes of each completed block.
+///          Bytes already collected with ::Uart_readRxFifo are not matched.
+///          With the data cache enabled, the queue memory block should be aligned to cache
+///          lines, see ::Xdmac_invalidateDCache.
+///          Requires prior call to ::Uart_setDmaConfig.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] fifo Pointer to the input byte queue.
+/// \param [in] handler Descriptor of the reception handler.
+void Uart_readAsyncDma(Uart *const uart, ByteFifo *const fifo,
+		const Uart_RxHandler handler);
+
+/// \brief Configures idle line detection, reported by the idle callback of the reception
+///        handler.
+/// \details The Uart has no hardware receiver timeout, so the timer channel is run periodically
+///          and reception progress is sampled on each period. The idle callback is called once
+///          per frame, after between one and two periods without reception, in all reception
+///          modes. The timer channel interrupt shall be routed to
+///          ::Uart_handleIdleTimerInterrupt.
+/// \param [in] uart Uart device descriptor.
+/// \param [in] config Idle detection configuration descriptor.
+void Uart_setIdleDetectionConfig(
+		Uart *const uart, const Uart_IdleDetectionConfig *const config);
+
+/// \brief Interrupt handler of the idle detection timer channel.
+/// \param [in] uart Uart device descriptor.
+void Uart_handleIdleTimerInterrupt(Uart *const uart);
+
 /// \brief Checks if all bytes were sent.
 /// \param [in] uart Uart device descriptor.
 /// \retval true Tx queue is empty.
 /// \retval false Tx is busy.
-bool Uart_isTxEmpty(const Uart *const uart);
+static inline bool
+Uart_isTxEmpty(const Uart *const uart)
+{
+	const uint32_t sr = uart->reg->sr;
+	return ((sr & UART_SR_TXEMPTY_MASK) != 0u)
+			&& ((sr & UART_SR_TXRDY_MASK) != 0u);
+}
 
 /// \brief Pulls bytes stored in the reception queue.
 /// \param [in] uart Uart device descriptor.
@@ -254,6 +417,19 @@ void Uart_getLinkErrors(
 /// value.
 uint32_t Uart_getStatusRegister(const Uart *const uart);
 
+#if defined(UART_ENABLE_STATISTICS)
+/// \brief Retrieves throughput and error statistics of an Uart device.
+/// \details Error counters are updated by ::Uart_handleInterrupt, occupancy high-water mark
+///          is sampled once per interrupt batch or DMA block.
+/// \param [in] uart Uart device descriptor.
+/// \param [out] statistics Statistics descriptor.
+void Uart_getStatistics(const Uart *const uart, Uart_Statistics *const statistics);
+
+/// \brief Resets throughput and error statistics of an Uart device.
+/// \param [in] uart Uart device descriptor.
+void Uart_resetStatistics(Uart *const uart);
+#endif
+
 #endif // BSP_UART_H
 
 /** @} */
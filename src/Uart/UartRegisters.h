@@ -45,11 +45,22 @@ typedef struct {
 	volatile uint32_t reserved4[5]; ///< 0xEC - 0xFC Reserved
 } Uart_Registers;
 
+#if defined(BSP_HOST_REGISTERS)
+/// \brief In-memory UART register models, see HostRegisters/HostRegisters.h.
+extern Uart_Registers HostRegisters_uart[5];
+
+#define UART0_ADDRESS_BASE ((uintptr_t)&HostRegisters_uart[0])
+#define UART1_ADDRESS_BASE ((uintptr_t)&HostRegisters_uart[1])
+#define UART2_ADDRESS_BASE ((uintptr_t)&HostRegisters_uart[2])
+#define UART3_ADDRESS_BASE ((uintptr_t)&HostRegisters_uart[3])
+#define UART4_ADDRESS_BASE ((uintptr_t)&HostRegisters_uart[4])
+#else
 #define UART0_ADDRESS_BASE 0x400E0800u
 #define UART1_ADDRESS_BASE 0x400E0A00u
 #define UART2_ADDRESS_BASE 0x400E1A00u
 #define UART3_ADDRESS_BASE 0x400E1C00u
 #define UART4_ADDRESS_BASE 0x400E1E00u
+#endif
 
 #define UART_CR_RSTRX_MASK 0x00000004u
 #define UART_CR_RSTRX_OFFSET 2u
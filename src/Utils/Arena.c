@@ -0,0 +1,65 @@
+/**@file
+ * This file is part of the N7-Core library used in the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Arena.h"
+
+#include <assert.h>
+
+void
+Arena_init(Arena *const arena, void *const memory, const size_t size)
+{
+	assert(memory != NULL);
+
+	arena->begin = (uint8_t *)memory;
+	arena->end = arena->begin + size;
+	arena->current = arena->begin;
+}
+
+void *
+Arena_allocate(Arena *const arena, const size_t size, const size_t alignment)
+{
+	assert(alignment > 0u);
+	assert((alignment & (alignment - 1u)) == 0u);
+
+	// cppcheck-suppress misra-c2012-11.4
+	const uintptr_t current = (uintptr_t)arena->current;
+	const size_t padding = (size_t)((alignment - (current & (alignment - 1u)))
+			& (alignment - 1u));
+	const size_t freeSize = Arena_getFreeSize(arena);
+
+	if ((padding > freeSize) || (size > (freeSize - padding)))
+		return NULL;
+
+	uint8_t *const block = arena->current + padding;
+	arena->current = block + size;
+	return block;
+}
+
+void
+Arena_rewind(Arena *const arena, const Arena_Marker marker)
+{
+	assert(marker >= arena->begin);
+	assert(marker <= arena->current);
+
+	arena->current = marker;
+}
@@ -0,0 +1,118 @@
+/**@file
+ * This file is part of the N7-Core library used in the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file Arena.h
+/// \addtogroup Utils
+/// \brief Module representing bump allocator over a caller-provided memory region.
+/// \details Allocations are taken from the region in order and released all at once, with
+///          ::Arena_reset or ::Arena_rewind. The region may be placed in any memory, e.g.
+///          SDRAM after ::Sdramc_performInitializationSequence. The arena is not thread-safe.
+
+#ifndef UTILS_ARENA_H
+#define UTILS_ARENA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/// @addtogroup Arena
+/// @ingroup Utils
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Default allocation alignment, suitable for any standard type.
+#define ARENA_DEFAULT_ALIGNMENT 8u
+
+/// \brief Structure representing single arena instance.
+typedef struct {
+	uint8_t *begin; ///< Pointer to beginning of memory region.
+	uint8_t *end; ///< Pointer to end of memory region.
+	uint8_t *current; ///< Pointer to beginning of free space.
+} Arena;
+
+/// \brief Saved arena allocation state, see ::Arena_getMarker.
+typedef uint8_t *Arena_Marker;
+
+/// \brief Arena initialisation procedure, assigns all fields properly.
+/// \param [out] arena pointer to Arena to initialise.
+/// \param [in] memory memory region to allocate from.
+/// \param [in] size size of the memory region in bytes.
+void Arena_init(Arena *const arena, void *const memory, const size_t size);
+
+/// \brief Allocates a block from the arena.
+/// \param [in,out] arena arena to allocate from.
+/// \param [in] size size of the block in bytes.
+/// \param [in] alignment alignment of the block, must be a power of two.
+/// \returns Pointer to the allocated block, or NULL if there is not enough free space.
+void *Arena_allocate(Arena *const arena, const size_t size,
+		const size_t alignment);
+
+/// \brief Releases all blocks allocated from the arena.
+/// \param [in,out] arena arena to reset.
+static inline void
+Arena_reset(Arena *const arena)
+{
+	arena->current = arena->begin;
+}
+
+/// \brief Returns the current allocation state, to be restored with ::Arena_rewind.
+/// \param [in] arena arena to query.
+/// \returns Allocation marker.
+static inline Arena_Marker
+Arena_getMarker(const Arena *const arena)
+{
+	return arena->current;
+}
+
+/// \brief Releases all blocks allocated after the marker was taken.
+/// \param [in,out] arena arena to rewind.
+/// \param [in] marker marker returned by ::Arena_getMarker for this arena.
+void Arena_rewind(Arena *const arena, const Arena_Marker marker);
+
+/// \brief Returns the number of bytes allocated from the arena, including alignment padding.
+/// \param [in] arena arena to query.
+/// \returns Number of allocated bytes.
+static inline size_t
+Arena_getUsedSize(const Arena *const arena)
+{
+	return (size_t)(arena->current - arena->begin);
+}
+
+/// \brief Returns the number of free bytes left in the arena.
+/// \param [in] arena arena to query.
+/// \returns Number of free bytes.
+static inline size_t
+Arena_getFreeSize(const Arena *const arena)
+{
+	return (size_t)(arena->end - arena->current);
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // UTILS_ARENA_H
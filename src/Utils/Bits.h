@@ -23,7 +23,7 @@
 
 /// \file Bits.h
 /// \addtogroup Utils
-/// \brief Auxiliary header for basic bit operations on registers.
+/// \brief Auxiliary header for basic bit operations on registers, bit scanning and atomic flags.
 
 #ifndef UTILS_BITS_H
 #define UTILS_BITS_H
@@ -108,6 +108,20 @@
 #define IS_BIT_SET(bitFieldName, registerValue) \
 	isBitSet((uint32_t)(registerValue), BIT_FIELD_OFFSET(bitFieldName))
 
+/// \brief Iterates over indices of set bits of a 32-bit value, from the least significant one.
+/// \details The value is evaluated once, before the first iteration.
+/// \param [in] bitIndex Name of the `uint32_t` loop variable holding the current bit index.
+/// \param [in] value Value whose set bits are visited.
+// clang-format off
+// cppcheck-suppress [misra-c2012-20.7, misra-c2012-20.10]
+#define FOR_EACH_SET_BIT(bitIndex, value)                                       \
+	for (uint32_t bitIndex##Remaining = (uint32_t)(value),                  \
+		      bitIndex = countTrailingZeros(bitIndex##Remaining);       \
+			bitIndex##Remaining != 0u;                              \
+			bitIndex##Remaining &= bitIndex##Remaining - 1u,        \
+		      bitIndex = countTrailingZeros(bitIndex##Remaining))
+// clang-format on
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -214,6 +228,99 @@ isBitSet(const uint32_t value, const uint32_t offset)
 	return isFieldSet(value, UINT32_C(1) << offset);
 }
 
+/// \brief Counts leading zero bits, using the CLZ instruction where available.
+/// \param [in] value Value to examine.
+/// \returns Number of zero bits above the most significant set bit, 32 for zero.
+static inline uint32_t
+countLeadingZeros(const uint32_t value)
+{
+#if defined(__ARM_FEATURE_CLZ)
+	uint32_t result;
+	asm("clz %0, %1" : "=r"(result) : "r"(value));
+	return result;
+#else
+	return (value == 0u) ? 32u : (uint32_t)__builtin_clz(value);
+#endif
+}
+
+/// \brief Reverses the bit order of a value, using the RBIT instruction where available.
+/// \param [in] value Value to reverse.
+/// \returns Value with bit 0 swapped with bit 31, bit 1 with bit 30 etc.
+static inline uint32_t
+reverseBits(const uint32_t value)
+{
+#if defined(__ARM_ARCH_ISA_THUMB) && (__ARM_ARCH_ISA_THUMB >= 2)
+	uint32_t result;
+	asm("rbit %0, %1" : "=r"(result) : "r"(value));
+	return result;
+#else
+	uint32_t result = value;
+	result = ((result >> 1u) & 0x55555555u) | ((result & 0x55555555u) << 1u);
+	result = ((result >> 2u) & 0x33333333u) | ((result & 0x33333333u) << 2u);
+	result = ((result >> 4u) & 0x0F0F0F0Fu) | ((result & 0x0F0F0F0Fu) << 4u);
+	result = ((result >> 8u) & 0x00FF00FFu) | ((result & 0x00FF00FFu) << 8u);
+	return (result >> 16u) | (result << 16u);
+#endif
+}
+
+/// \brief Counts trailing zero bits, i.e. returns the index of the least significant set bit.
+/// \param [in] value Value to examine.
+/// \returns Number of zero bits below the least significant set bit, 32 for zero.
+static inline uint32_t
+countTrailingZeros(const uint32_t value)
+{
+#if defined(__ARM_FEATURE_CLZ) && defined(__ARM_ARCH_ISA_THUMB) \
+		&& (__ARM_ARCH_ISA_THUMB >= 2)
+	return countLeadingZeros(reverseBits(value));
+#else
+	return (value == 0u) ? 32u : (uint32_t)__builtin_ctz(value);
+#endif
+}
+
+/// \brief Counts set bits of a value.
+/// \details ARMv7E-M has no population count instruction, the compiler expands it to a
+///          constant-time bit-parallel sequence.
+/// \param [in] value Value to examine.
+/// \returns Number of set bits.
+static inline uint32_t
+countSetBits(const uint32_t value)
+{
+	return (uint32_t)__builtin_popcount(value);
+}
+
+/// \brief Atomically sets the masked bits of a flags word in normal memory.
+/// \details Uses an exclusive load/store loop (LDREX/STREX), so it can be used from thread
+///          and interrupt context without disabling interrupts. Not intended for peripheral
+///          registers, which do not support exclusive accesses.
+/// \param [in,out] flags Pointer to the flags word.
+/// \param [in] mask Mask of bits to set.
+static inline void
+atomicSetBits(volatile uint32_t *const flags, const uint32_t mask)
+{
+	(void)__atomic_fetch_or(flags, mask, __ATOMIC_SEQ_CST);
+}
+
+/// \brief Atomically clears the masked bits of a flags word in normal memory.
+/// \details See ::atomicSetBits.
+/// \param [in,out] flags Pointer to the flags word.
+/// \param [in] mask Mask of bits to clear.
+static inline void
+atomicClearBits(volatile uint32_t *const flags, const uint32_t mask)
+{
+	(void)__atomic_fetch_and(flags, ~mask, __ATOMIC_SEQ_CST);
+}
+
+/// \brief Atomically reads and clears the masked bits of a flags word in normal memory.
+/// \details See ::atomicSetBits.
+/// \param [in,out] flags Pointer to the flags word.
+/// \param [in] mask Mask of bits to take.
+/// \returns Masked bits set before the call.
+static inline uint32_t
+atomicTakeBits(volatile uint32_t *const flags, const uint32_t mask)
+{
+	return __atomic_fetch_and(flags, ~mask, __ATOMIC_SEQ_CST) & mask;
+}
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
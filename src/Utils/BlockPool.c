@@ -0,0 +1,99 @@
+/**@file
+ * This file is part of the N7-Core library used in the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "BlockPool.h"
+
+#include <assert.h>
+
+size_t
+BlockPool_init(BlockPool *const pool, void *const memory, const size_t size,
+		const size_t blockSize)
+{
+	assert(memory != NULL);
+	// cppcheck-suppress misra-c2012-11.4
+	assert(((uintptr_t)memory & (BLOCK_POOL_ALIGNMENT - 1u)) == 0u);
+
+	pool->blockSize = BlockPool_getAlignedBlockSize(blockSize);
+	pool->blockCount = size / pool->blockSize;
+	pool->freeCount = pool->blockCount;
+	pool->begin = (uint8_t *)memory;
+	pool->end = pool->begin + (pool->blockCount * pool->blockSize);
+	pool->freeList = NULL;
+
+	// Link the blocks from the end, so that they are handed out in address order.
+	for (size_t i = pool->blockCount; i > 0u; i--) {
+		BlockPool_FreeBlock *const block =
+				// cppcheck-suppress misra-c2012-11.3
+				(BlockPool_FreeBlock *)(pool->begin
+						+ ((i - 1u) * pool->blockSize));
+		block->next = pool->freeList;
+		pool->freeList = block;
+	}
+
+	return pool->blockCount;
+}
+
+bool
+BlockPool_initFromArena(BlockPool *const pool, Arena *const arena,
+		const size_t blockSize, const size_t blockCount)
+{
+	const size_t alignedBlockSize = BlockPool_getAlignedBlockSize(blockSize);
+	if ((blockCount != 0u) && (alignedBlockSize > (SIZE_MAX / blockCount)))
+		return false;
+
+	const size_t size = alignedBlockSize * blockCount;
+	void *const memory = Arena_allocate(arena, size, BLOCK_POOL_ALIGNMENT);
+	if (memory == NULL)
+		return false;
+
+	(void)BlockPool_init(pool, memory, size, blockSize);
+	return true;
+}
+
+void *
+BlockPool_allocate(BlockPool *const pool)
+{
+	BlockPool_FreeBlock *const block = pool->freeList;
+	if (block == NULL)
+		return NULL;
+
+	pool->freeList = block->next;
+	pool->freeCount--;
+	return block;
+}
+
+void
+BlockPool_free(BlockPool *const pool, void *const block)
+{
+	uint8_t *const address = (uint8_t *)block;
+	assert(address >= pool->begin);
+	assert(address < pool->end);
+	assert(((size_t)(address - pool->begin) % pool->blockSize) == 0u);
+	assert(pool->freeCount < pool->blockCount);
+
+	// cppcheck-suppress misra-c2012-11.5
+	BlockPool_FreeBlock *const freeBlock = (BlockPool_FreeBlock *)block;
+	freeBlock->next = pool->freeList;
+	pool->freeList = freeBlock;
+	pool->freeCount++;
+}
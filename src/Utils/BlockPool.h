@@ -0,0 +1,124 @@
+/**@file
+ * This file is part of the N7-Core library used in the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file BlockPool.h
+/// \addtogroup Utils
+/// \brief Module representing pool of fixed-size memory blocks.
+/// \details Free blocks are kept on a list threaded through the blocks themselves, so
+///          allocation and release take constant time and need no additional memory.
+///          The pool memory can be carved out of an ::Arena, e.g. one placed in SDRAM.
+///          The pool is not thread-safe.
+
+#ifndef UTILS_BLOCKPOOL_H
+#define UTILS_BLOCKPOOL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Arena.h"
+
+/// @addtogroup BlockPool
+/// @ingroup Utils
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Alignment of pool blocks; block sizes are rounded up to its multiple.
+#define BLOCK_POOL_ALIGNMENT ARENA_DEFAULT_ALIGNMENT
+
+/// \brief Header of a free block, linking it to the next free block.
+typedef struct BlockPool_FreeBlock {
+	struct BlockPool_FreeBlock *next; ///< Next free block, NULL for the last one.
+} BlockPool_FreeBlock;
+
+/// \brief Structure representing single pool instance.
+typedef struct {
+	uint8_t *begin; ///< Pointer to the first block.
+	uint8_t *end; ///< Pointer past the last block.
+	BlockPool_FreeBlock *freeList; ///< List of free blocks.
+	size_t blockSize; ///< Size of a single block, after rounding.
+	size_t blockCount; ///< Total number of blocks.
+	size_t freeCount; ///< Number of free blocks.
+} BlockPool;
+
+/// \brief Returns the block size used by a pool for the requested size.
+/// \param [in] blockSize requested block size.
+/// \returns Block size rounded up to ::BLOCK_POOL_ALIGNMENT and the free block header size.
+static inline size_t
+BlockPool_getAlignedBlockSize(const size_t blockSize)
+{
+	const size_t size = (blockSize < sizeof(BlockPool_FreeBlock))
+			? sizeof(BlockPool_FreeBlock)
+			: blockSize;
+	return (size + BLOCK_POOL_ALIGNMENT - 1u)
+			& ~(size_t)(BLOCK_POOL_ALIGNMENT - 1u);
+}
+
+/// \brief BlockPool initialisation procedure, splits the memory region into free blocks.
+/// \param [out] pool pointer to BlockPool to initialise.
+/// \param [in] memory memory region for the blocks, aligned to ::BLOCK_POOL_ALIGNMENT.
+/// \param [in] size size of the memory region in bytes.
+/// \param [in] blockSize size of a single block in bytes.
+/// \returns Number of blocks in the pool.
+size_t BlockPool_init(BlockPool *const pool, void *const memory,
+		const size_t size, const size_t blockSize);
+
+/// \brief Initialises a BlockPool in memory allocated from an arena.
+/// \param [out] pool pointer to BlockPool to initialise.
+/// \param [in,out] arena arena to allocate the pool memory from.
+/// \param [in] blockSize size of a single block in bytes.
+/// \param [in] blockCount number of blocks in the pool.
+/// \retval true pool was initialised.
+/// \retval false arena has not enough free space, it is left unchanged.
+bool BlockPool_initFromArena(BlockPool *const pool, Arena *const arena,
+		const size_t blockSize, const size_t blockCount);
+
+/// \brief Allocates a block from the pool.
+/// \param [in,out] pool pool to allocate from.
+/// \returns Pointer to the allocated block, or NULL if the pool is exhausted.
+void *BlockPool_allocate(BlockPool *const pool);
+
+/// \brief Returns a block to the pool.
+/// \param [in,out] pool pool the block was allocated from.
+/// \param [in] block block returned by ::BlockPool_allocate.
+void BlockPool_free(BlockPool *const pool, void *const block);
+
+/// \brief Returns the number of free blocks in the pool.
+/// \param [in] pool pool to query.
+/// \returns Number of free blocks.
+static inline size_t
+BlockPool_getFreeCount(const BlockPool *const pool)
+{
+	return pool->freeCount;
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // UTILS_BLOCKPOOL_H
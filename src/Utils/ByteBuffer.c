@@ -23,6 +23,10 @@
 
 #include "ByteBuffer.h"
 
+#include <string.h>
+
+#include "Memory.h"
+
 void
 ByteBuffer_init(ByteBuffer *buffer, uint8_t *const memoryBlock,
 		const size_t memoryBlockSize)
@@ -36,8 +40,7 @@ ByteBuffer_init(ByteBuffer *buffer, uint8_t *const memoryBlock,
 void
 ByteBuffer_memset(ByteBuffer *buffer, const uint8_t value)
 {
-	for (uint8_t *it = buffer->begin; it != buffer->capacityEnd; ++it)
-		*it = value; // cppcheck-suppress [misra-c2012-14.2]
+	Memory_fill(buffer->begin, value, ByteBuffer_getCapacity(buffer));
 }
 
 bool
@@ -49,3 +52,75 @@ ByteBuffer_append(ByteBuffer *const buffer, const uint8_t value)
 	++buffer->end;
 	return true;
 }
+
+uint8_t *
+ByteBuffer_reserve(ByteBuffer *const buffer, const size_t size)
+{
+	// cppcheck-suppress [misra-c2012-18.4]
+	if ((size_t)(buffer->capacityEnd - buffer->end) < size)
+		return NULL;
+	uint8_t *const reserved = buffer->end;
+	// cppcheck-suppress [misra-c2012-18.4]
+	buffer->end += size;
+	return reserved;
+}
+
+bool
+ByteBuffer_appendBytes(ByteBuffer *const buffer, const uint8_t *const data,
+		const size_t size)
+{
+	uint8_t *const target = ByteBuffer_reserve(buffer, size);
+	if (target == NULL)
+		return false;
+	(void)memcpy(target, data, size);
+	return true;
+}
+
+bool
+ByteBuffer_appendFill(ByteBuffer *const buffer, const uint8_t value,
+		const size_t count)
+{
+	uint8_t *const target = ByteBuffer_reserve(buffer, count);
+	if (target == NULL)
+		return false;
+	(void)memset(target, value, count);
+	return true;
+}
+
+bool
+ByteBuffer_appendU16(ByteBuffer *const buffer, const uint16_t value,
+		const ByteBuffer_Endianness endianness)
+{
+	uint8_t *const target = ByteBuffer_reserve(buffer, sizeof(uint16_t));
+	if (target == NULL)
+		return false;
+	if (endianness == ByteBuffer_Endianness_Big) {
+		target[0] = (uint8_t)(value >> 8u);
+		target[1] = (uint8_t)value;
+	} else {
+		target[0] = (uint8_t)value;
+		target[1] = (uint8_t)(value >> 8u);
+	}
+	return true;
+}
+
+bool
+ByteBuffer_appendU32(ByteBuffer *const buffer, const uint32_t value,
+		const ByteBuffer_Endianness endianness)
+{
+	uint8_t *const target = ByteBuffer_reserve(buffer, sizeof(uint32_t));
+	if (target == NULL)
+		return false;
+	if (endianness == ByteBuffer_Endianness_Big) {
+		target[0] = (uint8_t)(value >> 24u);
+		target[1] = (uint8_t)(value >> 16u);
+		target[2] = (uint8_t)(value >> 8u);
+		target[3] = (uint8_t)value;
+	} else {
+		target[0] = (uint8_t)value;
+		target[1] = (uint8_t)(value >> 8u);
+		target[2] = (uint8_t)(value >> 16u);
+		target[3] = (uint8_t)(value >> 24u);
+	}
+	return true;
+}
@@ -40,6 +40,12 @@ extern "C" {
 /// @ingroup Utils
 /// @{
 
+/// \brief Byte order used when appending multi-byte values.
+typedef enum {
+	ByteBuffer_Endianness_Little = 0, ///< Least significant byte first.
+	ByteBuffer_Endianness_Big = 1, ///< Most significant byte first.
+} ByteBuffer_Endianness;
+
 /// \brief Structure representing single buffer instance.
 typedef struct {
 	uint8_t *begin; ///< Pointer to beginning of data stored in buffer.
@@ -94,6 +100,50 @@ void ByteBuffer_memset(ByteBuffer *const buffer, const uint8_t value);
 /// \retval false if buffer is full
 bool ByteBuffer_append(ByteBuffer *const buffer, const uint8_t value);
 
+/// \brief Reserves space for given number of bytes at the end of ByteBuffer.
+///        Reserved bytes are counted as buffer elements, their contents are left unchanged
+///        and are expected to be written by the caller through the returned pointer.
+/// \param [in,out] buffer pointer to target ByteBuffer.
+/// \param [in] size number of bytes to reserve.
+/// \returns pointer to first reserved byte, or NULL if there is not enough free space.
+uint8_t *ByteBuffer_reserve(ByteBuffer *const buffer, const size_t size);
+
+/// \brief Appends given bytes to ByteBuffer, if all of them fit, fails otherwise.
+/// \param [in,out] buffer pointer to target ByteBuffer.
+/// \param [in] data pointer to bytes to append.
+/// \param [in] size number of bytes to append.
+/// \retval true if bytes were appended
+/// \retval false if there is not enough free space, buffer is left unchanged
+bool ByteBuffer_appendBytes(ByteBuffer *const buffer, const uint8_t *const data,
+		const size_t size);
+
+/// \brief Appends given number of copies of a value to ByteBuffer, if they fit, fails otherwise.
+/// \param [in,out] buffer pointer to target ByteBuffer.
+/// \param [in] value value to append.
+/// \param [in] count number of copies to append.
+/// \retval true if values were appended
+/// \retval false if there is not enough free space, buffer is left unchanged
+bool ByteBuffer_appendFill(ByteBuffer *const buffer, const uint8_t value,
+		const size_t count);
+
+/// \brief Appends 16-bit value to ByteBuffer using given byte order, fails if it does not fit.
+/// \param [in,out] buffer pointer to target ByteBuffer.
+/// \param [in] value value to append.
+/// \param [in] endianness byte order of appended value.
+/// \retval true if value was appended
+/// \retval false if there is not enough free space, buffer is left unchanged
+bool ByteBuffer_appendU16(ByteBuffer *const buffer, const uint16_t value,
+		const ByteBuffer_Endianness endianness);
+
+/// \brief Appends 32-bit value to ByteBuffer using given byte order, fails if it does not fit.
+/// \param [in,out] buffer pointer to target ByteBuffer.
+/// \param [in] value value to append.
+/// \param [in] endianness byte order of appended value.
+/// \retval true if value was appended
+/// \retval false if there is not enough free space, buffer is left unchanged
+bool ByteBuffer_appendU32(ByteBuffer *const buffer, const uint32_t value,
+		const ByteBuffer_Endianness endianness);
+
 /// \brief Returns capacity of provided ByteBuffer.
 ///        Capacity is represented as maximum elements' count that could be stored in given buffer.
 /// \param [in] buffer pointer to ByteBuffer.
@@ -24,6 +24,7 @@
 #include "ByteFifo.h"
 
 #include <assert.h>
+#include <string.h>
 
 void
 ByteFifo_init(ByteFifo *const fifo, uint8_t *const memoryBlock,
@@ -51,21 +52,6 @@ ByteFifo_initFromBytes(ByteFifo *const fifo, uint8_t *const memoryBlock,
 	fifo->last = memoryBlock;
 }
 
-size_t
-ByteFifo_getCount(const ByteFifo *const fifo)
-{
-	if (ByteFifo_isEmpty(fifo))
-		return 0;
-
-	// cppcheck-suppress [misra-c2012-18.4]
-	ptrdiff_t ptrDifference = fifo->last - fifo->first;
-	if (ptrDifference <= 0)
-		// cppcheck-suppress [misra-c2012-18.4]
-		ptrDifference += fifo->end - fifo->begin;
-
-	return (size_t)ptrDifference;
-}
-
 bool
 ByteFifo_push(ByteFifo *const fifo, const uint8_t data)
 {
@@ -99,3 +85,111 @@ ByteFifo_pull(ByteFifo *const fifo, uint8_t *const data)
 		fifo->first = NULL;
 	return true;
 }
+
+size_t
+ByteFifo_getWritableSpan(const ByteFifo *const fifo, uint8_t **const span)
+{
+	*span = fifo->last;
+
+	// cppcheck-suppress [misra-c2012-18.4]
+	ptrdiff_t spanSize = fifo->end - fifo->last;
+	if ((fifo->first != NULL) && (fifo->first >= fifo->last))
+		// cppcheck-suppress [misra-c2012-18.4]
+		spanSize = fifo->first - fifo->last;
+
+	return (size_t)spanSize;
+}
+
+void
+ByteFifo_commitWrite(ByteFifo *const fifo, const size_t count)
+{
+	if (count == 0u)
+		return;
+
+	if (fifo->first == NULL)
+		fifo->first = fifo->last;
+	// cppcheck-suppress [misra-c2012-18.4]
+	fifo->last += count;
+	assert(fifo->last <= fifo->end);
+	if (fifo->last == fifo->end)
+		fifo->last = fifo->begin;
+}
+
+size_t
+ByteFifo_getReadableSpan(const ByteFifo *const fifo, const uint8_t **const span)
+{
+	*span = fifo->first;
+
+	if (ByteFifo_isEmpty(fifo))
+		return 0;
+
+	// cppcheck-suppress [misra-c2012-18.4]
+	ptrdiff_t spanSize = fifo->end - fifo->first;
+	if (fifo->last > fifo->first)
+		// cppcheck-suppress [misra-c2012-18.4]
+		spanSize = fifo->last - fifo->first;
+
+	return (size_t)spanSize;
+}
+
+void
+ByteFifo_commitRead(ByteFifo *const fifo, const size_t count)
+{
+	if (count == 0u)
+		return;
+
+	// cppcheck-suppress [misra-c2012-18.4]
+	fifo->first += count;
+	assert(fifo->first <= fifo->end);
+	if (fifo->first == fifo->end)
+		fifo->first = fifo->begin;
+	if (fifo->first == fifo->last)
+		fifo->first = NULL;
+}
+
+size_t
+ByteFifo_pushBytes(ByteFifo *const fifo, const uint8_t *const data,
+		const size_t size)
+{
+	size_t pushed = 0;
+
+	// Free space is split into at most two segments: up to the buffer end and past the wrap.
+	for (uint32_t segment = 0; (segment < 2u) && (pushed < size);
+			++segment) {
+		uint8_t *span = NULL;
+		size_t spanSize = ByteFifo_getWritableSpan(fifo, &span);
+		if (spanSize == 0u)
+			break;
+		if (spanSize > (size - pushed))
+			spanSize = size - pushed;
+
+		(void)memcpy(span, &data[pushed], spanSize);
+		ByteFifo_commitWrite(fifo, spanSize);
+		pushed += spanSize;
+	}
+
+	return pushed;
+}
+
+size_t
+ByteFifo_pullBytes(ByteFifo *const fifo, uint8_t *const data, const size_t size)
+{
+	size_t pulled = 0;
+
+	// Queue contents are split into at most two segments: up to the buffer end and past the wrap.
+	for (uint32_t segment = 0; (segment < 2u) && (pulled < size);
+			++segment) {
+		const uint8_t *span = NULL;
+		size_t spanSize = ByteFifo_getReadableSpan(fifo, &span);
+		if (spanSize == 0u)
+			break;
+		if (spanSize > (size - pulled))
+			spanSize = size - pulled;
+
+		(void)memcpy(&data[pulled], span, spanSize);
+		ByteFifo_commitRead(fifo, spanSize);
+		pulled += spanSize;
+	}
+
+	return pulled;
+}
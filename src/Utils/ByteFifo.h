@@ -125,7 +125,20 @@ ByteFifo_isEmpty(const ByteFifo *const fifo)
 /// \brief Returns the number of elements in queue.
 /// \param [in] fifo Queue to check.
 /// \returns The number of elements.
-size_t ByteFifo_getCount(const ByteFifo *const fifo);
+static inline size_t
+ByteFifo_getCount(const ByteFifo *const fifo)
+{
+	if (ByteFifo_isEmpty(fifo))
+		return 0;
+
+	// cppcheck-suppress [misra-c2012-18.4]
+	ptrdiff_t ptrDifference = fifo->last - fifo->first;
+	if (ptrDifference <= 0)
+		// cppcheck-suppress [misra-c2012-18.4]
+		ptrDifference += fifo->end - fifo->begin;
+
+	return (size_t)ptrDifference;
+}
 
 /// \brief Pushes given item as last in queue.
 /// \param [in,out] fifo target queue.
@@ -141,6 +154,56 @@ bool ByteFifo_push(ByteFifo *const fifo, const uint8_t data);
 /// \retval false otherwise (queue is empty)
 bool ByteFifo_pull(ByteFifo *const fifo, uint8_t *const data);
 
+/// \brief Pushes a block of bytes at the end of the queue.
+/// \details Data is copied in at most two contiguous segments. If there is not enough free
+///          space in the queue, only the leading part of the block that fits is pushed.
+/// \param [in,out] fifo target queue.
+/// \param [in] data pointer to the bytes to push.
+/// \param [in] size number of bytes to push.
+/// \returns The number of bytes pushed into the queue.
+size_t ByteFifo_pushBytes(ByteFifo *const fifo, const uint8_t *const data,
+		const size_t size);
+
+/// \brief Pulls a block of bytes from the beginning of the queue.
+/// \details Data is copied out in at most two contiguous segments. Pulled bytes are removed
+///          from the queue.
+/// \param [in,out] fifo target queue.
+/// \param [out] data address to store pulled bytes.
+/// \param [in] size maximum number of bytes to pull.
+/// \returns The number of bytes pulled from the queue.
+size_t ByteFifo_pullBytes(
+		ByteFifo *const fifo, uint8_t *const data, const size_t size);
+
+/// \brief Returns the contiguous free area located at the insert position of the queue.
+/// \details Allows producers to write directly into the queue storage. Written bytes become
+///          a part of the queue only after ::ByteFifo_commitWrite is called. The area may be
+///          shorter than the total free space, when the free space wraps around the buffer end.
+/// \param [in] fifo target queue.
+/// \param [out] span address to store the pointer to the beginning of the free area.
+/// \returns The number of bytes that can be written at the returned location.
+size_t ByteFifo_getWritableSpan(
+		const ByteFifo *const fifo, uint8_t **const span);
+
+/// \brief Appends bytes written into the area returned by ::ByteFifo_getWritableSpan to the queue.
+/// \param [in,out] fifo target queue.
+/// \param [in] count number of bytes written, must not exceed the size of the area.
+void ByteFifo_commitWrite(ByteFifo *const fifo, const size_t count);
+
+/// \brief Returns the contiguous area holding the oldest items of the queue.
+/// \details Allows consumers to read directly from the queue storage. Read bytes are removed
+///          from the queue only after ::ByteFifo_commitRead is called. The area may be shorter
+///          than the queue contents, when the contents wrap around the buffer end.
+/// \param [in] fifo target queue.
+/// \param [out] span address to store the pointer to the oldest item in the queue.
+/// \returns The number of bytes that can be read from the returned location.
+size_t ByteFifo_getReadableSpan(
+		const ByteFifo *const fifo, const uint8_t **const span);
+
+/// \brief Removes bytes read from the area returned by ::ByteFifo_getReadableSpan from the queue.
+/// \param [in,out] fifo target queue.
+/// \param [in] count number of bytes read, must not exceed the size of the area.
+void ByteFifo_commitRead(ByteFifo *const fifo, const size_t count);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
@@ -0,0 +1,113 @@
+/**@file
+ * This file is part of the N7-Core library used in the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file Crc.h
+/// \addtogroup Utils
+/// \brief Module computing CRC-16 and CRC-32 checksums with table-driven slicing.
+/// \details Both checksums are computed incrementally, the value returned for one block of
+///          data is passed as the initial value for the next one. Data is processed four
+///          bytes per table lookup round, at the cost of 2 KiB (CRC-16) and 4 KiB (CRC-32) of
+///          constant tables.
+
+#ifndef UTILS_CRC_H
+#define UTILS_CRC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ByteBuffer.h"
+#include "ByteFifo.h"
+
+/// @addtogroup Crc
+/// @ingroup Utils
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Initial value of CRC-16/CCITT-FALSE (polynomial 0x1021, no reflection, no final
+///        XOR), used e.g. by CCSDS frames.
+#define CRC_16_INITIAL_VALUE 0xFFFFu
+
+/// \brief Initial value of CRC-32 (IEEE 802.3, polynomial 0x04C11DB7, reflected). The
+///        final XOR is applied by every call, so the values of successive calls chain.
+#define CRC_32_INITIAL_VALUE 0x00000000u
+
+/// \brief Updates CRC-16/CCITT-FALSE with given bytes.
+/// \param [in] crc checksum of preceding data, or ::CRC_16_INITIAL_VALUE.
+/// \param [in] data pointer to bytes to process, may be NULL if size is zero.
+/// \param [in] size number of bytes to process.
+/// \returns checksum including processed bytes.
+uint16_t Crc_crc16(const uint16_t crc, const uint8_t *const data,
+		const size_t size);
+
+/// \brief Updates CRC-16/CCITT-FALSE with the contents of ByteBuffer.
+/// \param [in] crc checksum of preceding data, or ::CRC_16_INITIAL_VALUE.
+/// \param [in] buffer pointer to ByteBuffer to process.
+/// \returns checksum including buffer contents.
+static inline uint16_t
+Crc_crc16ByteBuffer(const uint16_t crc, const ByteBuffer *const buffer)
+{
+	return Crc_crc16(crc, buffer->begin, ByteBuffer_getCount(buffer));
+}
+
+/// \brief Updates CRC-16/CCITT-FALSE with the contents of ByteFifo, from the oldest item.
+/// \details Processes at most two contiguous spans, does not remove any items.
+/// \param [in] crc checksum of preceding data, or ::CRC_16_INITIAL_VALUE.
+/// \param [in] fifo pointer to ByteFifo to process.
+/// \returns checksum including queue contents.
+uint16_t Crc_crc16ByteFifo(const uint16_t crc, const ByteFifo *const fifo);
+
+/// \brief Updates CRC-32 with given bytes.
+/// \param [in] crc checksum of preceding data, or ::CRC_32_INITIAL_VALUE.
+/// \param [in] data pointer to bytes to process, may be NULL if size is zero.
+/// \param [in] size number of bytes to process.
+/// \returns checksum including processed bytes.
+uint32_t Crc_crc32(const uint32_t crc, const uint8_t *const data,
+		const size_t size);
+
+/// \brief Updates CRC-32 with the contents of ByteBuffer.
+/// \param [in] crc checksum of preceding data, or ::CRC_32_INITIAL_VALUE.
+/// \param [in] buffer pointer to ByteBuffer to process.
+/// \returns checksum including buffer contents.
+static inline uint32_t
+Crc_crc32ByteBuffer(const uint32_t crc, const ByteBuffer *const buffer)
+{
+	return Crc_crc32(crc, buffer->begin, ByteBuffer_getCount(buffer));
+}
+
+/// \brief Updates CRC-32 with the contents of ByteFifo, from the oldest item.
+/// \details Processes at most two contiguous spans, does not remove any items.
+/// \param [in] crc checksum of preceding data, or ::CRC_32_INITIAL_VALUE.
+/// \param [in] fifo pointer to ByteFifo to process.
+/// \returns checksum including queue contents.
+uint32_t Crc_crc32ByteFifo(const uint32_t crc, const ByteFifo *const fifo);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // UTILS_CRC_H
@@ -0,0 +1,150 @@
+/**@file
+ * This file is part of the N7-Core library used in the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Memory.h"
+
+#include <assert.h>
+#include <stdbool.h>
+#include <string.h>
+
+#define MEMORY_WORD_SIZE 4u
+#define MEMORY_DOUBLE_WORD_SIZE 8u
+
+// The compiler would otherwise recognise the loops below and replace them with calls to the
+// very library functions they are meant to bypass.
+#if defined(__clang__)
+#define MEMORY_NO_LIBCALL
+#else
+#define MEMORY_NO_LIBCALL \
+	__attribute__((optimize("no-tree-loop-distribute-patterns")))
+#endif
+
+static inline bool
+isAligned(const uintptr_t value, const uintptr_t alignment)
+{
+	return (value & (alignment - 1u)) == 0u;
+}
+
+MEMORY_NO_LIBCALL void
+Memory_copy(void *const destination, const void *const source,
+		const size_t size)
+{
+	assert((destination != NULL) || (size == 0u));
+	assert((source != NULL) || (size == 0u));
+
+	// cppcheck-suppress misra-c2012-11.4
+	const uintptr_t alignment = (uintptr_t)destination | (uintptr_t)source
+			| (uintptr_t)size;
+
+	if (isAligned(alignment, MEMORY_DOUBLE_WORD_SIZE)) {
+		uint8_t *const target = (uint8_t *)__builtin_assume_aligned(
+				destination, MEMORY_DOUBLE_WORD_SIZE);
+		const uint8_t *const origin =
+				(const uint8_t *)__builtin_assume_aligned(
+						source, MEMORY_DOUBLE_WORD_SIZE);
+		for (size_t i = 0u; i < size; i += MEMORY_DOUBLE_WORD_SIZE) {
+			uint64_t word;
+			(void)memcpy(&word, &origin[i], sizeof(word));
+			(void)memcpy(&target[i], &word, sizeof(word));
+		}
+	} else if (isAligned(alignment, MEMORY_WORD_SIZE)) {
+		uint8_t *const target = (uint8_t *)__builtin_assume_aligned(
+				destination, MEMORY_WORD_SIZE);
+		const uint8_t *const origin =
+				(const uint8_t *)__builtin_assume_aligned(
+						source, MEMORY_WORD_SIZE);
+		for (size_t i = 0u; i < size; i += MEMORY_WORD_SIZE) {
+			uint32_t word;
+			(void)memcpy(&word, &origin[i], sizeof(word));
+			(void)memcpy(&target[i], &word, sizeof(word));
+		}
+	} else {
+		(void)memcpy(destination, source, size);
+	}
+}
+
+MEMORY_NO_LIBCALL void
+Memory_fill(void *const destination, const uint8_t value, const size_t size)
+{
+	assert((destination != NULL) || (size == 0u));
+
+	// cppcheck-suppress misra-c2012-11.4
+	const uintptr_t alignment = (uintptr_t)destination | (uintptr_t)size;
+
+	if (isAligned(alignment, MEMORY_WORD_SIZE)) {
+		uint8_t *const target = (uint8_t *)__builtin_assume_aligned(
+				destination, MEMORY_WORD_SIZE);
+		const uint32_t word = (uint32_t)value * 0x01010101u;
+		for (size_t i = 0u; i < size; i += MEMORY_WORD_SIZE)
+			(void)memcpy(&target[i], &word, sizeof(word));
+	} else {
+		(void)memset(destination, (int)value, size);
+	}
+}
+
+void
+Memory_writeWords(volatile uint32_t *const destination,
+		const uint8_t *const source, const size_t size)
+{
+	const size_t fullWords = size / MEMORY_WORD_SIZE;
+	for (size_t i = 0u; i < fullWords; i++) {
+		uint32_t word;
+		(void)memcpy(&word, &source[i * MEMORY_WORD_SIZE], sizeof(word));
+		destination[i] = word;
+	}
+
+	const size_t remainder = size % MEMORY_WORD_SIZE;
+	if (remainder != 0u) {
+		uint32_t word = 0u;
+		(void)memcpy(&word, &source[fullWords * MEMORY_WORD_SIZE],
+				remainder);
+		destination[fullWords] = word;
+	}
+}
+
+void
+Memory_readWords(uint8_t *const destination,
+		const volatile uint32_t *const source, const size_t size)
+{
+	const size_t fullWords = size / MEMORY_WORD_SIZE;
+	for (size_t i = 0u; i < fullWords; i++) {
+		const uint32_t word = source[i];
+		(void)memcpy(&destination[i * MEMORY_WORD_SIZE], &word,
+				sizeof(word));
+	}
+
+	const size_t remainder = size % MEMORY_WORD_SIZE;
+	if (remainder != 0u) {
+		const uint32_t word = source[fullWords];
+		(void)memcpy(&destination[fullWords * MEMORY_WORD_SIZE], &word,
+				remainder);
+	}
+}
+
+void
+Memory_fillWords(volatile uint32_t *const destination, const uint32_t value,
+		const size_t count)
+{
+	for (size_t i = 0u; i < count; i++)
+		destination[i] = value;
+}
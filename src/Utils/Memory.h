@@ -0,0 +1,94 @@
+/**@file
+ * This file is part of the N7-Core library used in the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file Memory.h
+/// \addtogroup Utils
+/// \brief Module providing copy and fill primitives specialised for aligned transfers and for
+///        memories that permit full-word accesses only.
+/// \details ::Memory_copy and ::Memory_fill use 64-bit or 32-bit transfers when the addresses
+///          and the size allow it and fall back to the C library otherwise. The word functions
+///          access the memory exclusively with 32-bit volatile accesses, as required e.g. by
+///          the MCAN message RAM.
+
+#ifndef UTILS_MEMORY_H
+#define UTILS_MEMORY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/// @addtogroup Memory
+/// @ingroup Utils
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Copies bytes between non-overlapping memory areas.
+/// \details When both addresses and the size are multiples of 8, the data is transferred with
+///          64-bit accesses, matching the width of the Cortex-M7 AXI bus. Multiples of 4 are
+///          transferred with 32-bit accesses, other cases are passed to `memcpy`.
+/// \param [out] destination pointer to destination area.
+/// \param [in] source pointer to source area.
+/// \param [in] size number of bytes to copy.
+void Memory_copy(void *const destination, const void *const source,
+		const size_t size);
+
+/// \brief Fills memory area with given byte value.
+/// \details When the address and the size are multiples of 4, the area is filled with 32-bit
+///          accesses, other cases are passed to `memset`.
+/// \param [out] destination pointer to area to fill.
+/// \param [in] value value of every byte.
+/// \param [in] size number of bytes to fill.
+void Memory_fill(void *const destination, const uint8_t value, const size_t size);
+
+/// \brief Writes bytes into memory permitting full-word accesses only.
+/// \details Bytes are packed into little-endian words, the last word is padded with zeros.
+/// \param [out] destination pointer to first destination word.
+/// \param [in] source pointer to bytes to write.
+/// \param [in] size number of bytes to write.
+void Memory_writeWords(volatile uint32_t *const destination,
+		const uint8_t *const source, const size_t size);
+
+/// \brief Reads bytes from memory permitting full-word accesses only.
+/// \details Whole words are read, only `size` bytes are stored at the destination.
+/// \param [out] destination pointer to area receiving the bytes.
+/// \param [in] source pointer to first source word.
+/// \param [in] size number of bytes to read.
+void Memory_readWords(uint8_t *const destination,
+		const volatile uint32_t *const source, const size_t size);
+
+/// \brief Fills memory permitting full-word accesses only with given word value.
+/// \param [out] destination pointer to first word to fill.
+/// \param [in] value value of every word.
+/// \param [in] count number of words to fill.
+void Memory_fillWords(volatile uint32_t *const destination,
+		const uint32_t value, const size_t count);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // UTILS_MEMORY_H
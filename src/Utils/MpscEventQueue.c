@@ -0,0 +1,96 @@
+/**@file
+ * This file is part of the N7-Core library used in the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "MpscEventQueue.h"
+
+#include <assert.h>
+
+void
+MpscEventQueue_init(MpscEventQueue *const queue,
+		MpscEventQueue_Slot *const slots, const size_t slotCount)
+{
+	assert(slots != NULL);
+	assert(slotCount > 0u);
+	assert((slotCount & (slotCount - 1u)) == 0u);
+	assert(slotCount <= (UINT32_C(1) << 31u));
+
+	for (uint32_t i = 0u; i < (uint32_t)slotCount; i++)
+		__atomic_store_n(&slots[i].sequence, i, __ATOMIC_RELAXED);
+
+	queue->slots = slots;
+	queue->mask = (uint32_t)slotCount - 1u;
+	__atomic_store_n(&queue->tail, 0u, __ATOMIC_RELAXED);
+	__atomic_store_n(&queue->pendingSources, 0u, __ATOMIC_RELAXED);
+	__atomic_store_n(&queue->head, 0u, __ATOMIC_RELEASE);
+}
+
+bool
+MpscEventQueue_push(
+		MpscEventQueue *const queue, const MpscEventQueue_Event *const event)
+{
+	uint32_t head = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+	MpscEventQueue_Slot *slot = NULL;
+
+	for (;;) {
+		slot = &queue->slots[head & queue->mask];
+		const uint32_t sequence =
+				__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE);
+
+		if (sequence == head) {
+			// On failure the current reservation index is loaded into
+			// head, the slot is then checked again.
+			if (__atomic_compare_exchange_n(&queue->head, &head,
+					    head + 1u, true, __ATOMIC_RELAXED,
+					    __ATOMIC_RELAXED))
+				break;
+		} else if ((int32_t)(sequence - head) < 0) {
+			// The slot still holds an event from the previous lap.
+			return false;
+		} else {
+			head = __atomic_load_n(&queue->head, __ATOMIC_RELAXED);
+		}
+	}
+
+	slot->event = *event;
+	__atomic_store_n(&slot->sequence, head + 1u, __ATOMIC_RELEASE);
+
+	return true;
+}
+
+bool
+MpscEventQueue_pull(
+		MpscEventQueue *const queue, MpscEventQueue_Event *const event)
+{
+	const uint32_t tail = __atomic_load_n(&queue->tail, __ATOMIC_RELAXED);
+	MpscEventQueue_Slot *const slot = &queue->slots[tail & queue->mask];
+
+	if (__atomic_load_n(&slot->sequence, __ATOMIC_ACQUIRE) != (tail + 1u))
+		return false;
+
+	*event = slot->event;
+	__atomic_store_n(&slot->sequence, tail + queue->mask + 1u,
+			__ATOMIC_RELEASE);
+	__atomic_store_n(&queue->tail, tail + 1u, __ATOMIC_RELAXED);
+
+	return true;
+}
@@ -0,0 +1,151 @@
+/**@file
+ * This file is part of the N7-Core library used in the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file MpscEventQueue.h
+/// \addtogroup Utils
+/// \brief Module representing lock-free multiple-producer/single-consumer event queue.
+/// \details Interrupt handlers of any priority post fixed-size event records, a single
+///          consumer (e.g. main loop) pulls them in order of reservation, without masking
+///          interrupts. Every slot carries a sequence number, so a producer preempted between
+///          reserving and publishing a slot only delays the consumer, it never exposes a
+///          partially written record. Reservation uses a compare-and-swap (LDREX/STREX) and
+///          is retried only when another producer preempted it. Capacity must be a power of
+///          two. In addition the queue holds a mask of pending sources, for signals that do
+///          not carry data and may be coalesced.
+
+#ifndef UTILS_MPSCEVENTQUEUE_H
+#define UTILS_MPSCEVENTQUEUE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "Bits.h"
+
+/// @addtogroup MpscEventQueue
+/// @ingroup Utils
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Number of sources tracked by the pending sources mask.
+#define MPSC_EVENT_QUEUE_SOURCE_COUNT 32u
+
+/// \brief Structure representing single event record.
+typedef struct {
+	uint16_t source; ///< Identifier of the posting source, defined by the user.
+	uint16_t type; ///< Source specific event type.
+	uint32_t argument; ///< Source specific event argument.
+} MpscEventQueue_Event;
+
+/// \brief Structure representing single queue slot.
+typedef struct {
+	uint32_t sequence; ///< Index of the push or pull operation the slot awaits.
+	MpscEventQueue_Event event; ///< Stored event record.
+} MpscEventQueue_Slot;
+
+/// \brief Structure representing single queue instance.
+typedef struct {
+	MpscEventQueue_Slot *slots; ///< Pointer to beginning of slots array.
+	uint32_t mask; ///< Index mask, equal to capacity minus one.
+	uint32_t head; ///< Free-running reservation index, shared by the producers.
+	uint32_t tail; ///< Free-running remove index, modified by the consumer only.
+	uint32_t pendingSources; ///< Mask of sources signalled since they were last taken.
+} MpscEventQueue;
+
+/// \brief MpscEventQueue constructor macro, creates empty queue with given name and capacity.
+///        It creates slots array on stack, so it is mostly useful in tests. The queue must
+///        still be initialised with ::MpscEventQueue_init.
+/// \param [in] NAME name of MpscEventQueue to create.
+/// \param [in] CAPACITY capacity of created MpscEventQueue, must be a power of two.
+// clang-format off
+// cppcheck-suppress [misra-c2012-20.7, misra-c2012-20.10, misra-c2012-20.12]
+#define MPSC_EVENT_QUEUE_CREATE(NAME, CAPACITY)                         \
+  MpscEventQueue_Slot NAME ## Slots[(CAPACITY)];                        \
+  MpscEventQueue NAME
+// clang-format on
+
+/// \brief MpscEventQueue initialisation procedure, assigns all fields properly.
+///        Should be called before any use of MpscEventQueue, when no producer is active.
+/// \param [out] queue pointer to MpscEventQueue to initialise.
+/// \param [in] slots slots array to be assigned to MpscEventQueue as its storage area.
+/// \param [in] slotCount number of slots, must be a power of two.
+void MpscEventQueue_init(MpscEventQueue *const queue,
+		MpscEventQueue_Slot *const slots, const size_t slotCount);
+
+/// \brief Returns capacity of the queue.
+/// \param [in] queue queue to check.
+/// \returns The maximum number of events stored in queue.
+static inline size_t
+MpscEventQueue_getCapacity(const MpscEventQueue *const queue)
+{
+	return (size_t)queue->mask + 1u;
+}
+
+/// \brief Pushes given event as last in queue. Can be called by any number of producers,
+///        including nested interrupt handlers.
+/// \param [in,out] queue target queue.
+/// \param [in] event event to push.
+/// \retval true on successful push
+/// \retval false otherwise (queue is full)
+bool MpscEventQueue_push(
+		MpscEventQueue *const queue, const MpscEventQueue_Event *const event);
+
+/// \brief Pulls first event from queue. Should be called by the consumer only.
+/// \details An event reserved earlier and not yet published by a preempted producer stops the
+///          consumer, events published after it are returned by subsequent calls.
+/// \param [in,out] queue target queue.
+/// \param [out] event address to store pulled event.
+/// \retval true on successful pull
+/// \retval false otherwise (queue is empty)
+bool MpscEventQueue_pull(
+		MpscEventQueue *const queue, MpscEventQueue_Event *const event);
+
+/// \brief Marks given source as pending. Can be called by any number of producers.
+/// \param [in,out] queue target queue.
+/// \param [in] source source identifier, below ::MPSC_EVENT_QUEUE_SOURCE_COUNT.
+static inline void
+MpscEventQueue_signal(MpscEventQueue *const queue, const uint32_t source)
+{
+	atomicSetBits(&queue->pendingSources, UINT32_C(1) << source);
+}
+
+/// \brief Returns and clears the mask of pending sources. Should be called by the consumer
+///        only, e.g. followed by ::FOR_EACH_SET_BIT over the result.
+/// \param [in,out] queue target queue.
+/// \returns Mask of sources signalled since the previous call.
+static inline uint32_t
+MpscEventQueue_takePendingSources(MpscEventQueue *const queue)
+{
+	return atomicTakeBits(&queue->pendingSources, UINT32_MAX);
+}
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // UTILS_MPSCEVENTQUEUE_H
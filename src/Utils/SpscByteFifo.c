@@ -0,0 +1,109 @@
+/**@file
+ * This file is part of the N7-Core library used in the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "SpscByteFifo.h"
+
+#include <assert.h>
+#include <string.h>
+
+void
+SpscByteFifo_init(SpscByteFifo *const fifo, uint8_t *const memoryBlock,
+		const size_t memoryBlockSize)
+{
+	assert(memoryBlockSize > 0u);
+	assert((memoryBlockSize & (memoryBlockSize - 1u)) == 0u);
+	assert(memoryBlockSize <= (UINT32_C(1) << 31u));
+
+	fifo->buffer = memoryBlock;
+	fifo->mask = (uint32_t)memoryBlockSize - 1u;
+	SpscByteFifo_clear(fifo);
+}
+
+bool
+SpscByteFifo_push(SpscByteFifo *const fifo, const uint8_t data)
+{
+	const uint32_t head = __atomic_load_n(&fifo->head, __ATOMIC_RELAXED);
+	const uint32_t tail = __atomic_load_n(&fifo->tail, __ATOMIC_ACQUIRE);
+	if ((head - tail) > fifo->mask)
+		return false;
+
+	fifo->buffer[head & fifo->mask] = data;
+	__atomic_store_n(&fifo->head, head + 1u, __ATOMIC_RELEASE);
+
+	return true;
+}
+
+bool
+SpscByteFifo_pull(SpscByteFifo *const fifo, uint8_t *const data)
+{
+	const uint32_t tail = __atomic_load_n(&fifo->tail, __ATOMIC_RELAXED);
+	const uint32_t head = __atomic_load_n(&fifo->head, __ATOMIC_ACQUIRE);
+	if (head == tail)
+		return false;
+
+	*data = fifo->buffer[tail & fifo->mask];
+	__atomic_store_n(&fifo->tail, tail + 1u, __ATOMIC_RELEASE);
+
+	return true;
+}
+
+size_t
+SpscByteFifo_pushBytes(SpscByteFifo *const fifo, const uint8_t *const data,
+		const size_t size)
+{
+	const uint32_t head = __atomic_load_n(&fifo->head, __ATOMIC_RELAXED);
+	const uint32_t tail = __atomic_load_n(&fifo->tail, __ATOMIC_ACQUIRE);
+	const size_t freeSpace =
+			SpscByteFifo_getCapacity(fifo) - (size_t)(head - tail);
+	const size_t count = (size < freeSpace) ? size : freeSpace;
+
+	const size_t offset = (size_t)(head & fifo->mask);
+	const size_t untilEnd = SpscByteFifo_getCapacity(fifo) - offset;
+	const size_t firstSegment = (count < untilEnd) ? count : untilEnd;
+
+	(void)memcpy(&fifo->buffer[offset], data, firstSegment);
+	(void)memcpy(fifo->buffer, &data[firstSegment], count - firstSegment);
+	__atomic_store_n(&fifo->head, head + (uint32_t)count, __ATOMIC_RELEASE);
+
+	return count;
+}
+
+size_t
+SpscByteFifo_pullBytes(
+		SpscByteFifo *const fifo, uint8_t *const data, const size_t size)
+{
+	const uint32_t tail = __atomic_load_n(&fifo->tail, __ATOMIC_RELAXED);
+	const uint32_t head = __atomic_load_n(&fifo->head, __ATOMIC_ACQUIRE);
+	const size_t available = (size_t)(head - tail);
+	const size_t count = (size < available) ? size : available;
+
+	const size_t offset = (size_t)(tail & fifo->mask);
+	const size_t untilEnd = SpscByteFifo_getCapacity(fifo) - offset;
+	const size_t firstSegment = (count < untilEnd) ? count : untilEnd;
+
+	(void)memcpy(data, &fifo->buffer[offset], firstSegment);
+	(void)memcpy(&data[firstSegment], fifo->buffer, count - firstSegment);
+	__atomic_store_n(&fifo->tail, tail + (uint32_t)count, __ATOMIC_RELEASE);
+
+	return count;
+}
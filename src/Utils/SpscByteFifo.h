@@ -0,0 +1,167 @@
+/**@file
+ * This file is part of the N7-Core library used in the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file SpscByteFifo.h
+/// \addtogroup Utils
+/// \brief Module representing lock-free single-producer/single-consumer byte queue.
+/// \details Producer and consumer own separate indices, so one side can access the queue
+///          while the other is interrupted in the middle of an operation (e.g. main loop and
+///          interrupt handler), without masking interrupts. Capacity must be a power of two.
+
+#ifndef UTILS_SPSCBYTEFIFO_H
+#define UTILS_SPSCBYTEFIFO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// @addtogroup SpscByteFifo
+/// @ingroup Utils
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Structure representing single queue instance.
+typedef struct {
+	uint8_t *buffer; ///< Pointer to beginning of buffer area.
+	uint32_t mask; ///< Index mask, equal to capacity minus one.
+	uint32_t head; ///< Free-running insert index, modified by the producer only.
+	uint32_t tail; ///< Free-running remove index, modified by the consumer only.
+} SpscByteFifo;
+
+/// \brief SpscByteFifo constructor macro, creates empty queue with given name and capacity.
+///        It creates memory block on stack, so it is mostly useful in tests.
+/// \param [in] NAME name of SpscByteFifo to create.
+/// \param [in] CAPACITY capacity of created SpscByteFifo, must be a power of two.
+// clang-format off
+// cppcheck-suppress [misra-c2012-20.7, misra-c2012-20.10, misra-c2012-20.12]
+#define SPSC_BYTE_FIFO_CREATE(NAME, CAPACITY)                           \
+  uint8_t NAME ## MemoryBlock[(CAPACITY)] = { 0 };                      \
+  SpscByteFifo NAME = { .buffer = NAME ## MemoryBlock,                  \
+                        .mask   = (uint32_t)(CAPACITY) - 1u,            \
+                        .head   = 0u,                                   \
+                        .tail   = 0u }
+// clang-format on
+
+/// \brief SpscByteFifo initialisation procedure, assigns all fields properly.
+///        Should be called before any use of SpscByteFifo.
+/// \param [in,out] fifo pointer to SpscByteFifo to initialise.
+/// \param [in] memoryBlock memory block to be assigned to SpscByteFifo as its storage area.
+/// \param [in] memoryBlockSize size of memory block, must be a power of two.
+void SpscByteFifo_init(SpscByteFifo *const fifo, uint8_t *const memoryBlock,
+		const size_t memoryBlockSize);
+
+/// \brief Clears queue. Must not be called concurrently with the producer or the consumer.
+/// \param [in,out] fifo queue to clear.
+static inline void
+SpscByteFifo_clear(SpscByteFifo *const fifo)
+{
+	__atomic_store_n(&fifo->head, 0u, __ATOMIC_RELEASE);
+	__atomic_store_n(&fifo->tail, 0u, __ATOMIC_RELEASE);
+}
+
+/// \brief Returns capacity of the queue.
+/// \param [in] fifo queue to check.
+/// \returns The maximum number of elements stored in queue.
+static inline size_t
+SpscByteFifo_getCapacity(const SpscByteFifo *const fifo)
+{
+	return (size_t)fifo->mask + 1u;
+}
+
+/// \brief Returns the number of elements in queue.
+/// \details Can be called by both the producer and the consumer.
+/// \param [in] fifo Queue to check.
+/// \returns The number of elements.
+static inline size_t
+SpscByteFifo_getCount(const SpscByteFifo *const fifo)
+{
+	const uint32_t tail = __atomic_load_n(&fifo->tail, __ATOMIC_ACQUIRE);
+	const uint32_t head = __atomic_load_n(&fifo->head, __ATOMIC_ACQUIRE);
+	return (size_t)(head - tail);
+}
+
+/// \brief Checks if queue is full.
+/// \param [in] fifo queue to check.
+/// \retval true when queue is full (next push will not be accepted).
+/// \retval false otherwise
+static inline bool
+SpscByteFifo_isFull(const SpscByteFifo *const fifo)
+{
+	return SpscByteFifo_getCount(fifo) == SpscByteFifo_getCapacity(fifo);
+}
+
+/// \brief Checks if queue is empty.
+/// \param [in] fifo queue to check.
+/// \retval true when queue is empty (next pull will not be accepted).
+/// \retval false otherwise
+static inline bool
+SpscByteFifo_isEmpty(const SpscByteFifo *const fifo)
+{
+	return SpscByteFifo_getCount(fifo) == 0u;
+}
+
+/// \brief Pushes given item as last in queue. Should be called by the producer only.
+/// \param [in,out] fifo target queue.
+/// \param [in] data data to push.
+/// \retval true on successful push
+/// \retval false otherwise (queue is full)
+bool SpscByteFifo_push(SpscByteFifo *const fifo, const uint8_t data);
+
+/// \brief Pull first item from queue. Removes pulled item from queue.
+///        Should be called by the consumer only.
+/// \param [in,out] fifo target queue.
+/// \param [out] data address to store pulled data.
+/// \retval true on successful pull
+/// \retval false otherwise (queue is empty)
+bool SpscByteFifo_pull(SpscByteFifo *const fifo, uint8_t *const data);
+
+/// \brief Pushes a block of bytes at the end of the queue. Should be called by the producer only.
+/// \details Data is copied in at most two contiguous segments and published at once. If there is
+///          not enough free space in the queue, only the leading part of the block is pushed.
+/// \param [in,out] fifo target queue.
+/// \param [in] data pointer to the bytes to push.
+/// \param [in] size number of bytes to push.
+/// \returns The number of bytes pushed into the queue.
+size_t SpscByteFifo_pushBytes(SpscByteFifo *const fifo,
+		const uint8_t *const data, const size_t size);
+
+/// \brief Pulls a block of bytes from the beginning of the queue.
+///        Should be called by the consumer only.
+/// \details Data is copied out in at most two contiguous segments and released at once.
+/// \param [in,out] fifo target queue.
+/// \param [out] data address to store pulled bytes.
+/// \param [in] size maximum number of bytes to pull.
+/// \returns The number of bytes pulled from the queue.
+size_t SpscByteFifo_pullBytes(
+		SpscByteFifo *const fifo, uint8_t *const data, const size_t size);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // UTILS_SPSCBYTEFIFO_H
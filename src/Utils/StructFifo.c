@@ -23,6 +23,10 @@
 
 #include "StructFifo.h"
 
+#include <assert.h>
+
+#include "Memory.h"
+
 void
 StructFifo_init(StructFifo *const fifo, void *const memoryBuffer,
 		const size_t elementSize, const size_t elementsCount)
@@ -43,9 +47,8 @@ StructFifo_push(StructFifo *const fifo, const void *const data)
 
 	if (fifo->first == NULL)
 		fifo->first = fifo->last;
-	// cppcheck-suppress [misra-c2012-18.4]
-	fifo->last = (uint8_t *)memcpy(fifo->last, data, fifo->elementSize)
-			+ fifo->elementSize;
+	Memory_copy(fifo->last, data, fifo->elementSize);
+	fifo->last += fifo->elementSize; // cppcheck-suppress [misra-c2012-18.4]
 	if (fifo->last == fifo->end)
 		fifo->last = fifo->begin;
 
@@ -75,7 +78,7 @@ StructFifo_pull(StructFifo *const fifo, void *const data)
 	if (StructFifo_isEmpty(fifo))
 		return false;
 
-	(void)memcpy(data, fifo->first, fifo->elementSize);
+	Memory_copy(data, fifo->first, fifo->elementSize);
 	fifo->first += fifo->elementSize; // cppcheck-suppress [misra-c2012-18.4]
 	if (fifo->first == fifo->end)
 		fifo->first = fifo->begin;
@@ -105,7 +108,7 @@ StructFifo_peek(const StructFifo *const fifo, void *const data)
 	if (StructFifo_isEmpty(fifo))
 		return false;
 
-	(void)memcpy(data, fifo->first, fifo->elementSize);
+	Memory_copy(data, fifo->first, fifo->elementSize);
 	return true;
 }
 
@@ -123,3 +126,69 @@ StructFifo_drop(StructFifo *const fifo)
 		fifo->first = NULL;
 	return true;
 }
+
+size_t
+StructFifo_reserveBatch(const StructFifo *const fifo, const size_t maxCount,
+		void **const slots)
+{
+	*slots = fifo->last;
+
+	// cppcheck-suppress [misra-c2012-18.4]
+	ptrdiff_t spanSize = fifo->end - fifo->last;
+	if ((fifo->first != NULL) && (fifo->first >= fifo->last))
+		// cppcheck-suppress [misra-c2012-18.4]
+		spanSize = fifo->first - fifo->last;
+
+	const size_t count = (size_t)spanSize / fifo->elementSize;
+	return (count < maxCount) ? count : maxCount;
+}
+
+void
+StructFifo_commitBatch(StructFifo *const fifo, const size_t count)
+{
+	if (count == 0u)
+		return;
+
+	if (fifo->first == NULL)
+		fifo->first = fifo->last;
+	// cppcheck-suppress [misra-c2012-18.4]
+	fifo->last += count * fifo->elementSize;
+	assert(fifo->last <= fifo->end);
+	if (fifo->last == fifo->end)
+		fifo->last = fifo->begin;
+}
+
+size_t
+StructFifo_frontBatch(const StructFifo *const fifo, const size_t maxCount,
+		void **const slots)
+{
+	*slots = fifo->first;
+
+	if (StructFifo_isEmpty(fifo))
+		return 0;
+
+	// cppcheck-suppress [misra-c2012-18.4]
+	ptrdiff_t spanSize = fifo->end - fifo->first;
+	if (fifo->last > fifo->first)
+		// cppcheck-suppress [misra-c2012-18.4]
+		spanSize = fifo->last - fifo->first;
+
+	const size_t count = (size_t)spanSize / fifo->elementSize;
+	return (count < maxCount) ? count : maxCount;
+}
+
+void
+StructFifo_releaseBatch(StructFifo *const fifo, const size_t count)
+{
+	if (count == 0u)
+		return;
+
+	assert(!StructFifo_isEmpty(fifo));
+	// cppcheck-suppress [misra-c2012-18.4]
+	fifo->first += count * fifo->elementSize;
+	assert(fifo->first <= fifo->end);
+	if (fifo->first == fifo->end)
+		fifo->first = fifo->begin;
+	if (fifo->first == fifo->last)
+		fifo->first = NULL;
+}
@@ -124,6 +124,8 @@ StructFifo_isEmpty(const StructFifo *const fifo)
 }
 
 /// \brief Pushes given item as last in queue, copies item contents.
+/// \details Items are copied with ::Memory_copy, using word transfers when the item size
+///          and the addresses allow it.
 /// \param [in,out] fifo target queue.
 /// \param [in] data data to be copied and pushed into queue.
 /// \retval true on successful push
@@ -167,6 +169,81 @@ bool StructFifo_peek(const StructFifo *const fifo, void *const data);
 /// \retval false otherwise (queue is empty).
 bool StructFifo_drop(StructFifo *const fifo);
 
+/// \brief Returns up to the requested number of contiguous free slots at the end of the queue.
+/// \details Allows producers to construct elements in place, without an intermediate copy.
+///          Slots become a part of the queue only after ::StructFifo_commitBatch is called.
+///          Fewer slots than requested are returned, when the free space is smaller or wraps
+///          around the buffer end.
+/// \param [in] fifo target queue.
+/// \param [in] maxCount maximum number of slots to reserve.
+/// \param [out] slots address to store the pointer to the first reserved slot.
+/// \returns The number of contiguous slots available at the returned location.
+size_t StructFifo_reserveBatch(const StructFifo *const fifo,
+		const size_t maxCount, void **const slots);
+
+/// \brief Appends slots obtained with ::StructFifo_reserveBatch to the queue.
+/// \param [in,out] fifo target queue.
+/// \param [in] count number of filled slots, must not exceed the number of reserved slots.
+void StructFifo_commitBatch(StructFifo *const fifo, const size_t count);
+
+/// \brief Returns up to the requested number of contiguous oldest items in the queue.
+/// \details Allows consumers to process elements in place, without an intermediate copy.
+///          Items are removed from the queue only after ::StructFifo_releaseBatch is called.
+///          Fewer items than requested are returned, when the queue holds less of them or they
+///          wrap around the buffer end.
+/// \param [in] fifo target queue.
+/// \param [in] maxCount maximum number of items to return.
+/// \param [out] slots address to store the pointer to the oldest item.
+/// \returns The number of contiguous items available at the returned location.
+size_t StructFifo_frontBatch(const StructFifo *const fifo,
+		const size_t maxCount, void **const slots);
+
+/// \brief Removes items obtained with ::StructFifo_frontBatch from the queue.
+/// \param [in,out] fifo target queue.
+/// \param [in] count number of processed items, must not exceed the number of returned items.
+void StructFifo_releaseBatch(StructFifo *const fifo, const size_t count);
+
+/// \brief Returns the slot at the end of the queue, to be filled in place.
+/// \details The slot becomes a part of the queue only after ::StructFifo_commit is called.
+/// \param [in] fifo target queue.
+/// \returns Pointer to the free slot, or NULL if the queue is full.
+static inline void *
+StructFifo_reserve(const StructFifo *const fifo)
+{
+	void *slot = NULL;
+	if (StructFifo_reserveBatch(fifo, 1u, &slot) == 0u)
+		return NULL;
+	return slot;
+}
+
+/// \brief Appends the slot obtained with ::StructFifo_reserve to the queue.
+/// \param [in,out] fifo target queue.
+static inline void
+StructFifo_commit(StructFifo *const fifo)
+{
+	StructFifo_commitBatch(fifo, 1u);
+}
+
+/// \brief Returns the first item in the queue, to be accessed in place.
+/// \details The item is removed from the queue only after ::StructFifo_release is called.
+/// \param [in] fifo target queue.
+/// \returns Pointer to the first item, or NULL if the queue is empty.
+static inline void *
+StructFifo_front(const StructFifo *const fifo)
+{
+	if (StructFifo_isEmpty(fifo))
+		return NULL;
+	return fifo->first;
+}
+
+/// \brief Removes the item obtained with ::StructFifo_front from the queue.
+/// \param [in,out] fifo target queue.
+static inline void
+StructFifo_release(StructFifo *const fifo)
+{
+	StructFifo_releaseBatch(fifo, 1u);
+}
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
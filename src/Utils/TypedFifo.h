@@ -0,0 +1,176 @@
+/**@file
+ * This file is part of the N7-Core library used in the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file TypedFifo.h
+/// \addtogroup Utils
+/// \brief Macros generating fixed-size struct queues specialized for a given element type.
+/// \details Unlike StructFifo, element size and capacity are compile-time constants, so copies
+///          are plain structure assignments and index wrapping is a power-of-two mask.
+///          Example:
+/// \code
+/// TYPED_FIFO_DEFINE(RxFrameFifo, Mcan_RxElement, 32u)
+///
+/// static RxFrameFifo rxFrames;
+/// ...
+/// RxFrameFifo_init(&rxFrames);
+/// RxFrameFifo_push(&rxFrames, &element);
+/// \endcode
+
+#ifndef UTILS_TYPEDFIFO_H
+#define UTILS_TYPEDFIFO_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/// @addtogroup TypedFifo
+/// @ingroup Utils
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Compile-time assertion usable from both C and C++ code.
+#ifdef __cplusplus
+#define TYPED_FIFO_STATIC_ASSERT(CONDITION, MESSAGE) static_assert(CONDITION, MESSAGE)
+#else
+#define TYPED_FIFO_STATIC_ASSERT(CONDITION, MESSAGE) _Static_assert(CONDITION, MESSAGE)
+#endif
+
+/// \brief Macro defining a queue type NAME holding CAPACITY elements of type TYPE,
+///        together with its static inline operations (NAME_init, NAME_clear, NAME_getCount,
+///        NAME_isEmpty, NAME_isFull, NAME_push, NAME_pull, NAME_peek, NAME_drop,
+///        NAME_reserve, NAME_commit, NAME_front and NAME_release).
+/// \details The queue is not thread-safe. Indices are free-running, so the whole capacity is
+///          usable.
+/// \param [in] NAME name of the generated queue type, used as prefix of generated functions.
+/// \param [in] TYPE item type of the queue.
+/// \param [in] CAPACITY capacity of the queue, must be a power of two.
+// clang-format off
+// cppcheck-suppress [misra-c2012-20.7, misra-c2012-20.10, misra-c2012-20.12]
+#define TYPED_FIFO_DEFINE(NAME, TYPE, CAPACITY) \
+	TYPED_FIFO_STATIC_ASSERT(((CAPACITY) > 0u) && (((CAPACITY) & ((CAPACITY) - 1u)) == 0u), \
+			#NAME " capacity must be a power of two"); \
+\
+	typedef struct { \
+		TYPE elements[(CAPACITY)]; \
+		uint32_t head; \
+		uint32_t tail; \
+	} NAME; \
+\
+	static inline void NAME ## _init(NAME *const fifo) \
+	{ \
+		fifo->head = 0u; \
+		fifo->tail = 0u; \
+	} \
+\
+	static inline void NAME ## _clear(NAME *const fifo) \
+	{ \
+		fifo->tail = fifo->head; \
+	} \
+\
+	static inline size_t NAME ## _getCount(const NAME *const fifo) \
+	{ \
+		return (size_t)(fifo->head - fifo->tail); \
+	} \
+\
+	static inline bool NAME ## _isEmpty(const NAME *const fifo) \
+	{ \
+		return fifo->head == fifo->tail; \
+	} \
+\
+	static inline bool NAME ## _isFull(const NAME *const fifo) \
+	{ \
+		return (fifo->head - fifo->tail) == (uint32_t)(CAPACITY); \
+	} \
+\
+	static inline TYPE *NAME ## _reserve(NAME *const fifo) \
+	{ \
+		if (NAME ## _isFull(fifo)) \
+			return NULL; \
+		return &fifo->elements[fifo->head & ((uint32_t)(CAPACITY) - 1u)]; \
+	} \
+\
+	static inline void NAME ## _commit(NAME *const fifo) \
+	{ \
+		++fifo->head; \
+	} \
+\
+	static inline TYPE *NAME ## _front(NAME *const fifo) \
+	{ \
+		if (NAME ## _isEmpty(fifo)) \
+			return NULL; \
+		return &fifo->elements[fifo->tail & ((uint32_t)(CAPACITY) - 1u)]; \
+	} \
+\
+	static inline void NAME ## _release(NAME *const fifo) \
+	{ \
+		++fifo->tail; \
+	} \
+\
+	static inline bool NAME ## _push(NAME *const fifo, const TYPE *const data) \
+	{ \
+		TYPE *const slot = NAME ## _reserve(fifo); \
+		if (slot == NULL) \
+			return false; \
+		*slot = *data; \
+		NAME ## _commit(fifo); \
+		return true; \
+	} \
+\
+	static inline bool NAME ## _pull(NAME *const fifo, TYPE *const data) \
+	{ \
+		const TYPE *const slot = NAME ## _front(fifo); \
+		if (slot == NULL) \
+			return false; \
+		*data = *slot; \
+		NAME ## _release(fifo); \
+		return true; \
+	} \
+\
+	static inline bool NAME ## _peek(NAME *const fifo, TYPE *const data) \
+	{ \
+		const TYPE *const slot = NAME ## _front(fifo); \
+		if (slot == NULL) \
+			return false; \
+		*data = *slot; \
+		return true; \
+	} \
+\
+	static inline bool NAME ## _drop(NAME *const fifo) \
+	{ \
+		if (NAME ## _isEmpty(fifo)) \
+			return false; \
+		NAME ## _release(fifo); \
+		return true; \
+	}
+// clang-format on
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // UTILS_TYPEDFIFO_H
@@ -0,0 +1,158 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "WdtSupervisor.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <Rstc/Rstc.h>
+#include <Scb/Scb.h>
+
+#define RESET_RECORD_MAGIC 0x57445453u
+
+// Reset record kept in RAM not cleared by the startup code.
+typedef struct {
+	uint32_t magic;
+	WdtSupervisor_ResetRecord record;
+	uint32_t checksum;
+} StoredResetRecord;
+
+static StoredResetRecord storedResetRecord __attribute__((section(".noinit")));
+
+static uint32_t
+calculateChecksum(const WdtSupervisor_ResetRecord *const record)
+{
+	return ~(RESET_RECORD_MAGIC ^ record->missedTaskMask ^ record->tick);
+}
+
+static void
+storeResetRecord(const uint32_t missedTaskMask, const uint32_t tick)
+{
+	storedResetRecord.magic = RESET_RECORD_MAGIC;
+	storedResetRecord.record.missedTaskMask = missedTaskMask;
+	storedResetRecord.record.tick = tick;
+	storedResetRecord.checksum =
+			calculateChecksum(&storedResetRecord.record);
+
+	// The watchdog reset discards the DCache, so the record is written
+	// through to SRAM before it can expire.
+	(void)Scb_cleanDCacheByRange(
+			&storedResetRecord, sizeof(storedResetRecord));
+}
+
+static bool
+isStoredResetRecordValid(void)
+{
+	const uint32_t checksum = calculateChecksum(&storedResetRecord.record);
+
+	return (storedResetRecord.magic == RESET_RECORD_MAGIC)
+			&& (storedResetRecord.checksum == checksum);
+}
+
+void
+WdtSupervisor_init(WdtSupervisor *const supervisor, Wdt *const wdt)
+{
+	assert(supervisor != NULL);
+	assert(wdt != NULL);
+
+	(void)memset(supervisor, 0, sizeof(WdtSupervisor));
+	supervisor->wdt = wdt;
+
+	if ((Rstc_getLastResetType() == Rstc_ResetType_Watchdog)
+			&& isStoredResetRecordValid()) {
+		supervisor->hasLastResetRecord = true;
+		supervisor->lastResetRecord = storedResetRecord.record;
+	}
+
+	// Until a miss is detected, a watchdog reset means the supervisor itself
+	// was not serviced.
+	storeResetRecord(0u, 0u);
+}
+
+bool
+WdtSupervisor_registerTask(WdtSupervisor *const supervisor,
+		const uint32_t windowTicks, uint8_t *const taskId)
+{
+	assert(windowTicks > 0u);
+	assert(taskId != NULL);
+
+	const uint32_t freeMask = ~supervisor->registeredTaskMask;
+	if (freeMask == 0u)
+		return false;
+
+	const uint32_t id = (uint32_t)__builtin_ctz(freeMask);
+	supervisor->tasks[id].windowTicks = windowTicks;
+	supervisor->tasks[id].lastCheckInTick = supervisor->tick;
+	supervisor->registeredTaskMask |= UINT32_C(1) << id;
+	*taskId = (uint8_t)id;
+
+	return true;
+}
+
+bool
+WdtSupervisor_service(WdtSupervisor *const supervisor)
+{
+	if (supervisor->isTripped)
+		return false;
+
+	const uint32_t tick = ++supervisor->tick;
+	const uint32_t heartbeats = __atomic_exchange_n(
+			&supervisor->heartbeatMask, 0u, __ATOMIC_RELAXED);
+
+	uint32_t missedTaskMask = 0u;
+	uint32_t pending = supervisor->registeredTaskMask;
+	while (pending != 0u) {
+		const uint32_t id = (uint32_t)__builtin_ctz(pending);
+		const uint32_t bit = UINT32_C(1) << id;
+		pending &= ~bit;
+
+		WdtSupervisor_Task *const task = &supervisor->tasks[id];
+		if ((heartbeats & bit) != 0u)
+			task->lastCheckInTick = tick;
+		else if ((tick - task->lastCheckInTick) > task->windowTicks)
+			missedTaskMask |= bit;
+	}
+
+	if (missedTaskMask != 0u) {
+		// The WDT is left to expire, the record identifies the culprits.
+		storeResetRecord(missedTaskMask, tick);
+		supervisor->isTripped = true;
+		return false;
+	}
+
+	Wdt_reset(supervisor->wdt);
+	return true;
+}
+
+bool
+WdtSupervisor_getLastResetRecord(const WdtSupervisor *const supervisor,
+		WdtSupervisor_ResetRecord *const record)
+{
+	if (!supervisor->hasLastResetRecord)
+		return false;
+
+	*record = supervisor->lastResetRecord;
+	return true;
+}
@@ -0,0 +1,125 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file WdtSupervisor.h
+/// \addtogroup Bsp
+/// \brief Header containing interface for the watchdog supervisor aggregating heartbeats
+///        of multiple tasks.
+/// \details Each registered task sends heartbeats with ::WdtSupervisor_heartbeat, which
+///          sets its bit in a shared mask. ::WdtSupervisor_service is called periodically,
+///          within the WDT reload window, and restarts the WDT only as long as every task
+///          checked in within its window. A task missing its window is recorded in RAM
+///          not cleared by the startup code, so that it can be identified after the
+///          resulting watchdog reset.
+
+#ifndef BSP_WDTSUPERVISOR_H
+#define BSP_WDTSUPERVISOR_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "Wdt.h"
+
+/// @addtogroup WdtSupervisor
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Maximal number of supervised tasks, limited by the heartbeat mask width.
+#define WDT_SUPERVISOR_MAX_TASK_COUNT 32u
+
+/// \brief Structure describing a supervised task.
+typedef struct {
+	uint32_t windowTicks; ///< Maximal number of service ticks between heartbeats.
+	uint32_t lastCheckInTick; ///< Service tick of the last heartbeat.
+} WdtSupervisor_Task;
+
+/// \brief Structure describing the cause of a watchdog reset forced by the supervisor.
+typedef struct {
+	/// \brief Mask of tasks which missed their windows, 0 if the supervisor itself
+	///        was not serviced in time.
+	uint32_t missedTaskMask;
+	uint32_t tick; ///< Service tick at which the miss was detected.
+} WdtSupervisor_ResetRecord;
+
+/// \brief Structure representing the watchdog supervisor.
+typedef struct {
+	Wdt *wdt; ///< Supervised WDT instance.
+	WdtSupervisor_Task tasks[WDT_SUPERVISOR_MAX_TASK_COUNT]; ///< Registered tasks.
+	uint32_t registeredTaskMask; ///< Mask of registered tasks.
+	uint32_t heartbeatMask; ///< Mask of heartbeats received since the last service tick.
+	uint32_t tick; ///< Number of service ticks.
+	bool isTripped; ///< Has a miss been detected, the WDT is no longer restarted.
+	bool hasLastResetRecord; ///< Was the last reset forced by the supervisor.
+	WdtSupervisor_ResetRecord lastResetRecord; ///< Cause of the last reset.
+} WdtSupervisor;
+
+/// \brief Initializes the supervisor and retrieves the cause of the last reset.
+/// \details The record left in RAM is only accepted if ::Rstc_getLastResetType reports
+///          a watchdog reset.
+/// \param [out] supervisor Supervisor descriptor.
+/// \param [in] wdt Configured WDT instance to be restarted by the supervisor.
+void WdtSupervisor_init(WdtSupervisor *const supervisor, Wdt *const wdt);
+
+/// \brief Registers a supervised task.
+/// \param [in,out] supervisor Supervisor descriptor.
+/// \param [in] windowTicks Maximal number of service ticks between heartbeats, at least 1.
+/// \param [out] taskId Identifier assigned to the task.
+/// \returns Whether the task was registered, false if all slots are in use.
+bool WdtSupervisor_registerTask(WdtSupervisor *const supervisor,
+		const uint32_t windowTicks, uint8_t *const taskId);
+
+/// \brief Sends a heartbeat of a task. Safe to call from any context.
+/// \param [in,out] supervisor Supervisor descriptor.
+/// \param [in] taskId Identifier of the task.
+static inline void
+WdtSupervisor_heartbeat(WdtSupervisor *const supervisor, const uint8_t taskId)
+{
+	(void)__atomic_fetch_or(&supervisor->heartbeatMask,
+			UINT32_C(1) << taskId, __ATOMIC_RELAXED);
+}
+
+/// \brief Collects heartbeats and restarts the WDT if no task missed its window.
+/// \details Shall be called periodically, e.g. from a timer interrupt, with a period
+///          fitting in the WDT reload window.
+/// \param [in,out] supervisor Supervisor descriptor.
+/// \returns Whether the WDT was restarted.
+bool WdtSupervisor_service(WdtSupervisor *const supervisor);
+
+/// \brief Retrieves the cause of the last reset, if it was forced by the supervisor.
+/// \param [in] supervisor Supervisor descriptor.
+/// \param [out] record Reset record.
+/// \returns Whether the last reset was a watchdog reset with a valid record.
+bool WdtSupervisor_getLastResetRecord(const WdtSupervisor *const supervisor,
+		WdtSupervisor_ResetRecord *const record);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_WDTSUPERVISOR_H
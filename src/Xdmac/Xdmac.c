@@ -0,0 +1,443 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "Xdmac.h"
+
+#include <assert.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <Nvic/Nvic.h>
+#include <Scb/Scb.h>
+#include <Utils/Bits.h>
+
+#define XDMAC_CHANNEL_ERROR_INTERRUPTS_MASK \
+	(XDMAC_CIE_RBIE_MASK | XDMAC_CIE_WBIE_MASK | XDMAC_CIE_ROIE_MASK)
+
+#define XDMAC_CHANNEL_ALL_INTERRUPTS_MASK \
+	(XDMAC_CID_BID_MASK | XDMAC_CID_LID_MASK | XDMAC_CID_DID_MASK \
+			| XDMAC_CID_FID_MASK | XDMAC_CID_RBEID_MASK \
+			| XDMAC_CID_WBEID_MASK | XDMAC_CID_ROID_MASK)
+
+static inline uint32_t
+channelMask(const uint8_t channel)
+{
+	return 1u << channel;
+}
+
+static inline void
+clearChannelStatus(Xdmac *const xdmac, const uint8_t channel)
+{
+	(void)xdmac->reg->channel[channel].cis;
+	xdmac->latchedStatus[channel] = 0u;
+	atomicClearBits(&xdmac->latchedChannels, channelMask(channel));
+}
+
+void
+Xdmac_init(Xdmac *const xdmac)
+{
+	assert(xdmac != NULL);
+	(void)memset(xdmac, 0, sizeof(Xdmac));
+
+	// cppcheck-suppress misra-c2012-11.4
+	xdmac->reg = (Xdmac_Registers *)XDMAC_ADDRESS_BASE;
+}
+
+void
+Xdmac_setChannelConfig(Xdmac *const xdmac, const uint8_t channel,
+		const Xdmac_ChannelConfig *const config)
+{
+	assert(channel < XDMAC_CHANNEL_COUNT);
+	assert(!Xdmac_isChannelBusy(xdmac, channel));
+
+	xdmac->reg->channel[channel].cc =
+			(((uint32_t)config->transferType << XDMAC_CC_TYPE_OFFSET)
+					& XDMAC_CC_TYPE_MASK)
+			| (((uint32_t)config->burstSize << XDMAC_CC_MBSIZE_OFFSET)
+					& XDMAC_CC_MBSIZE_MASK)
+			| (((uint32_t)config->direction << XDMAC_CC_DSYNC_OFFSET)
+					& XDMAC_CC_DSYNC_MASK)
+			| (((uint32_t)config->chunkSize << XDMAC_CC_CSIZE_OFFSET)
+					& XDMAC_CC_CSIZE_MASK)
+			| (((uint32_t)config->dataWidth << XDMAC_CC_DWIDTH_OFFSET)
+					& XDMAC_CC_DWIDTH_MASK)
+			| (((uint32_t)config->sourceInterface
+					   << XDMAC_CC_SIF_OFFSET)
+					& XDMAC_CC_SIF_MASK)
+			| (((uint32_t)config->destinationInterface
+					   << XDMAC_CC_DIF_OFFSET)
+					& XDMAC_CC_DIF_MASK)
+			| (((uint32_t)config->sourceAddressingMode
+					   << XDMAC_CC_SAM_OFFSET)
+					& XDMAC_CC_SAM_MASK)
+			| (((uint32_t)config->destinationAddressingMode
+					   << XDMAC_CC_DAM_OFFSET)
+					& XDMAC_CC_DAM_MASK)
+			| (((uint32_t)config->peripheralId << XDMAC_CC_PERID_OFFSET)
+					& XDMAC_CC_PERID_MASK);
+}
+
+void
+Xdmac_getChannelConfig(const Xdmac *const xdmac, const uint8_t channel,
+		Xdmac_ChannelConfig *const config)
+{
+	assert(channel < XDMAC_CHANNEL_COUNT);
+
+	const uint32_t cc = xdmac->reg->channel[channel].cc;
+
+	config->transferType = (Xdmac_TransferType)(
+			(cc & XDMAC_CC_TYPE_MASK) >> XDMAC_CC_TYPE_OFFSET);
+	config->burstSize = (Xdmac_BurstSize)(
+			(cc & XDMAC_CC_MBSIZE_MASK) >> XDMAC_CC_MBSIZE_OFFSET);
+	config->direction = (Xdmac_SyncDirection)(
+			(cc & XDMAC_CC_DSYNC_MASK) >> XDMAC_CC_DSYNC_OFFSET);
+	config->chunkSize = (Xdmac_ChunkSize)(
+			(cc & XDMAC_CC_CSIZE_MASK) >> XDMAC_CC_CSIZE_OFFSET);
+	config->dataWidth = (Xdmac_DataWidth)(
+			(cc & XDMAC_CC_DWIDTH_MASK) >> XDMAC_CC_DWIDTH_OFFSET);
+	config->sourceInterface = (Xdmac_Interface)(
+			(cc & XDMAC_CC_SIF_MASK) >> XDMAC_CC_SIF_OFFSET);
+	config->destinationInterface = (Xdmac_Interface)(
+			(cc & XDMAC_CC_DIF_MASK) >> XDMAC_CC_DIF_OFFSET);
+	config->sourceAddressingMode = (Xdmac_AddressingMode)(
+			(cc & XDMAC_CC_SAM_MASK) >> XDMAC_CC_SAM_OFFSET);
+	config->destinationAddressingMode = (Xdmac_AddressingMode)(
+			(cc & XDMAC_CC_DAM_MASK) >> XDMAC_CC_DAM_OFFSET);
+	config->peripheralId = (Xdmac_PeripheralId)(
+			(cc & XDMAC_CC_PERID_MASK) >> XDMAC_CC_PERID_OFFSET);
+}
+
+void
+Xdmac_setChannelHandler(Xdmac *const xdmac, const uint8_t channel,
+		const Xdmac_ChannelHandler handler)
+{
+	assert(channel < XDMAC_CHANNEL_COUNT);
+
+	xdmac->reg->gid = channelMask(channel);
+	xdmac->channelHandlers[channel] = handler;
+	if (handler.callback != NULL)
+		xdmac->reg->gie = channelMask(channel);
+}
+
+void
+Xdmac_cleanDCache(const void *const address, const uint32_t size)
+{
+	(void)Scb_cleanDCacheByRange(address, size);
+}
+
+void
+Xdmac_invalidateDCache(const void *const address, const uint32_t size)
+{
+	(void)Scb_invalidateDCacheByRange(address, size);
+}
+
+static void
+maintainTransferBuffers(const uint32_t cc, const void *const source,
+		const void *const destination, const uint32_t length)
+{
+	const uint32_t dataWidth =
+			(cc & XDMAC_CC_DWIDTH_MASK) >> XDMAC_CC_DWIDTH_OFFSET;
+	const uint32_t size = length << dataWidth;
+	const bool isPeripheralSync = (cc & XDMAC_CC_TYPE_MASK) != 0u;
+	const bool isMemoryToPeripheral = (cc & XDMAC_CC_DSYNC_MASK) != 0u;
+
+	if (!isPeripheralSync || isMemoryToPeripheral)
+		Xdmac_cleanDCache(source, size);
+	if (!isPeripheralSync || !isMemoryToPeripheral)
+		(void)Scb_cleanInvalidateDCacheByRange(destination, size);
+}
+
+void
+Xdmac_enableChannelIrq(Xdmac *const xdmac, const uint8_t channel)
+{
+	assert(channel < XDMAC_CHANNEL_COUNT);
+	xdmac->reg->gie = channelMask(channel);
+	// Events consumed by a flush no longer raise the interrupt line by themselves.
+	if ((xdmac->latchedChannels & channelMask(channel)) != 0u)
+		Nvic_setInterruptPending(Nvic_Irq_Xdmac);
+}
+
+void
+Xdmac_disableChannelIrq(Xdmac *const xdmac, const uint8_t channel)
+{
+	assert(channel < XDMAC_CHANNEL_COUNT);
+	xdmac->reg->gid = channelMask(channel);
+}
+
+void
+Xdmac_startTransfer(Xdmac *const xdmac, const uint8_t channel,
+		const void *const source, void *const destination,
+		const uint32_t length)
+{
+	assert(channel < XDMAC_CHANNEL_COUNT);
+	assert(length > 0u);
+	assert(length <= XDMAC_MAX_MICROBLOCK_LENGTH);
+	assert(!Xdmac_isChannelBusy(xdmac, channel));
+
+	volatile Xdmac_ChannelRegisters *const reg =
+			&xdmac->reg->channel[channel];
+
+	maintainTransferBuffers(reg->cc, source, destination, length);
+
+	// Clear status left by the previous transfer.
+	clearChannelStatus(xdmac, channel);
+
+	// cppcheck-suppress misra-c2012-11.4
+	reg->csa = (uint32_t)source;
+	// cppcheck-suppress misra-c2012-11.4
+	reg->cda = (uint32_t)destination;
+	reg->cubc = length;
+	reg->cndc = 0u;
+	reg->cbc = 0u;
+	reg->cdsMsp = 0u;
+	reg->csus = 0u;
+	reg->cdus = 0u;
+
+	reg->cid = XDMAC_CHANNEL_ALL_INTERRUPTS_MASK;
+	reg->cie = XDMAC_CIE_BIE_MASK | XDMAC_CHANNEL_ERROR_INTERRUPTS_MASK;
+
+	// Descriptor and buffer writes must be visible to the controller before it is enabled.
+	DATA_SYNC_BARRIER();
+	xdmac->reg->ge = channelMask(channel);
+}
+
+void
+Xdmac_initDescriptor(Xdmac_LinkedListDescriptor *const descriptor,
+		const void *const source, void *const destination,
+		const uint32_t length)
+{
+	assert(length > 0u);
+	assert(length <= XDMAC_MAX_MICROBLOCK_LENGTH);
+
+	descriptor->nextDescriptor = 0u;
+	descriptor->microblockControl = length & XDMAC_MBR_UBC_UBLEN_MASK;
+	// cppcheck-suppress misra-c2012-11.4
+	descriptor->sourceAddress = (uint32_t)source;
+	// cppcheck-suppress misra-c2012-11.4
+	descriptor->destinationAddress = (uint32_t)destination;
+}
+
+void
+Xdmac_linkDescriptors(Xdmac_LinkedListDescriptor *const descriptor,
+		const Xdmac_LinkedListDescriptor *const next)
+{
+	const uint32_t length =
+			descriptor->microblockControl & XDMAC_MBR_UBC_UBLEN_MASK;
+
+	if (next == NULL) {
+		descriptor->nextDescriptor = 0u;
+		descriptor->microblockControl = length;
+		return;
+	}
+
+	// cppcheck-suppress misra-c2012-11.4
+	descriptor->nextDescriptor = (uint32_t)next;
+	// Fetch flags describe the next descriptor: view 1 updates both addresses.
+	descriptor->microblockControl = length | XDMAC_MBR_UBC_NDE_MASK
+			| XDMAC_MBR_UBC_NSEN_MASK | XDMAC_MBR_UBC_NDEN_MASK
+			| ((XDMAC_NDVIEW_1_VALUE << XDMAC_MBR_UBC_NVIEW_OFFSET)
+					& XDMAC_MBR_UBC_NVIEW_MASK);
+}
+
+static inline const Xdmac_LinkedListDescriptor *
+nextDescriptor(const Xdmac_LinkedListDescriptor *const descriptor)
+{
+	if ((descriptor->microblockControl & XDMAC_MBR_UBC_NDE_MASK) == 0u)
+		return NULL;
+	// cppcheck-suppress misra-c2012-11.6
+	return (const Xdmac_LinkedListDescriptor *)descriptor->nextDescriptor;
+}
+
+void
+Xdmac_startLinkedListTransfer(Xdmac *const xdmac, const uint8_t channel,
+		const Xdmac_LinkedListDescriptor *const descriptor)
+{
+	assert(channel < XDMAC_CHANNEL_COUNT);
+	assert(descriptor != NULL);
+	// cppcheck-suppress misra-c2012-11.4
+	assert(((uint32_t)descriptor & 0x3u) == 0u);
+	assert(!Xdmac_isChannelBusy(xdmac, channel));
+
+	volatile Xdmac_ChannelRegisters *const reg =
+			&xdmac->reg->channel[channel];
+
+	const uint32_t cc = reg->cc;
+	const Xdmac_LinkedListDescriptor *it = descriptor;
+	do {
+		// cppcheck-suppress misra-c2012-11.6
+		maintainTransferBuffers(cc, (const void *)it->sourceAddress,
+				// cppcheck-suppress misra-c2012-11.6
+				(const void *)it->destinationAddress,
+				it->microblockControl
+						& XDMAC_MBR_UBC_UBLEN_MASK);
+		Xdmac_cleanDCache(it, sizeof(Xdmac_LinkedListDescriptor));
+		it = nextDescriptor(it);
+	} while ((it != NULL) && (it != descriptor));
+
+	// Clear status left by the previous transfer.
+	clearChannelStatus(xdmac, channel);
+
+	// cppcheck-suppress misra-c2012-11.4
+	reg->cnda = (uint32_t)descriptor;
+	reg->cndc = XDMAC_CNDC_NDE_MASK | XDMAC_CNDC_NDSUP_MASK
+			| XDMAC_CNDC_NDDUP_MASK
+			| ((XDMAC_NDVIEW_1_VALUE << XDMAC_CNDC_NDVIEW_OFFSET)
+					& XDMAC_CNDC_NDVIEW_MASK);
+	reg->cubc = 0u;
+	reg->cbc = 0u;
+	reg->cdsMsp = 0u;
+	reg->csus = 0u;
+	reg->cdus = 0u;
+
+	reg->cid = XDMAC_CHANNEL_ALL_INTERRUPTS_MASK;
+	reg->cie = XDMAC_CIE_LIE_MASK | XDMAC_CHANNEL_ERROR_INTERRUPTS_MASK;
+
+	DATA_SYNC_BARRIER();
+	xdmac->reg->ge = channelMask(channel);
+}
+
+bool
+Xdmac_stopTransfer(Xdmac *const xdmac, const uint8_t channel,
+		const uint32_t timeoutLimit)
+{
+	assert(channel < XDMAC_CHANNEL_COUNT);
+
+	volatile Xdmac_ChannelRegisters *const reg =
+			&xdmac->reg->channel[channel];
+
+	reg->cid = XDMAC_CHANNEL_ALL_INTERRUPTS_MASK;
+	xdmac->reg->gd = channelMask(channel);
+	// Disabling completes once the pending bus transfers are finished.
+	uint32_t timeout = timeoutLimit;
+	while (Xdmac_isChannelBusy(xdmac, channel) && (timeout > 0u))
+		timeout--;
+
+	if (Xdmac_isChannelBusy(xdmac, channel))
+		return false;
+
+	clearChannelStatus(xdmac, channel);
+	return true;
+}
+
+bool
+Xdmac_flushChannel(Xdmac *const xdmac, const uint8_t channel,
+		const uint32_t timeoutLimit)
+{
+	assert(channel < XDMAC_CHANNEL_COUNT);
+
+	volatile Xdmac_ChannelRegisters *const reg =
+			&xdmac->reg->channel[channel];
+
+	// A disabled channel holds no buffered data.
+	if (!Xdmac_isChannelBusy(xdmac, channel))
+		return true;
+
+	xdmac->reg->gswf = channelMask(channel);
+
+	uint32_t timeout = timeoutLimit;
+	for (;;) {
+		// Reading the status register clears it, other events are kept for the handler.
+		const uint32_t status = reg->cis;
+		const uint32_t events = status & ~XDMAC_CIS_FIS_MASK;
+		if (events != 0u) {
+			xdmac->latchedStatus[channel] |= events;
+			atomicSetBits(&xdmac->latchedChannels, channelMask(channel));
+		}
+
+		// The transfer may end before the flush request is served.
+		if (((status & XDMAC_CIS_FIS_MASK) != 0u)
+				|| !Xdmac_isChannelBusy(xdmac, channel))
+			return true;
+		if (timeout == 0u)
+			return false;
+		timeout--;
+	}
+}
+
+bool
+Xdmac_isChannelBusy(const Xdmac *const xdmac, const uint8_t channel)
+{
+	assert(channel < XDMAC_CHANNEL_COUNT);
+	return (xdmac->reg->gs & channelMask(channel)) != 0u;
+}
+
+uint32_t
+Xdmac_getRemainingLength(const Xdmac *const xdmac, const uint8_t channel)
+{
+	assert(channel < XDMAC_CHANNEL_COUNT);
+	return xdmac->reg->channel[channel].cubc & XDMAC_CUBC_UBLEN_MASK;
+}
+
+uint32_t
+Xdmac_getDestinationAddress(const Xdmac *const xdmac, const uint8_t channel)
+{
+	assert(channel < XDMAC_CHANNEL_COUNT);
+	return xdmac->reg->channel[channel].cda;
+}
+
+static inline void
+decodeChannelStatus(const uint32_t status, Xdmac_ChannelStatus *const flags)
+{
+	flags->hasBlockEnded = (status & XDMAC_CIS_BIS_MASK) != 0u;
+	flags->hasListEnded = (status & XDMAC_CIS_LIS_MASK) != 0u;
+	flags->hasChannelDisabled = (status & XDMAC_CIS_DIS_MASK) != 0u;
+	flags->hasChannelFlushed = (status & XDMAC_CIS_FIS_MASK) != 0u;
+	flags->hasReadBusErrorOccurred = (status & XDMAC_CIS_RBEIS_MASK) != 0u;
+	flags->hasWriteBusErrorOccurred =
+			(status & XDMAC_CIS_WBEIS_MASK) != 0u;
+	flags->hasRequestOverflowOccurred =
+			(status & XDMAC_CIS_ROIS_MASK) != 0u;
+}
+
+void
+Xdmac_handleInterrupt(Xdmac *const xdmac)
+{
+	const uint32_t enabled = xdmac->reg->gim;
+	uint32_t pending = (xdmac->reg->gis
+					   | atomicTakeBits(&xdmac->latchedChannels,
+							   enabled))
+			& enabled;
+
+	while (pending != 0u) {
+		const uint8_t channel = (uint8_t)__builtin_ctz(pending);
+		pending &= ~channelMask(channel);
+
+		volatile Xdmac_ChannelRegisters *const reg =
+				&xdmac->reg->channel[channel];
+		// Reading the status register clears it.
+		const uint32_t status = (reg->cis | xdmac->latchedStatus[channel])
+				& reg->cim;
+		xdmac->latchedStatus[channel] = 0u;
+		if (status == 0u)
+			continue;
+
+		const Xdmac_ChannelHandler *const handler =
+				&xdmac->channelHandlers[channel];
+		if (handler->callback == NULL)
+			continue;
+
+		Xdmac_ChannelStatus flags;
+		decodeChannelStatus(status, &flags);
+		handler->callback(flags, handler->arg);
+	}
+}
@@ -0,0 +1,322 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/// \file Xdmac.h
+/// \addtogroup Bsp
+/// \brief Xdmac (Extensible DMA Controller) hardware driver function prototypes and datatypes.
+
+#ifndef BSP_XDMAC_H
+#define BSP_XDMAC_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "XdmacRegisters.h"
+
+/// @addtogroup Xdmac
+/// @ingroup Bsp
+/// @{
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/// \brief Maximum length of a single microblock, in data units.
+#define XDMAC_MAX_MICROBLOCK_LENGTH XDMAC_CUBC_UBLEN_MASK
+
+/// \brief Xdmac transfer types.
+typedef enum {
+	Xdmac_TransferType_MemoryToMemory = 0, ///< Self triggered memory to memory transfer.
+	Xdmac_TransferType_PeripheralSync = 1, ///< Transfer synchronized with a peripheral.
+} Xdmac_TransferType;
+
+/// \brief Xdmac synchronized transfer directions.
+typedef enum {
+	Xdmac_SyncDirection_PeripheralToMemory = 0, ///< Peripheral is the data source.
+	Xdmac_SyncDirection_MemoryToPeripheral = 1, ///< Peripheral is the data destination.
+} Xdmac_SyncDirection;
+
+/// \brief Xdmac memory burst sizes.
+typedef enum {
+	Xdmac_BurstSize_1 = 0, ///< Single beat burst.
+	Xdmac_BurstSize_4 = 1, ///< Four beat burst.
+	Xdmac_BurstSize_8 = 2, ///< Eight beat burst.
+	Xdmac_BurstSize_16 = 3, ///< Sixteen beat burst.
+} Xdmac_BurstSize;
+
+/// \brief Xdmac peripheral chunk sizes.
+typedef enum {
+	Xdmac_ChunkSize_1 = 0, ///< One data transferred per request.
+	Xdmac_ChunkSize_2 = 1, ///< Two data transferred per request.
+	Xdmac_ChunkSize_4 = 2, ///< Four data transferred per request.
+	Xdmac_ChunkSize_8 = 3, ///< Eight data transferred per request.
+	Xdmac_ChunkSize_16 = 4, ///< Sixteen data transferred per request.
+} Xdmac_ChunkSize;
+
+/// \brief Xdmac data widths.
+typedef enum {
+	Xdmac_DataWidth_Byte = 0, ///< 8-bit data unit.
+	Xdmac_DataWidth_HalfWord = 1, ///< 16-bit data unit.
+	Xdmac_DataWidth_Word = 2, ///< 32-bit data unit.
+	Xdmac_DataWidth_DoubleWord = 3, ///< 64-bit data unit.
+} Xdmac_DataWidth;
+
+/// \brief Xdmac system bus interfaces.
+typedef enum {
+	Xdmac_Interface_0 = 0, ///< AHB master interface 0.
+	Xdmac_Interface_1 = 1, ///< AHB master interface 1.
+} Xdmac_Interface;
+
+/// \brief Xdmac addressing modes.
+typedef enum {
+	Xdmac_AddressingMode_Fixed = 0, ///< Address remains unchanged.
+	Xdmac_AddressingMode_Incremented = 1, ///< Address is incremented by the data width.
+	Xdmac_AddressingMode_MicroblockStride = 2, ///< Microblock stride is added.
+	Xdmac_AddressingMode_MicroblockAndDataStride = 3, ///< Microblock and data strides are added.
+} Xdmac_AddressingMode;
+
+/// \brief Xdmac hardware request interface identifiers.
+typedef enum {
+	Xdmac_PeripheralId_Uart0Tx = 20, ///< UART0 transmit.
+	Xdmac_PeripheralId_Uart0Rx = 21, ///< UART0 receive.
+	Xdmac_PeripheralId_Uart1Tx = 22, ///< UART1 transmit.
+	Xdmac_PeripheralId_Uart1Rx = 23, ///< UART1 receive.
+	Xdmac_PeripheralId_Uart2Tx = 24, ///< UART2 transmit.
+	Xdmac_PeripheralId_Uart2Rx = 25, ///< UART2 receive.
+	Xdmac_PeripheralId_Uart3Tx = 26, ///< UART3 transmit.
+	Xdmac_PeripheralId_Uart3Rx = 27, ///< UART3 receive.
+	Xdmac_PeripheralId_Uart4Tx = 28, ///< UART4 transmit.
+	Xdmac_PeripheralId_Uart4Rx = 29, ///< UART4 receive.
+	Xdmac_PeripheralId_PioaRx = 34, ///< PIOA parallel capture.
+	Xdmac_PeripheralId_Tc0Rx = 40, ///< TC0 capture.
+	Xdmac_PeripheralId_Tc1Rx = 41, ///< TC1 capture.
+	Xdmac_PeripheralId_Tc2Rx = 42, ///< TC2 capture.
+	Xdmac_PeripheralId_Tc3Rx = 43, ///< TC3 capture.
+} Xdmac_PeripheralId;
+
+/// \brief Xdmac channel configuration descriptor.
+typedef struct {
+	Xdmac_TransferType transferType; ///< Transfer type.
+	Xdmac_SyncDirection direction; ///< Direction of a peripheral synchronized transfer.
+	Xdmac_PeripheralId peripheralId; ///< Request interface of a synchronized transfer.
+	Xdmac_BurstSize burstSize; ///< Memory burst size.
+	Xdmac_ChunkSize chunkSize; ///< Peripheral chunk size.
+	Xdmac_DataWidth dataWidth; ///< Size of a single data unit.
+	Xdmac_Interface sourceInterface; ///< Bus interface used to read the source.
+	Xdmac_Interface destinationInterface; ///< Bus interface used to write the destination.
+	Xdmac_AddressingMode sourceAddressingMode; ///< Source addressing mode.
+	Xdmac_AddressingMode destinationAddressingMode; ///< Destination addressing mode.
+} Xdmac_ChannelConfig;
+
+/// \brief Xdmac channel status flags.
+typedef struct {
+	bool hasBlockEnded; ///< End of block detected.
+	bool hasListEnded; ///< End of linked list detected.
+	bool hasChannelDisabled; ///< Channel disabled by software request completed.
+	bool hasChannelFlushed; ///< Channel flush request completed.
+	bool hasReadBusErrorOccurred; ///< Read bus error detected.
+	bool hasWriteBusErrorOccurred; ///< Write bus error detected.
+	bool hasRequestOverflowOccurred; ///< Peripheral request overflow detected.
+} Xdmac_ChannelStatus;
+
+/// \brief A function serving as a callback called upon a channel interrupt.
+typedef void (*XdmacChannelCallback)(Xdmac_ChannelStatus status, void *arg);
+
+/// \brief A descriptor of a channel event handler.
+typedef struct {
+	XdmacChannelCallback callback; ///< Callback function.
+	void *arg; ///< Argument to the callback function.
+} Xdmac_ChannelHandler;
+
+/// \brief Xdmac linked list descriptor (view 1), describing a single microblock of
+///        a scatter-gather transfer. Shall be word aligned and must stay valid for the whole
+///        duration of the transfer, as it is fetched from memory by the controller.
+typedef struct {
+	uint32_t nextDescriptor; ///< Address of the next descriptor.
+	uint32_t microblockControl; ///< Microblock length and next descriptor fetch control.
+	uint32_t sourceAddress; ///< Microblock source address.
+	uint32_t destinationAddress; ///< Microblock destination address.
+} Xdmac_LinkedListDescriptor;
+
+/// \brief Xdmac device descriptor.
+typedef struct {
+	volatile Xdmac_Registers *reg; ///< Pointer to memory-mapped device registers.
+	Xdmac_ChannelHandler channelHandlers[XDMAC_CHANNEL_COUNT]; ///< Channel event handlers.
+	/// \brief Channel events consumed by ::Xdmac_flushChannel, not yet dispatched.
+	uint32_t latchedStatus[XDMAC_CHANNEL_COUNT];
+	volatile uint32_t latchedChannels; ///< Mask of channels with latched events.
+} Xdmac;
+
+/// \brief Initializes a device descriptor for Xdmac.
+/// \param [out] xdmac Xdmac device descriptor.
+void Xdmac_init(Xdmac *const xdmac);
+
+/// \brief Configures an Xdmac channel based on a configuration descriptor.
+///        The channel shall not be busy.
+/// \param [in] xdmac Xdmac device descriptor.
+/// \param [in] channel Channel index.
+/// \param [in] config A configuration descriptor.
+void Xdmac_setChannelConfig(Xdmac *const xdmac, const uint8_t channel,
+		const Xdmac_ChannelConfig *const config);
+
+/// \brief Retrieves configuration of an Xdmac channel.
+/// \param [in] xdmac Xdmac device descriptor.
+/// \param [in] channel Channel index.
+/// \param [out] config A configuration descriptor.
+void Xdmac_getChannelConfig(const Xdmac *const xdmac, const uint8_t channel,
+		Xdmac_ChannelConfig *const config);
+
+/// \brief Registers a handler called upon a channel interrupt.
+/// \param [in] xdmac Xdmac device descriptor.
+/// \param [in] channel Channel index.
+/// \param [in] handler Channel handler descriptor.
+void Xdmac_setChannelHandler(Xdmac *const xdmac, const uint8_t channel,
+		const Xdmac_ChannelHandler handler);
+
+/// \brief Enables interrupt line of a channel, previously masked with ::Xdmac_disableChannelIrq.
+///        Events latched in the meantime, also by ::Xdmac_flushChannel, are serviced once
+///        the interrupt is enabled.
+/// \param [in] xdmac Xdmac device descriptor.
+/// \param [in] channel Channel index.
+void Xdmac_enableChannelIrq(Xdmac *const xdmac, const uint8_t channel);
+
+/// \brief Masks interrupt line of a channel, e.g. to guard data shared with the channel handler.
+/// \param [in] xdmac Xdmac device descriptor.
+/// \param [in] channel Channel index.
+void Xdmac_disableChannelIrq(Xdmac *const xdmac, const uint8_t channel);
+
+/// \brief Starts a single microblock transfer on a channel.
+/// \details End of block and error interrupts are enabled for the channel, the registered
+///          handler is called from ::Xdmac_handleInterrupt when the transfer completes.
+///          When the data cache is enabled, memory source is cleaned and memory destination is
+///          cleaned and invalidated, so that no dirty line is evicted over the transferred data.
+///          The destination has to be invalidated with ::Xdmac_invalidateDCache again before
+///          the CPU reads the transferred data, and should be aligned to cache lines.
+/// \param [in] xdmac Xdmac device descriptor.
+/// \param [in] channel Channel index.
+/// \param [in] source Source address.
+/// \param [in] destination Destination address.
+/// \param [in] length Transfer length in data units, up to ::XDMAC_MAX_MICROBLOCK_LENGTH.
+void Xdmac_startTransfer(Xdmac *const xdmac, const uint8_t channel,
+		const void *const source, void *const destination,
+		const uint32_t length);
+
+/// \brief Initializes a linked list descriptor as the last element of a list.
+/// \param [out] descriptor Linked list descriptor.
+/// \param [in] source Source address.
+/// \param [in] destination Destination address.
+/// \param [in] length Microblock length in data units, up to ::XDMAC_MAX_MICROBLOCK_LENGTH.
+void Xdmac_initDescriptor(Xdmac_LinkedListDescriptor *const descriptor,
+		const void *const source, void *const destination,
+		const uint32_t length);
+
+/// \brief Links a descriptor with the following one, or terminates the list at it.
+/// \details Lists may be circular, looping back to the first descriptor, in which case
+///          the transfer continues until stopped.
+/// \param [in,out] descriptor Linked list descriptor.
+/// \param [in] next Descriptor fetched after the given one, or NULL to terminate the list.
+void Xdmac_linkDescriptors(Xdmac_LinkedListDescriptor *const descriptor,
+		const Xdmac_LinkedListDescriptor *const next);
+
+/// \brief Starts a scatter-gather transfer described by a list of descriptors.
+/// \details Descriptors are cleaned from the data cache, memory buffers are maintained as in
+///          ::Xdmac_startTransfer. End of list and error interrupts are enabled for
+///          the channel, the registered handler is called from ::Xdmac_handleInterrupt.
+/// \param [in] xdmac Xdmac device descriptor.
+/// \param [in] channel Channel index, configured with ::Xdmac_setChannelConfig.
+/// \param [in] descriptor First descriptor of the list.
+void Xdmac_startLinkedListTransfer(Xdmac *const xdmac, const uint8_t channel,
+		const Xdmac_LinkedListDescriptor *const descriptor);
+
+/// \brief Makes data written by the CPU visible to the controller before a transfer.
+/// \details Wrapper for ::Scb_cleanDCacheByRange. The range is extended to whole cache lines.
+///          Does nothing if the data cache is disabled.
+/// \param [in] address Start of the memory range.
+/// \param [in] size Size of the memory range in bytes.
+void Xdmac_cleanDCache(const void *const address, const uint32_t size);
+
+/// \brief Discards stale cached data of a range written by the controller, so that
+///        the CPU reads the transferred data.
+/// \details Wrapper for ::Scb_invalidateDCacheByRange. Lines only partially covered by the
+///          range are cleaned before being invalidated, to preserve neighbouring data. Does
+///          nothing if the data cache is disabled.
+/// \param [in] address Start of the memory range.
+/// \param [in] size Size of the memory range in bytes.
+void Xdmac_invalidateDCache(const void *const address, const uint32_t size);
+
+/// \brief Disables a channel, aborting the transfer in progress.
+/// \details Disabling completes once the pending bus transfers are finished, which may
+///          never happen when the channel is stalled on a peripheral handshake.
+/// \param [in] xdmac Xdmac device descriptor.
+/// \param [in] channel Channel index.
+/// \param [in] timeoutLimit Iteration limit for waiting until the channel is disabled.
+/// \retval true Channel is disabled.
+/// \retval false Timeout has occurred, the channel is still busy.
+bool Xdmac_stopTransfer(Xdmac *const xdmac, const uint8_t channel,
+		const uint32_t timeoutLimit);
+
+/// \brief Writes data buffered in the channel FIFO to the destination, so that the remaining
+///        length reported by ::Xdmac_getRemainingLength matches data present in memory.
+/// \details Required before sampling progress of a peripheral to memory transfer in
+///          progress. The channel interrupt shall be masked with ::Xdmac_disableChannelIrq
+///          during the call. Channel events which occur while waiting for the flush are
+///          dispatched by ::Xdmac_handleInterrupt once the interrupt is enabled again.
+/// \param [in] xdmac Xdmac device descriptor.
+/// \param [in] channel Channel index.
+/// \param [in] timeoutLimit Iteration limit for waiting until the flush completes.
+/// \retval true Channel is flushed or idle.
+/// \retval false Timeout has occurred.
+bool Xdmac_flushChannel(Xdmac *const xdmac, const uint8_t channel,
+		const uint32_t timeoutLimit);
+
+/// \brief Checks whether a channel is performing a transfer.
+/// \param [in] xdmac Xdmac device descriptor.
+/// \param [in] channel Channel index.
+/// \retval true Channel is enabled.
+/// \retval false Channel is idle.
+bool Xdmac_isChannelBusy(const Xdmac *const xdmac, const uint8_t channel);
+
+/// \brief Gets the number of data units not yet transferred in the current microblock.
+/// \param [in] xdmac Xdmac device descriptor.
+/// \param [in] channel Channel index.
+/// \returns Remaining microblock length.
+uint32_t Xdmac_getRemainingLength(const Xdmac *const xdmac, const uint8_t channel);
+
+/// \brief Gets the address the next data unit is written to by a channel.
+/// \param [in] xdmac Xdmac device descriptor.
+/// \param [in] channel Channel index.
+/// \returns Current destination address.
+uint32_t Xdmac_getDestinationAddress(
+		const Xdmac *const xdmac, const uint8_t channel);
+
+/// \brief Default interrupt handler for Xdmac, dispatches channel events to their handlers.
+/// \param [in] xdmac Xdmac device descriptor.
+void Xdmac_handleInterrupt(Xdmac *const xdmac);
+
+#ifdef __cplusplus
+} // extern "C"
+#endif
+
+/// @}
+
+#endif // BSP_XDMAC_H
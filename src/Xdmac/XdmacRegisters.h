@@ -0,0 +1,180 @@
+/**@file
+ * This file is part of the ARM BSP for the Test Environment.
+ *
+ * @copyright 2025 N7 Space Sp. z o.o.
+ *
+ * Test Environment was developed under a programme of,
+ * and funded by, the European Space Agency (the "ESA").
+ *
+ *
+ * Licensed under the ESA Public License (ESA-PL) Permissive (Type 3),
+ * Version 2.4 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     https://essr.esa.int/license/list
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef BSP_XDMAC_REGISTERS_H
+#define BSP_XDMAC_REGISTERS_H
+
+#include <stdint.h>
+
+/// \brief Number of XDMAC channels.
+#define XDMAC_CHANNEL_COUNT 24u
+
+/// \brief Structure representing XDMAC channel control and status registers.
+typedef struct {
+	volatile uint32_t cie; ///< 0x00 Channel Interrupt Enable Register
+	volatile uint32_t cid; ///< 0x04 Channel Interrupt Disable Register
+	volatile uint32_t cim; ///< 0x08 Channel Interrupt Mask Register
+	volatile uint32_t cis; ///< 0x0C Channel Interrupt Status Register
+	volatile uint32_t csa; ///< 0x10 Channel Source Address Register
+	volatile uint32_t cda; ///< 0x14 Channel Destination Address Register
+	volatile uint32_t cnda; ///< 0x18 Channel Next Descriptor Address Register
+	volatile uint32_t cndc; ///< 0x1C Channel Next Descriptor Control Register
+	volatile uint32_t cubc; ///< 0x20 Channel Microblock Control Register
+	volatile uint32_t cbc; ///< 0x24 Channel Block Control Register
+	volatile uint32_t cc; ///< 0x28 Channel Configuration Register
+	volatile uint32_t cdsMsp; ///< 0x2C Channel Data Stride Memory Set Pattern Register
+	volatile uint32_t csus; ///< 0x30 Channel Source Microblock Stride Register
+	volatile uint32_t cdus; ///< 0x34 Channel Destination Microblock Stride Register
+	volatile uint32_t reserved[2]; ///< 0x38 - 0x3C Reserved
+} Xdmac_ChannelRegisters;
+
+/// \brief Structure representing XDMAC global control and status registers.
+typedef struct {
+	volatile uint32_t gtype; ///< 0x00 Global Type Register
+	volatile uint32_t gcfg; ///< 0x04 Global Configuration Register
+	volatile uint32_t gwac; ///< 0x08 Global Weighted Arbiter Configuration Register
+	volatile uint32_t gie; ///< 0x0C Global Interrupt Enable Register
+	volatile uint32_t gid; ///< 0x10 Global Interrupt Disable Register
+	volatile uint32_t gim; ///< 0x14 Global Interrupt Mask Register
+	volatile uint32_t gis; ///< 0x18 Global Interrupt Status Register
+	volatile uint32_t ge; ///< 0x1C Global Channel Enable Register
+	volatile uint32_t gd; ///< 0x20 Global Channel Disable Register
+	volatile uint32_t gs; ///< 0x24 Global Channel Status Register
+	volatile uint32_t grs; ///< 0x28 Global Channel Read Suspend Register
+	volatile uint32_t gws; ///< 0x2C Global Channel Write Suspend Register
+	volatile uint32_t grws; ///< 0x30 Global Channel Read Write Suspend Register
+	volatile uint32_t grwr; ///< 0x34 Global Channel Read Write Resume Register
+	volatile uint32_t gswr; ///< 0x38 Global Channel Software Request Register
+	volatile uint32_t gsws; ///< 0x3C Global Channel Software Request Status Register
+	volatile uint32_t gswf; ///< 0x40 Global Channel Software Flush Request Register
+	volatile uint32_t reserved[3]; ///< 0x44 - 0x4C Reserved
+	Xdmac_ChannelRegisters channel[XDMAC_CHANNEL_COUNT]; ///< 0x50 Channel registers
+} Xdmac_Registers;
+
+#define XDMAC_ADDRESS_BASE 0x40078000u
+
+#define XDMAC_CIE_BIE_MASK 0x00000001u
+#define XDMAC_CIE_BIE_OFFSET 0u
+#define XDMAC_CIE_LIE_MASK 0x00000002u
+#define XDMAC_CIE_LIE_OFFSET 1u
+#define XDMAC_CIE_DIE_MASK 0x00000004u
+#define XDMAC_CIE_DIE_OFFSET 2u
+#define XDMAC_CIE_FIE_MASK 0x00000008u
+#define XDMAC_CIE_FIE_OFFSET 3u
+#define XDMAC_CIE_RBIE_MASK 0x00000010u
+#define XDMAC_CIE_RBIE_OFFSET 4u
+#define XDMAC_CIE_WBIE_MASK 0x00000020u
+#define XDMAC_CIE_WBIE_OFFSET 5u
+#define XDMAC_CIE_ROIE_MASK 0x00000040u
+#define XDMAC_CIE_ROIE_OFFSET 6u
+
+#define XDMAC_CID_BID_MASK 0x00000001u
+#define XDMAC_CID_BID_OFFSET 0u
+#define XDMAC_CID_LID_MASK 0x00000002u
+#define XDMAC_CID_LID_OFFSET 1u
+#define XDMAC_CID_DID_MASK 0x00000004u
+#define XDMAC_CID_DID_OFFSET 2u
+#define XDMAC_CID_FID_MASK 0x00000008u
+#define XDMAC_CID_FID_OFFSET 3u
+#define XDMAC_CID_RBEID_MASK 0x00000010u
+#define XDMAC_CID_RBEID_OFFSET 4u
+#define XDMAC_CID_WBEID_MASK 0x00000020u
+#define XDMAC_CID_WBEID_OFFSET 5u
+#define XDMAC_CID_ROID_MASK 0x00000040u
+#define XDMAC_CID_ROID_OFFSET 6u
+
+#define XDMAC_CIS_BIS_MASK 0x00000001u
+#define XDMAC_CIS_BIS_OFFSET 0u
+#define XDMAC_CIS_LIS_MASK 0x00000002u
+#define XDMAC_CIS_LIS_OFFSET 1u
+#define XDMAC_CIS_DIS_MASK 0x00000004u
+#define XDMAC_CIS_DIS_OFFSET 2u
+#define XDMAC_CIS_FIS_MASK 0x00000008u
+#define XDMAC_CIS_FIS_OFFSET 3u
+#define XDMAC_CIS_RBEIS_MASK 0x00000010u
+#define XDMAC_CIS_RBEIS_OFFSET 4u
+#define XDMAC_CIS_WBEIS_MASK 0x00000020u
+#define XDMAC_CIS_WBEIS_OFFSET 5u
+#define XDMAC_CIS_ROIS_MASK 0x00000040u
+#define XDMAC_CIS_ROIS_OFFSET 6u
+
+#define XDMAC_CNDC_NDE_MASK 0x00000001u
+#define XDMAC_CNDC_NDE_OFFSET 0u
+#define XDMAC_CNDC_NDSUP_MASK 0x00000002u
+#define XDMAC_CNDC_NDSUP_OFFSET 1u
+#define XDMAC_CNDC_NDDUP_MASK 0x00000004u
+#define XDMAC_CNDC_NDDUP_OFFSET 2u
+#define XDMAC_CNDC_NDVIEW_MASK 0x00000018u
+#define XDMAC_CNDC_NDVIEW_OFFSET 3u
+
+#define XDMAC_CUBC_UBLEN_MASK 0x00FFFFFFu
+#define XDMAC_CUBC_UBLEN_OFFSET 0u
+
+#define XDMAC_MBR_UBC_UBLEN_MASK 0x00FFFFFFu
+#define XDMAC_MBR_UBC_UBLEN_OFFSET 0u
+#define XDMAC_MBR_UBC_NDE_MASK 0x01000000u
+#define XDMAC_MBR_UBC_NDE_OFFSET 24u
+#define XDMAC_MBR_UBC_NSEN_MASK 0x02000000u
+#define XDMAC_MBR_UBC_NSEN_OFFSET 25u
+#define XDMAC_MBR_UBC_NDEN_MASK 0x04000000u
+#define XDMAC_MBR_UBC_NDEN_OFFSET 26u
+#define XDMAC_MBR_UBC_NVIEW_MASK 0x18000000u
+#define XDMAC_MBR_UBC_NVIEW_OFFSET 27u
+
+#define XDMAC_NDVIEW_1_VALUE 1u
+
+#define XDMAC_CBC_BLEN_MASK 0x00000FFFu
+#define XDMAC_CBC_BLEN_OFFSET 0u
+
+#define XDMAC_CC_TYPE_MASK 0x00000001u
+#define XDMAC_CC_TYPE_OFFSET 0u
+#define XDMAC_CC_MBSIZE_MASK 0x00000006u
+#define XDMAC_CC_MBSIZE_OFFSET 1u
+#define XDMAC_CC_DSYNC_MASK 0x00000010u
+#define XDMAC_CC_DSYNC_OFFSET 4u
+#define XDMAC_CC_SWREQ_MASK 0x00000040u
+#define XDMAC_CC_SWREQ_OFFSET 6u
+#define XDMAC_CC_MEMSET_MASK 0x00000080u
+#define XDMAC_CC_MEMSET_OFFSET 7u
+#define XDMAC_CC_CSIZE_MASK 0x00000700u
+#define XDMAC_CC_CSIZE_OFFSET 8u
+#define XDMAC_CC_DWIDTH_MASK 0x00001800u
+#define XDMAC_CC_DWIDTH_OFFSET 11u
+#define XDMAC_CC_SIF_MASK 0x00002000u
+#define XDMAC_CC_SIF_OFFSET 13u
+#define XDMAC_CC_DIF_MASK 0x00004000u
+#define XDMAC_CC_DIF_OFFSET 14u
+#define XDMAC_CC_SAM_MASK 0x00030000u
+#define XDMAC_CC_SAM_OFFSET 16u
+#define XDMAC_CC_DAM_MASK 0x000C0000u
+#define XDMAC_CC_DAM_OFFSET 18u
+#define XDMAC_CC_INITD_MASK 0x00200000u
+#define XDMAC_CC_INITD_OFFSET 21u
+#define XDMAC_CC_RDIP_MASK 0x00400000u
+#define XDMAC_CC_RDIP_OFFSET 22u
+#define XDMAC_CC_WRIP_MASK 0x00800000u
+#define XDMAC_CC_WRIP_OFFSET 23u
+#define XDMAC_CC_PERID_MASK 0x7F000000u
+#define XDMAC_CC_PERID_OFFSET 24u
+
+#endif // BSP_XDMAC_REGISTERS_H